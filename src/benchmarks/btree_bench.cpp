@@ -0,0 +1,80 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <type_traits>
+
+#include "../include/s21_btree_map.h"
+#include "../include/s21_btree_set.h"
+#include "../include/s21_map.h"
+#include "../include/s21_set.h"
+
+// Сравнивает AVL-контейнеры (set, map) с контейнерами на B-дереве
+// (btree_set, btree_map) на 8-байтовых ключах: вставка и поиск в
+// случайном порядке и полный обход. Время - в наносекундах на элемент.
+// Верхняя граница числа ключей задается первым аргументом (по умолчанию
+// 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+template <typename Container>
+void Insert(Container &container, uint64_t key) {
+  if constexpr (std::is_same<typename Container::key_type,
+                             typename Container::value_type>::value) {
+    container.insert(key);
+  } else {
+    container.try_emplace(key, key);
+  }
+}
+
+// Возвращает false, если результаты операций не сошлись с ожидаемыми
+template <typename Container>
+bool Run(const char *name, s21::vector<uint64_t> &keys) {
+  size_t n = keys.size();
+  Container container;
+  auto t0 = Clock::now();
+  for (size_t i = 0; i < n; ++i) Insert(container, keys[i]);
+  auto t1 = Clock::now();
+  size_t found = 0;
+  for (size_t i = 0; i < n; ++i) found += container.contains(keys[i]);
+  auto t2 = Clock::now();
+  uint64_t sum = 0;
+  for (auto it = container.begin(); it != container.end(); ++it) sum += *it;
+  auto t3 = Clock::now();
+
+  std::printf("%10zu %-10s %12.1f %12.1f %12.2f\n", n, name,
+              NsPerOp(t0, t1, n), NsPerOp(t1, t2, n), NsPerOp(t2, t3, n));
+  uint64_t expected = 0;
+  for (size_t i = 0; i < n; ++i) expected += keys[i];
+  return found == n && container.size() == n && sum == expected;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(42);
+
+  std::printf("%10s %-10s %12s %12s %12s\n", "n", "container", "insert ns",
+              "find ns", "scan ns");
+  bool ok = true;
+  for (size_t n = 1000; n <= max_n; n *= 10) {
+    // Ключи без повторов: старшие биты случайны, младшие - номер ключа
+    s21::vector<uint64_t> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) keys.push_back((rng() << 32) | i);
+
+    ok &= Run<s21::set<uint64_t>>("set", keys);
+    ok &= Run<s21::btree_set<uint64_t>>("btree_set", keys);
+    ok &= Run<s21::map<uint64_t, uint64_t>>("map", keys);
+    ok &= Run<s21::btree_map<uint64_t, uint64_t>>("btree_map", keys);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,104 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <random>
+#include <thread>
+#include <vector>
+
+#include "../include/s21_concurrent_map.h"
+#include "../include/s21_map.h"
+
+// Пропускная способность s21::map под общим std::mutex и
+// s21::concurrent_map при 1-64 потоках и разной доле чтений. Ключи
+// случайны из [0, 2n), дерево заранее заполнено n ключами; запись -
+// поровну insert_or_assign и erase. Все потоки вместе выполняют kOps
+// операций, результат - миллионы операций в секунду. Число ключей n
+// задается первым аргументом (по умолчанию 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kOps = 1000000;
+
+// s21::map за одной блокировкой - то, что остается без concurrent_map
+class LockedMap {
+ public:
+  void insert_or_assign(uint64_t key, uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.insert_or_assign(key, value);
+  }
+  void erase(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    map_.erase(key);
+  }
+  bool contains(uint64_t key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return map_.contains(key);
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::map<uint64_t, uint64_t> map_;
+};
+
+template <typename Map>
+void Worker(Map &map, size_t n, unsigned read_percent, size_t ops,
+            uint64_t seed, size_t &hits) {
+  std::mt19937_64 rng(seed);
+  size_t found = 0;
+  for (size_t i = 0; i < ops; ++i) {
+    uint64_t key = rng() % (2 * n);
+    unsigned roll = static_cast<unsigned>(rng() % 100);
+    if (roll < read_percent) {
+      found += map.contains(key);
+    } else if (roll % 2) {
+      map.insert_or_assign(key, key);
+    } else {
+      map.erase(key);
+    }
+  }
+  hits = found;
+}
+
+template <typename Map>
+double Run(size_t n, unsigned threads, unsigned read_percent) {
+  Map map;
+  for (uint64_t key = 0; key < 2 * n; key += 2) map.insert_or_assign(key, key);
+
+  std::vector<std::thread> workers;
+  std::vector<size_t> hits(threads);
+  auto start = Clock::now();
+  for (unsigned t = 0; t < threads; ++t) {
+    workers.emplace_back(Worker<Map>, std::ref(map), n, read_percent,
+                         kOps / threads, t + 1, std::ref(hits[t]));
+  }
+  for (unsigned t = 0; t < threads; ++t) workers[t].join();
+  auto stop = Clock::now();
+  double seconds = std::chrono::duration<double>(stop - start).count();
+  return (kOps / threads) * threads / seconds / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::printf("n = %zu, %u hardware threads\n", n,
+              std::thread::hardware_concurrency());
+  std::printf("%8s %7s %16s %16s\n", "threads", "read %", "mutex Mops/s",
+              "concurrent Mops/s");
+  const unsigned read_percents[] = {100, 90, 50};
+  for (unsigned read_percent : read_percents) {
+    for (unsigned threads = 1; threads <= 64; threads *= 2) {
+      double locked = Run<LockedMap>(n, threads, read_percent);
+      double concurrent =
+          Run<s21::concurrent_map<uint64_t, uint64_t>>(n, threads,
+                                                       read_percent);
+      std::printf("%8u %7u %16.2f %16.2f\n", threads, read_percent, locked,
+                  concurrent);
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,137 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../include/s21_concurrent_queue.h"
+#include "../include/s21_queue.h"
+
+// Передача элементов от P производителей к P потребителям через
+// s21::queue под std::mutex, через concurrent_queue по одному элементу и
+// через concurrent_queue пакетами по kBatch. Результат - миллионы
+// переданных элементов в секунду (каждый элемент - один push и один pop).
+// Общее число элементов задается первым аргументом (по умолчанию 1e7)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kBatch = 32;
+
+// s21::queue за одной блокировкой - то, что есть без concurrent_queue
+class LockedQueue {
+ public:
+  bool try_push(uint64_t value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    queue_.push(value);
+    return true;
+  }
+  bool try_pop(uint64_t &value) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (queue_.empty()) return false;
+    value = queue_.front();
+    queue_.pop();
+    return true;
+  }
+
+ private:
+  std::mutex mutex_;
+  s21::queue<uint64_t> queue_;
+};
+
+// Ожидание в пустой или полной очереди: на машине с одним ядром
+// производитель и потребитель иначе не дождутся друг друга
+void Wait() { std::this_thread::yield(); }
+
+template <typename Queue>
+void Produce(Queue &queue, uint64_t first, size_t count) {
+  for (size_t i = 0; i < count; ++i) {
+    while (!queue.try_push(first + i)) Wait();
+  }
+}
+
+template <typename Queue>
+void Consume(Queue &queue, size_t count, uint64_t &sum) {
+  uint64_t value = 0;
+  for (size_t i = 0; i < count; ++i) {
+    while (!queue.try_pop(value)) Wait();
+    sum += value;
+  }
+}
+
+void ProduceBatches(s21::concurrent_queue<uint64_t> &queue, uint64_t first,
+                    size_t count) {
+  uint64_t batch[kBatch];
+  for (size_t done = 0; done < count;) {
+    size_t size = count - done < kBatch ? count - done : kBatch;
+    for (size_t i = 0; i < size; ++i) batch[i] = first + done + i;
+    for (size_t pushed = 0; pushed < size;) {
+      size_t added = queue.try_push_many(batch + pushed, size - pushed);
+      if (added == 0) Wait();
+      pushed += added;
+    }
+    done += size;
+  }
+}
+
+void ConsumeBatches(s21::concurrent_queue<uint64_t> &queue, size_t count,
+                    uint64_t &sum) {
+  uint64_t batch[kBatch];
+  for (size_t done = 0; done < count;) {
+    size_t want = count - done < kBatch ? count - done : kBatch;
+    size_t popped = queue.try_pop_many(batch, want);
+    if (popped == 0) Wait();
+    for (size_t i = 0; i < popped; ++i) sum += batch[i];
+    done += popped;
+  }
+}
+
+// Возвращает миллионы элементов в секунду или -1, если сумма полученных
+// элементов не сошлась с отправленной
+template <typename Queue, typename Producer, typename Consumer>
+double Run(size_t total, unsigned pairs, Producer produce,
+           Consumer consume) {
+  Queue queue;
+  size_t share = total / pairs;
+  std::vector<std::thread> threads;
+  std::vector<uint64_t> sums(pairs, 0);
+  auto start = Clock::now();
+  for (unsigned t = 0; t < pairs; ++t) {
+    threads.emplace_back(produce, std::ref(queue), t * share, share);
+    threads.emplace_back(consume, std::ref(queue), share, std::ref(sums[t]));
+  }
+  for (std::thread &thread : threads) thread.join();
+  auto stop = Clock::now();
+
+  uint64_t sum = 0;
+  for (uint64_t part : sums) sum += part;
+  uint64_t sent = share * pairs;
+  if (sum != sent * (sent - 1) / 2) return -1;
+  return sent / std::chrono::duration<double>(stop - start).count() / 1e6;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t total = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  using Concurrent = s21::concurrent_queue<uint64_t>;
+  std::printf("%zu items, %u hardware threads\n", total,
+              std::thread::hardware_concurrency());
+  std::printf("%6s %14s %14s %14s\n", "pairs", "mutex M/s", "single M/s",
+              "batch M/s");
+  bool ok = true;
+  for (unsigned pairs = 1; pairs <= 8; pairs *= 2) {
+    double locked = Run<LockedQueue>(total, pairs, Produce<LockedQueue>,
+                                     Consume<LockedQueue>);
+    double single = Run<Concurrent>(total, pairs, Produce<Concurrent>,
+                                    Consume<Concurrent>);
+    double batch =
+        Run<Concurrent>(total, pairs, ProduceBatches, ConsumeBatches);
+    ok &= locked > 0 && single > 0 && batch > 0;
+    std::printf("%6u %14.2f %14.2f %14.2f\n", pairs, locked, single, batch);
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,69 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+#include "../include/s21_counted_multiset.h"
+#include "../include/s21_multiset.h"
+
+// Поток событий с частыми повторами: n ключей из k различных. Для
+// s21::multiset (узел на каждую копию) и s21::counted_multiset (узел на
+// ключ со счетчиком) измеряются время вставки и запроса count в
+// наносекундах на операцию и память на элемент по байтам, запрошенным у
+// operator new. Число событий задается первым аргументом (по умолчанию
+// 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+size_t allocated_bytes = 0;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+template <typename Multiset>
+void Measure(const char *name, size_t n, int distinct) {
+  std::mt19937 rng(18);
+  size_t before = allocated_bytes;
+  size_t checksum = 0;
+  {
+    Multiset events;
+    auto start = Clock::now();
+    for (size_t i = 0; i < n; ++i) events.insert(rng() % distinct);
+    auto inserted = Clock::now();
+    for (size_t i = 0; i < n; ++i) checksum += events.count(rng() % distinct);
+    auto counted = Clock::now();
+    std::printf("%-10s %8d %12.1f %12.1f %14.2f\n", name, distinct,
+                NsPerOp(start, inserted, n), NsPerOp(inserted, counted, n),
+                static_cast<double>(allocated_bytes - before) / n);
+  }
+  allocated_bytes = before;
+  // Контрольная сумма не дает компилятору выбросить запросы
+  if (checksum == 0) std::printf("empty\n");
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  allocated_bytes += size;
+  if (void *ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char *argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::printf("%-10s %8s %12s %12s %14s\n", "multiset", "distinct",
+              "insert ns", "count ns", "bytes/elem");
+  for (int distinct : {100, 1000, 10000}) {
+    Measure<s21::multiset<unsigned>>("plain", n, distinct);
+    Measure<s21::counted_multiset<unsigned>>("counted", n, distinct);
+  }
+  return 0;
+}
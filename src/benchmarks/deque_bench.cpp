@@ -0,0 +1,84 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+
+#include "../include/s21_deque.h"
+#include "../include/s21_queue.h"
+#include "../include/s21_stack.h"
+
+// Сравнивает s21::deque с прежними основами адаптеров. stack: n push и
+// n pop на s21::vector и на deque. queue: n push и n pop на s21::list,
+// s21::ring_buffer и deque. Чтение: сумма n элементов через operator[]
+// у vector и deque. Время - в наносекундах на элемент. Верхняя граница
+// n задается первым аргументом (по умолчанию 1e7)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+template <typename Stack>
+double StackRun(size_t n, long long &checksum) {
+  Stack stack;
+  auto start = Clock::now();
+  for (size_t i = 0; i < n; ++i) stack.push(static_cast<long long>(i));
+  for (size_t i = 0; i < n; ++i) {
+    checksum += stack.top();
+    stack.pop();
+  }
+  return NsPerOp(start, Clock::now(), n);
+}
+
+template <typename Queue>
+double QueueRun(size_t n, long long &checksum) {
+  Queue queue;
+  auto start = Clock::now();
+  for (size_t i = 0; i < n; ++i) queue.push(static_cast<long long>(i));
+  for (size_t i = 0; i < n; ++i) {
+    checksum += queue.front();
+    queue.pop();
+  }
+  return NsPerOp(start, Clock::now(), n);
+}
+
+template <typename Container>
+double IndexRun(size_t n, long long &checksum) {
+  Container container;
+  for (size_t i = 0; i < n; ++i) {
+    container.push_back(static_cast<long long>(i));
+  }
+  auto start = Clock::now();
+  for (size_t i = 0; i < n; ++i) checksum += container[i];
+  return NsPerOp(start, Clock::now(), n);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  using Deque = s21::deque<long long>;
+  long long checksum = 0;
+
+  std::printf("%10s %9s %9s | %9s %9s %9s | %9s %9s\n", "n", "stk vec",
+              "stk deq", "q list", "q ring", "q deq", "[] vec", "[] deq");
+  for (size_t n = 1000; n <= max_n; n *= 10) {
+    double stack_vector = StackRun<s21::stack<long long>>(n, checksum);
+    double stack_deque =
+        StackRun<s21::stack<long long, Deque>>(n, checksum);
+    double queue_list =
+        QueueRun<s21::queue<long long, s21::list<long long>>>(n, checksum);
+    double queue_ring = QueueRun<s21::queue<long long>>(n, checksum);
+    double queue_deque =
+        QueueRun<s21::queue<long long, Deque>>(n, checksum);
+    double index_vector = IndexRun<s21::vector<long long>>(n, checksum);
+    double index_deque = IndexRun<Deque>(n, checksum);
+    std::printf("%10zu %9.2f %9.2f | %9.2f %9.2f %9.2f | %9.2f %9.2f\n", n,
+                stack_vector, stack_deque, queue_list, queue_ring,
+                queue_deque, index_vector, index_deque);
+  }
+  // Контрольная сумма не дает компилятору выбросить циклы
+  return checksum == 0 ? 1 : 0;
+}
@@ -0,0 +1,65 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../include/s21_set.h"
+
+// Сравнивает поиск в s21::set (BinaryTree::find) с поиском в его снимке
+// freeze(): случайные запросы, половина из них - отсутствующие ключи.
+// Время - в наносекундах на запрос. Верхняя граница числа ключей задается
+// первым аргументом (по умолчанию 1e7)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  const size_t kQueries = 2000000;
+  std::mt19937 rng(42);
+
+  std::printf("%10s %12s %12s %12s %8s\n", "n", "freeze ns", "set ns",
+              "frozen ns", "speedup");
+  bool ok = true;
+  for (size_t n = 1000; n <= max_n; n *= 10) {
+    // Четные ключи присутствуют, нечетные - нет
+    s21::vector<int> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) keys.push_back(static_cast<int>(2 * i));
+    s21::set<int> set(keys.begin(), keys.end());
+    s21::vector<int> queries;
+    queries.reserve(kQueries);
+    for (size_t i = 0; i < kQueries; ++i) {
+      queries.push_back(static_cast<int>(rng() % (2 * n)));
+    }
+
+    auto t0 = Clock::now();
+    s21::frozen_set<int> frozen = set.freeze();
+    auto t1 = Clock::now();
+    size_t found_set = 0;
+    for (size_t i = 0; i < kQueries; ++i) {
+      found_set += set.find(queries[i]) != set.end();
+    }
+    auto t2 = Clock::now();
+    size_t found_frozen = 0;
+    for (size_t i = 0; i < kQueries; ++i) {
+      found_frozen += frozen.find(queries[i]) != frozen.end();
+    }
+    auto t3 = Clock::now();
+
+    double set_ns = NsPerOp(t1, t2, kQueries);
+    double frozen_ns = NsPerOp(t2, t3, kQueries);
+    std::printf("%10zu %12.1f %12.1f %12.1f %7.1fx\n", n, NsPerOp(t0, t1, n),
+                set_ns, frozen_ns, set_ns / frozen_ns);
+    ok &= found_set == found_frozen && frozen.size() == n;
+  }
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,66 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <set>
+
+#include "../include/s21_multiset.h"
+
+// Слияние двух мультимножеств с повторами: прежний способ (вставка копии
+// каждого элемента other и очистка other), merge с перевешиванием узлов
+// и std::multiset::merge. Меньшее мультимножество имеет размер n / ratio:
+// при ratio = 1 оба дерева сливаются списками за O(n + m), при большом
+// ratio узлы вставляются по одному. Размер большего задается первым
+// аргументом (по умолчанию 5e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Ms(Clock::time_point start, Clock::time_point stop) {
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+template <typename Multiset>
+void Fill(Multiset &multiset, size_t n, unsigned seed) {
+  std::mt19937 rng(seed);
+  for (size_t i = 0; i < n; ++i) multiset.insert(rng() % (n / 4 + 1));
+}
+
+template <typename Multiset, typename Merge>
+double Run(size_t n, size_t m, Merge merge) {
+  Multiset into, other;
+  Fill(into, n, 1);
+  Fill(other, m, 2);
+  auto start = Clock::now();
+  merge(into, other);
+  double ms = Ms(start, Clock::now());
+  if (into.size() != n + m || !other.empty()) std::printf("wrong size\n");
+  return ms;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 5000000;
+  using Multiset = s21::multiset<unsigned>;
+  using StdMultiset = std::multiset<unsigned>;
+
+  std::printf("%10s %10s %12s %12s %12s\n", "n", "m", "insert ms",
+              "merge ms", "std ms");
+  for (size_t ratio : {1, 100, 10000}) {
+    size_t m = n / ratio;
+    double insert = Run<Multiset>(n, m, [](Multiset &into, Multiset &other) {
+      for (auto it = other.begin(); it != other.end(); ++it) into.insert(*it);
+      other.clear();
+    });
+    double merge = Run<Multiset>(
+        n, m, [](Multiset &into, Multiset &other) { into.merge(other); });
+    double std_merge = Run<StdMultiset>(
+        n, m,
+        [](StdMultiset &into, StdMultiset &other) { into.merge(other); });
+    std::printf("%10zu %10zu %12.1f %12.1f %12.1f\n", n, m, insert, merge,
+                std_merge);
+  }
+  return 0;
+}
@@ -0,0 +1,79 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <string>
+
+#include "../include/s21_set.h"
+
+// Измеряет память на элемент s21::set для раскладки узла с ключом и
+// значением (Node<Key, Key>, как раньше) и для узла только с ключом
+// (Node<Key, void>). Учитываются все байты, запрошенные у operator new:
+// блоки пула и буферы строк. Число элементов задается первым аргументом
+// (по умолчанию 1e6)
+
+namespace {
+
+size_t allocated_bytes = 0;
+
+struct Key64 {
+  char bytes[64];
+  bool operator<(const Key64 &other) const {
+    return std::memcmp(bytes, other.bytes, sizeof(bytes)) < 0;
+  }
+};
+
+int MakeKey(int i, int *) { return i; }
+
+Key64 MakeKey(int i, Key64 *) {
+  Key64 key{};
+  std::snprintf(key.bytes, sizeof(key.bytes), "%012d", i);
+  return key;
+}
+
+// Строки длиннее буфера SSO, чтобы у каждой был свой буфер в куче
+std::string MakeKey(int i, std::string *) {
+  return "key-with-heap-buffer-" + std::to_string(i);
+}
+
+template <typename Key, typename NodeType>
+void Measure(const char *name, int n) {
+  size_t before = allocated_bytes;
+  {
+    s21::set<Key, std::less<Key>, s21::NodePool<NodeType>> set;
+    for (int i = 0; i < n; ++i) set.insert(MakeKey(i, static_cast<Key *>(0)));
+    std::printf("%-12s %-16s %10zu %14.1f\n", name,
+                std::is_same<NodeType, s21::Node<Key, void>>::value
+                    ? "key only"
+                    : "key + value",
+                sizeof(NodeType),
+                static_cast<double>(allocated_bytes - before) / n);
+  }
+  allocated_bytes = before;
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  allocated_bytes += size;
+  if (void *ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char *argv[]) {
+  int n = argc > 1 ? std::atoi(argv[1]) : 1000000;
+
+  std::printf("%-12s %-16s %10s %14s\n", "key", "node", "sizeof", "bytes/elem");
+  Measure<int, s21::Node<int, int>>("int", n);
+  Measure<int, s21::Node<int, void>>("int", n);
+  Measure<Key64, s21::Node<Key64, Key64>>("64-byte", n);
+  Measure<Key64, s21::Node<Key64, void>>("64-byte", n);
+  Measure<std::string, s21::Node<std::string, std::string>>("std::string",
+                                                            n);
+  Measure<std::string, s21::Node<std::string, void>>("std::string", n);
+  return 0;
+}
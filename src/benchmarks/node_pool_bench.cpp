@@ -0,0 +1,59 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+
+#include "../include/s21_map.h"
+
+// Сравнивает пул узлов (по умолчанию) с выделением через new/delete:
+// построение map из n случайных ключей и ее очистка. Для int узлы
+// тривиально разрушаемы, и пул освобождает их целыми блоками.
+// Верхняя граница задается первым аргументом (по умолчанию 1e7)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename V>
+using HeapMap = s21::map<int, V, std::less<int>,
+                         s21::HeapNodeAllocator<s21::Node<int, V>>>;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+template <typename Map, typename V>
+void Run(const char *name, s21::vector<int> &keys, const V &value) {
+  size_t n = keys.size();
+  Map map;
+  auto t0 = Clock::now();
+  for (size_t i = 0; i < n; ++i) map.try_emplace(keys[i], value);
+  auto t1 = Clock::now();
+  map.clear();
+  auto t2 = Clock::now();
+  std::printf("%10zu %-18s %12.1f %12.1f\n", n, name, NsPerOp(t0, t1, n),
+              NsPerOp(t1, t2, n));
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  std::mt19937_64 rng(42);
+  const std::string text(32, 'x');
+
+  std::printf("%10s %-18s %12s %12s\n", "n", "allocator", "insert ns",
+              "clear ns");
+  for (size_t n = 1000; n <= max_n; n *= 10) {
+    s21::vector<int> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) keys.push_back(static_cast<int>(rng()));
+
+    Run<s21::map<int, int>>("pool<int>", keys, 0);
+    Run<HeapMap<int>>("new/delete<int>", keys, 0);
+    Run<s21::map<int, std::string>>("pool<string>", keys, text);
+    Run<HeapMap<std::string>>("new/delete<string>", keys, text);
+  }
+  return 0;
+}
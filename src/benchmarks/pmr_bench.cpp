@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory_resource>
+
+#include "../include/s21_pmr.h"
+
+// Контейнеры на время одного запроса: vector, list, map и queue по k
+// элементов создаются, заполняются и уничтожаются. Сравниваются
+// распределители по умолчанию (std::allocator и пул узлов) и s21::pmr
+// поверх monotonic_buffer_resource, который в конце запроса освобождает
+// всю память разом через release(). Время - в микросекундах на запрос.
+// Число запросов задается первым аргументом (по умолчанию 2e4)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double UsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::micro>(stop - start).count() / ops;
+}
+
+template <typename Vector, typename List, typename Map, typename Queue,
+          typename... Alloc>
+long Request(int k, const Alloc &...alloc) {
+  Vector vector(alloc...);
+  List list(alloc...);
+  Map map(alloc...);
+  Queue queue(alloc...);
+  for (int i = 0; i < k; ++i) {
+    vector.push_back(i);
+    list.push_back(i);
+    map.insert_or_assign(i * 7 % k, i);
+    queue.push(i);
+  }
+  long sum = 0;
+  for (int i = 0; i < k; ++i) sum += vector[i] + map.at(i);
+  return sum + list.back() + queue.front();
+}
+
+double Default(size_t requests, int k, long &checksum) {
+  auto start = Clock::now();
+  for (size_t r = 0; r < requests; ++r) {
+    checksum += Request<s21::vector<int>, s21::list<int>, s21::map<int, int>,
+                        s21::queue<int>>(k);
+  }
+  return UsPerOp(start, Clock::now(), requests);
+}
+
+double Monotonic(size_t requests, int k, long &checksum) {
+  static char buffer[1 << 20];
+  auto start = Clock::now();
+  for (size_t r = 0; r < requests; ++r) {
+    std::pmr::monotonic_buffer_resource arena(buffer, sizeof(buffer));
+    checksum += Request<s21::pmr::vector<int>, s21::pmr::list<int>,
+                        s21::pmr::map<int, int>, s21::pmr::queue<int>>(
+        k, &arena);
+  }
+  return UsPerOp(start, Clock::now(), requests);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t requests = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+  long checksum = 0;
+  std::printf("%8s %14s %14s\n", "k", "default us", "monotonic us");
+  for (int k : {16, 128, 1024}) {
+    size_t n = requests * 16 / k;
+    double plain = Default(n, k, checksum);
+    double arena = Monotonic(n, k, checksum);
+    std::printf("%8d %14.2f %14.2f\n", k, plain, arena);
+  }
+  // Контрольная сумма не дает компилятору выбросить запросы
+  if (checksum == 0) std::printf("empty\n");
+  return 0;
+}
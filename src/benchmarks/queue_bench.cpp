@@ -0,0 +1,54 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <queue>
+
+#include "../include/s21_queue.h"
+
+// Пропускная способность очереди на s21::list, на s21::ring_buffer и
+// std::queue (на std::deque) в цикле раздачи задач: в очереди держится
+// depth элементов, и каждый шаг добавляет один элемент и забирает один.
+// Время - в наносекундах на пару push + pop. Верхняя граница глубины
+// задается первым аргументом (по умолчанию 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t kSteps = 10000000;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+template <typename Queue>
+double Run(size_t depth, long long &checksum) {
+  Queue queue;
+  for (size_t i = 0; i < depth; ++i) queue.push(static_cast<long long>(i));
+  auto start = Clock::now();
+  for (size_t i = 0; i < kSteps; ++i) {
+    queue.push(static_cast<long long>(i));
+    checksum += queue.front();
+    queue.pop();
+  }
+  auto stop = Clock::now();
+  return NsPerOp(start, stop, kSteps);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t max_depth = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  long long checksum = 0;
+  std::printf("%10s %12s %12s %12s\n", "depth", "list ns", "ring ns",
+              "std ns");
+  for (size_t depth = 1; depth <= max_depth; depth *= 100) {
+    double list = Run<s21::queue<long long, s21::list<long long>>>(depth,
+                                                                  checksum);
+    double ring = Run<s21::queue<long long>>(depth, checksum);
+    double std_queue = Run<std::queue<long long>>(depth, checksum);
+    std::printf("%10zu %12.2f %12.2f %12.2f\n", depth, list, ring, std_queue);
+  }
+  // Контрольная сумма не дает компилятору выбросить цикл
+  return checksum == 0 ? 1 : 0;
+}
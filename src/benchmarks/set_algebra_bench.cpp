@@ -0,0 +1,67 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../include/s21_map.h"
+
+// Сравнивает объединение map поэлементной вставкой с set_union/merge на
+// split/join, а также пересечение и разность. Меньшая map имеет размер
+// n / ratio, поэтому видно, как время зависит от m log(n/m + 1).
+// Размер большей map задается первым аргументом (по умолчанию 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+using Map = s21::map<int, int>;
+
+double Ms(Clock::time_point start, Clock::time_point stop) {
+  return std::chrono::duration<double, std::milli>(stop - start).count();
+}
+
+void Fill(Map &map, size_t n, std::mt19937_64 &rng) {
+  while (map.size() < n) map.try_emplace(static_cast<int>(rng() >> 33), 0);
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(42);
+  Map big;
+  Fill(big, n, rng);
+
+  std::printf("%10s %10s %12s %12s %12s %12s %12s\n", "n", "m",
+              "insert ms", "union ms", "merge ms", "intersect ms",
+              "diff ms");
+  for (size_t ratio : {1, 10, 100, 1000}) {
+    Map small;
+    Fill(small, n / ratio, rng);
+
+    Map naive(big), joined(big), merged(big), intersected(big),
+        diffed(big);
+    Map from_union(small), from_merge(small);
+
+    auto t0 = Clock::now();
+    for (auto it = small.begin(); it != small.end(); ++it) {
+      naive.try_emplace(it.first(), it.second());
+    }
+    auto t1 = Clock::now();
+    joined.set_union(from_union);
+    auto t2 = Clock::now();
+    merged.merge(from_merge);
+    auto t3 = Clock::now();
+    intersected.set_intersection(small);
+    auto t4 = Clock::now();
+    diffed.set_difference(small);
+    auto t5 = Clock::now();
+
+    std::printf("%10zu %10zu %12.2f %12.2f %12.2f %12.2f %12.2f\n", n,
+                small.size(), Ms(t0, t1), Ms(t1, t2), Ms(t2, t3), Ms(t3, t4),
+                Ms(t4, t5));
+    if (naive.size() != joined.size() || joined.size() != merged.size()) {
+      return 1;
+    }
+  }
+  return 0;
+}
@@ -0,0 +1,70 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <new>
+#include <random>
+#include <vector>
+
+#include "../include/s21_small_vector.h"
+#include "../include/s21_vector.h"
+
+// Короткие последовательности: для каждой из n записей создается массив
+// из случайного числа элементов (не больше max_len), заполняется через
+// push_back и читается. Для s21::vector, std::vector и
+// s21::small_vector<int, 8> измеряются время в наносекундах на запись и
+// число вызовов operator new на запись. Число записей задается первым
+// аргументом (по умолчанию 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+size_t allocations = 0;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+template <typename Vector>
+void Measure(const char *name, size_t n, unsigned max_len) {
+  std::mt19937 rng(23);
+  size_t before = allocations;
+  long checksum = 0;
+  auto start = Clock::now();
+  for (size_t record = 0; record < n; ++record) {
+    Vector fields;
+    unsigned len = rng() % (max_len + 1);
+    for (unsigned i = 0; i < len; ++i) fields.push_back(static_cast<int>(i));
+    for (int field : fields) checksum += field;
+  }
+  auto stop = Clock::now();
+  std::printf("%-14s %8u %12.1f %14.2f\n", name, max_len,
+              NsPerOp(start, stop, n),
+              static_cast<double>(allocations - before) / n);
+  // Контрольная сумма не дает компилятору выбросить записи
+  if (checksum == 0) std::printf("empty\n");
+}
+
+}  // namespace
+
+void *operator new(size_t size) {
+  ++allocations;
+  if (void *ptr = std::malloc(size)) return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, size_t) noexcept { std::free(ptr); }
+
+int main(int argc, char *argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::printf("%-14s %8s %12s %14s\n", "vector", "max len", "ns/record",
+              "allocs/record");
+  for (unsigned max_len : {4, 8, 16}) {
+    Measure<s21::vector<int>>("s21::vector", n, max_len);
+    Measure<std::vector<int>>("std::vector", n, max_len);
+    Measure<s21::small_vector<int, 8>>("small_vector", n, max_len);
+  }
+  return 0;
+}
@@ -0,0 +1,51 @@
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+#include "../include/s21_map.h"
+
+// Замеряет стоимость одной операции map в зависимости от числа ключей.
+// При логарифмической сложности столбец ns/log2(n) остается почти
+// постоянным. Верхняя граница задается первым аргументом (по умолчанию 1e7)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 10000000;
+  std::mt19937_64 rng(42);
+
+  std::printf("%10s %12s %12s %12s %14s\n", "n", "insert ns", "find ns",
+              "erase ns", "insert/log2n");
+  for (size_t n = 1000; n <= max_n; n *= 10) {
+    s21::vector<int> keys;
+    keys.reserve(n);
+    for (size_t i = 0; i < n; ++i) keys.push_back(static_cast<int>(rng()));
+
+    s21::map<int, int> map;
+    auto t0 = Clock::now();
+    for (size_t i = 0; i < n; ++i) map.insert(std::make_pair(keys[i], 0));
+    auto t1 = Clock::now();
+    size_t found = 0;
+    for (size_t i = 0; i < n; ++i) found += map.contains(keys[i]);
+    auto t2 = Clock::now();
+    for (size_t i = 0; i < n; ++i) map.erase(keys[i]);
+    auto t3 = Clock::now();
+
+    double insert_ns = NsPerOp(t0, t1, n);
+    std::printf("%10zu %12.1f %12.1f %12.1f %14.2f\n", n, insert_ns,
+                NsPerOp(t1, t2, n), NsPerOp(t2, t3, n),
+                insert_ns / std::log2(static_cast<double>(n)));
+    if (found != n || !map.empty()) return 1;
+  }
+  return 0;
+}
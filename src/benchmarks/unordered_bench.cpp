@@ -0,0 +1,77 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <unordered_map>
+
+#include "../include/s21_map.h"
+#include "../include/s21_unordered_map.h"
+
+// Сравнивает s21::map, std::unordered_map и s21::unordered_map на
+// 8-байтовых ключах: вставка, поиск имеющихся ключей и поиск
+// отсутствующих. Время - в наносекундах на операцию. Верхняя граница
+// числа ключей задается первым аргументом (по умолчанию 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+// Возвращает false, если результаты поиска не сошлись с ожидаемыми
+template <typename Container>
+bool Run(const char *name, const s21::vector<uint64_t> &keys,
+         const s21::vector<uint64_t> &misses) {
+  size_t n = keys.size();
+  Container container;
+  auto t0 = Clock::now();
+  for (size_t i = 0; i < n; ++i) container.insert({keys[i], keys[i]});
+  auto t1 = Clock::now();
+  size_t hits = 0;
+  for (size_t i = 0; i < n; ++i) {
+    hits += container.find(keys[i]) != container.end();
+  }
+  auto t2 = Clock::now();
+  size_t false_hits = 0;
+  for (size_t i = 0; i < n; ++i) {
+    false_hits += container.find(misses[i]) != container.end();
+  }
+  auto t3 = Clock::now();
+
+  std::printf("%10zu %-14s %12.1f %12.1f %12.1f\n", n, name,
+              NsPerOp(t0, t1, n), NsPerOp(t1, t2, n), NsPerOp(t2, t3, n));
+  return hits == n && false_hits == 0 && container.size() == n;
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t max_n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::mt19937_64 rng(42);
+
+  std::printf("%10s %-14s %12s %12s %12s\n", "n", "container", "insert ns",
+              "hit ns", "miss ns");
+  bool ok = true;
+  for (size_t n = 1000; n <= max_n; n *= 10) {
+    // Имеющиеся ключи четны, отсутствующие нечетны
+    s21::vector<uint64_t> keys;
+    s21::vector<uint64_t> misses;
+    keys.reserve(n);
+    misses.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+      uint64_t key = (rng() << 32) | (2 * i);
+      keys.push_back(key);
+      misses.push_back(key | 1);
+    }
+
+    ok &= Run<s21::map<uint64_t, uint64_t>>("map", keys, misses);
+    ok &= Run<std::unordered_map<uint64_t, uint64_t>>("std::unordered", keys,
+                                                      misses);
+    ok &= Run<s21::unordered_map<uint64_t, uint64_t>>("unordered_map", keys,
+                                                      misses);
+  }
+  return ok ? 0 : 1;
+}
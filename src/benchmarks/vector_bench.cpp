@@ -0,0 +1,88 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../include/s21_vector.h"
+
+// Стоимость push_back с ростом буфера, reserve на пустом векторе и цикла
+// "заполнить - clear - заполнить снова" у s21::vector и std::vector для
+// int, std::string (длиннее буфера SSO) и 256-байтной структуры. Время -
+// в наносекундах на элемент. Число элементов задается первым аргументом
+// (по умолчанию 1e6)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Block256 {
+  char bytes[256];
+};
+
+double NsPerOp(Clock::time_point start, Clock::time_point stop, size_t ops) {
+  return std::chrono::duration<double, std::nano>(stop - start).count() / ops;
+}
+
+int MakeItem(size_t i, int *) { return static_cast<int>(i); }
+
+std::string MakeItem(size_t i, std::string *) {
+  return "string-with-heap-buffer-" + std::to_string(i);
+}
+
+Block256 MakeItem(size_t i, Block256 *) {
+  Block256 block{};
+  block.bytes[0] = static_cast<char>(i);
+  return block;
+}
+
+template <typename Vector>
+double PushBack(size_t n, const typename Vector::value_type &item) {
+  auto start = Clock::now();
+  Vector vector;
+  for (size_t i = 0; i < n; ++i) vector.push_back(item);
+  return NsPerOp(start, Clock::now(), n);
+}
+
+template <typename Vector>
+double Reserve(size_t n) {
+  auto start = Clock::now();
+  Vector vector;
+  vector.reserve(n);
+  return NsPerOp(start, Clock::now(), n);
+}
+
+template <typename Vector>
+double ClearAndRefill(size_t n, const typename Vector::value_type &item) {
+  Vector vector;
+  for (size_t i = 0; i < n; ++i) vector.push_back(item);
+  auto start = Clock::now();
+  for (int round = 0; round < 4; ++round) {
+    vector.clear();
+    for (size_t i = 0; i < n; ++i) vector.push_back(item);
+  }
+  return NsPerOp(start, Clock::now(), 4 * n);
+}
+
+template <typename T>
+void Measure(const char *name, size_t n) {
+  T item = MakeItem(n, static_cast<T *>(nullptr));
+  std::printf("%-10s %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n", name,
+              PushBack<s21::vector<T>>(n, item),
+              PushBack<std::vector<T>>(n, item), Reserve<s21::vector<T>>(n),
+              Reserve<std::vector<T>>(n),
+              ClearAndRefill<s21::vector<T>>(n, item),
+              ClearAndRefill<std::vector<T>>(n, item));
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1000000;
+  std::printf("%-10s %10s %10s %10s %10s %10s %10s\n", "type", "push s21",
+              "push std", "rsrv s21", "rsrv std", "clear s21", "clear std");
+  Measure<int>("int", n);
+  Measure<std::string>("string", n);
+  Measure<Block256>("256 bytes", n);
+  return 0;
+}
@@ -0,0 +1,60 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+
+#include "../include/s21_vector.h"
+
+// Рост и вставка в середину больших векторов uint64_t у s21::vector и
+// std::vector. Рост: push_back без reserve до заданного объема, время в
+// наносекундах на элемент. Вставка: 16 вставок в середину заполненного
+// вектора (каждая сдвигает половину буфера), время в миллисекундах на
+// вставку и скорость сдвига в ГБ/с. Объемы - от 1 МБ до предела в
+// мегабайтах из первого аргумента (по умолчанию 1024, до 8192 при
+// достаточной памяти)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kInserts = 16;
+
+double Seconds(Clock::time_point start, Clock::time_point stop) {
+  return std::chrono::duration<double>(stop - start).count();
+}
+
+template <typename Vector>
+void Measure(const char *name, size_t megabytes) {
+  size_t n = (megabytes << 20) / sizeof(uint64_t);
+  auto start = Clock::now();
+  Vector vector;
+  for (size_t i = 0; i < n; ++i) vector.push_back(i);
+  double grow = Seconds(start, Clock::now()) * 1e9 / n;
+
+  // Запас под вставки, чтобы измерялся только сдвиг
+  vector.reserve(n + kInserts);
+  start = Clock::now();
+  for (int i = 0; i < kInserts; ++i) {
+    vector.insert(vector.begin() + vector.size() / 2, uint64_t(i));
+  }
+  double insert = Seconds(start, Clock::now()) / kInserts;
+  double shifted = (n / 2) * sizeof(uint64_t) / 1e9;
+  std::printf("%-12s %8zu %12.2f %12.3f %10.2f\n", name, megabytes, grow,
+              insert * 1e3, shifted / insert);
+  // Обращение к элементу не дает компилятору выбросить вектор
+  if (vector[n / 3] == 1) std::printf("unexpected\n");
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t limit = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 1024;
+  std::printf("%-12s %8s %12s %12s %10s\n", "vector", "MB", "grow ns/el",
+              "insert ms", "GB/s");
+  for (size_t megabytes = 1; megabytes <= limit; megabytes *= 8) {
+    Measure<s21::vector<uint64_t>>("s21::vector", megabytes);
+    Measure<std::vector<uint64_t>>("std::vector", megabytes);
+  }
+  return 0;
+}
@@ -0,0 +1,112 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "../include/s21_vector.h"
+
+// Диапазонные операции s21::vector против поэлементных циклов: удаление
+// каждого второго элемента (erase в цикле и erase_if), удаление блока
+// из середины (erase в цикле и erase(first, last)), вставка пачки в
+// середину (insert в цикле и insert(pos, first, last)) и замена
+// содержимого (clear + push_back и assign). Элементы - int и
+// std::string длиннее буфера SSO; время в микросекундах на операцию над
+// всем вектором. Число элементов задается первым аргументом (по
+// умолчанию 20000)
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double Us(Clock::time_point start, Clock::time_point stop) {
+  return std::chrono::duration<double, std::micro>(stop - start).count();
+}
+
+int MakeItem(size_t i, int *) { return static_cast<int>(i); }
+
+std::string MakeItem(size_t i, std::string *) {
+  return "string-with-heap-buffer-" + std::to_string(i);
+}
+
+template <typename T>
+s21::vector<T> Filled(size_t n) {
+  s21::vector<T> vector;
+  vector.reserve(n);
+  for (size_t i = 0; i < n; ++i) {
+    vector.push_back(MakeItem(i, static_cast<T *>(nullptr)));
+  }
+  return vector;
+}
+
+void Report(const char *type, const char *operation, double loop,
+            double range) {
+  std::printf("%-12s %-16s %12.1f %12.1f %8.1fx\n", type, operation, loop,
+              range, loop / range);
+}
+
+template <typename T>
+void Measure(const char *type, size_t n) {
+  // Удаление каждого второго элемента
+  s21::vector<T> a = Filled<T>(n);
+  auto start = Clock::now();
+  for (auto it = a.begin(); it != a.end(); ++it) a.erase(it);
+  double loop = Us(start, Clock::now());
+  s21::vector<T> b = Filled<T>(n);
+  size_t index = 0;
+  start = Clock::now();
+  s21::erase_if(b, [&](const T &) { return index++ % 2 == 0; });
+  Report(type, "erase odd", loop, Us(start, Clock::now()));
+
+  // Удаление середины: половина элементов одним блоком
+  a = Filled<T>(n);
+  start = Clock::now();
+  for (size_t i = 0; i < n / 2; ++i) a.erase(a.begin() + n / 4);
+  loop = Us(start, Clock::now());
+  b = Filled<T>(n);
+  start = Clock::now();
+  b.erase(b.begin() + n / 4, b.begin() + n / 4 + n / 2);
+  Report(type, "erase block", loop, Us(start, Clock::now()));
+
+  // Вставка пачки из n / 2 элементов в середину
+  std::vector<T> batch;
+  for (size_t i = 0; i < n / 2; ++i) {
+    batch.push_back(MakeItem(i, static_cast<T *>(nullptr)));
+  }
+  a = Filled<T>(n);
+  start = Clock::now();
+  auto pos = a.begin() + n / 2;
+  for (const T &item : batch) pos = a.insert(pos, item) + 1;
+  loop = Us(start, Clock::now());
+  b = Filled<T>(n);
+  start = Clock::now();
+  b.insert(b.begin() + n / 2, batch.begin(), batch.end());
+  Report(type, "insert batch", loop, Us(start, Clock::now()));
+
+  // Замена содержимого пачкой большего размера
+  batch.insert(batch.end(), batch.begin(), batch.end());
+  batch.insert(batch.end(), batch.begin(), batch.end());
+  a = Filled<T>(n / 2);
+  start = Clock::now();
+  a.clear();
+  for (const T &item : batch) a.push_back(item);
+  loop = Us(start, Clock::now());
+  b = Filled<T>(n / 2);
+  start = Clock::now();
+  b.assign(batch.begin(), batch.end());
+  Report(type, "assign", loop, Us(start, Clock::now()));
+
+  // Обращение к элементам не дает компилятору выбросить векторы
+  if (a.size() != b.size() || !(a[0] == b[0])) std::printf("mismatch\n");
+}
+
+}  // namespace
+
+int main(int argc, char *argv[]) {
+  size_t n = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 20000;
+  std::printf("%-12s %-16s %12s %12s %9s\n", "type", "operation", "loop us",
+              "range us", "speedup");
+  Measure<int>("int", n);
+  Measure<std::string>("std::string", n);
+  return 0;
+}
@@ -2,51 +2,98 @@
 
 namespace s21 {
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::Balance(
-    Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Balance(
+    node_type *node) {
   if (node == nullptr) return node;
-  node->left = Balance(node->left);
-  node->right = Balance(node->right);
+  UpdateNode(node);
   int bf = BalanceFactor(node);
   if (bf < -1) {
-    if (BalanceFactor(node->right) <= 0) {
-      return LeftRotate(node);
-    } else {
+    if (BalanceFactor(node->right) > 0) {
       node->right = RightRotate(node->right);
-      return LeftRotate(node);
     }
+    return LeftRotate(node);
   } else if (bf > 1) {
-    if (BalanceFactor(node->left) >= 0) {
-      return RightRotate(node);
-    } else {
+    if (BalanceFactor(node->left) < 0) {
       node->left = LeftRotate(node->left);
-      return RightRotate(node);
     }
+    return RightRotate(node);
   }
   return node;
 }
 
-template <typename key_type, typename value_type>
-BinaryTree<key_type, value_type>::BinaryTree() : root_(nullptr) {}
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename Item>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::AssignSorted(
+    vector<Item> &items, bool unique) {
+  clear();
+  size_type n = items.size();
+  if (n == 0) return;
+  auto key_less = [this](const Item &a, const Item &b) {
+    return comp_(ItemKey(a), ItemKey(b));
+  };
+  bool sorted = true;
+  for (size_type i = 1; i < n && sorted; ++i) {
+    sorted = !comp_(ItemKey(items[i]), ItemKey(items[i - 1]));
+  }
+  if (!sorted) std::stable_sort(items.begin(), items.end(), key_less);
+  if (unique) {
+    size_type last = 0;
+    for (size_type i = 1; i < n; ++i) {
+      if (comp_(ItemKey(items[last]), ItemKey(items[i]))) {
+        if (++last != i) items[last] = std::move(items[i]);
+      }
+    }
+    n = last + 1;
+  }
+  root_ = BuildBalanced(items, 0, n);
+  root_->parent = nullptr;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BinaryTree()
+    : root_(nullptr) {}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BinaryTree(
+    const Compare &comp)
+    : root_(nullptr), comp_(comp) {}
 
-template <typename key_type, typename value_type>
-BinaryTree<key_type, value_type>::BinaryTree(
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BinaryTree(
+    const NodeAllocator &alloc)
+    : root_(nullptr), alloc_(alloc) {}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BinaryTree(
     std::initializer_list<std::pair<key_type, value_type>> const &items) {
   root_ = nullptr;
-  for (const auto &item : items) insert(item);
+  vector<std::pair<key_type, value_type>> sorted(items);
+  AssignSorted(sorted, true);
 }
 
-template <typename key_type, typename value_type>
-BinaryTree<key_type, value_type>::BinaryTree(const key_type &key,
-                                             const value_type &value) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BinaryTree(
+    const key_type &key, const value_type &value) {
   root_ = nullptr;
   bool inserted;
-  root_ = insert(root_, key, value, inserted);
+  node_type *result;
+  root_ = Emplace(root_, key, result, inserted, value);
 }
 
-template <typename key_type, typename value_type>
-BinaryTree<key_type, value_type>::BinaryTree(const BinaryTree &other) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BinaryTree(
+    const BinaryTree &other)
+    : alloc_(other.alloc_.select_on_copy()), comp_(other.comp_) {
   if (other.root_) {
     root_ = copy(other.root_);
   } else {
@@ -54,194 +101,451 @@ BinaryTree<key_type, value_type>::BinaryTree(const BinaryTree &other) {
   }
 }
 
-template <typename key_type, typename value_type>
-BinaryTree<key_type, value_type>::BinaryTree(BinaryTree &&other) noexcept {
-  if (&other != this) {
-    root_ = other.root_;
-    other.root_ = nullptr;
-  }
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BinaryTree(
+    BinaryTree &&other) noexcept
+    : root_(other.root_),
+      alloc_(std::move(other.alloc_)),
+      comp_(std::move(other.comp_)) {
+  other.root_ = nullptr;
 }
 
-template <typename key_type, typename value_type>
-BinaryTree<key_type, value_type>::~BinaryTree() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::~BinaryTree() {
   clear();
 }
 
-template <typename key_type, typename value_type>
-BinaryTree<key_type, value_type> &BinaryTree<key_type, value_type>::operator=(
-    BinaryTree &&other) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+BinaryTree<key_type, value_type, Compare, NodeAllocator> &
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::operator=(
+    BinaryTree &&other) noexcept(NodeAllocator::kMoveAssignNodes) {
   if (&other != this) {
-    clear(root_);
-    root_ = other.root_;
-    other.root_ = nullptr;
+    clear();
+    if (alloc_.move_assign(other.alloc_)) {
+      root_ = other.root_;
+      other.root_ = nullptr;
+    } else {
+      // Узлы other выделены чужим распределителем и освобождаются им же
+      root_ = MoveElements(other.root_);
+      other.clear();
+    }
+    std::swap(comp_, other.comp_);
   }
   return *this;
 }
 
-template <typename key_type, typename value_type>
-std::pair<typename BinaryTree<key_type, value_type>::iterator, bool>
-BinaryTree<key_type, value_type>::insert(const value_type &value) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+std::pair<
+    typename BinaryTree<key_type, value_type, Compare,
+                        NodeAllocator>::iterator, bool>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::insert(
+    const value_type &value) {
   bool inserted = false;
-  root_ = insert(root_, value, value, inserted);
-  return {find(value), inserted};
+  node_type *result = nullptr;
+  root_ = Emplace(root_, value, result, inserted, value);
+  return {iterator(result, this), inserted};
 }
 
-template <typename key_type, typename value_type>
-std::pair<typename BinaryTree<key_type, value_type>::iterator, bool>
-BinaryTree<key_type, value_type>::insert(
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+std::pair<
+    typename BinaryTree<key_type, value_type, Compare,
+                        NodeAllocator>::iterator, bool>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::insert(
     const std::pair<key_type, value_type> &value) {
   bool inserted = false;
-  root_ = insert(root_, value.first, value.second, inserted);
-  return {find(value.first), inserted};
+  node_type *result = nullptr;
+  root_ = Emplace(root_, value.first, result, inserted, value.second);
+  return {iterator(result, this), inserted};
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::iterator
-BinaryTree<key_type, value_type>::find(const key_type &key) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::find(
+    const key_type &key) {
   return find(root_, key);
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::iterator
-BinaryTree<key_type, value_type>::find(Node<key_type, value_type> *node,
-                                       const key_type &key) {
-  if (node == nullptr) return Iterator(nullptr);
-  if (key < node->key) {
-    return find(node->left, key);
-  } else if (key > node->key) {
-    return find(node->right, key);
-  } else {
-    return iterator(node);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::find(
+    node_type *node, const key_type &key) {
+  node_type *candidate = nullptr;
+  while (node != nullptr) {
+    if (comp_(node->key, key)) {
+      node = node->right;
+    } else {
+      candidate = node;
+      node = node->left;
+    }
   }
+  if (candidate == nullptr || comp_(key, candidate->key)) return end();
+  return iterator(candidate, this);
 }
 
-template <typename key_type, typename value_type>
-bool BinaryTree<key_type, value_type>::contains(const key_type &key) {
-  iterator iter = find(key);
-  return iter != iterator(nullptr);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K, typename C, typename>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::find(const K &key) {
+  node_type *node = FindNode(key);
+  return node == nullptr ? end() : iterator(node, this);
 }
 
-template <typename key_type, typename value_type>
-bool BinaryTree<key_type, value_type>::empty() const {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool BinaryTree<key_type, value_type, Compare, NodeAllocator>::contains(
+    const key_type &key) {
+  return FindNode(key) != nullptr;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K, typename C, typename>
+bool BinaryTree<key_type, value_type, Compare, NodeAllocator>::contains(
+    const K &key) {
+  return FindNode(key) != nullptr;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::key_compare
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::key_comp() const {
+  return comp_;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool BinaryTree<key_type, value_type, Compare, NodeAllocator>::empty() const {
   return root_ == nullptr;
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::size_type
-BinaryTree<key_type, value_type>::size() const {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::size() const {
   return size(root_);
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::size_type
-BinaryTree<key_type, value_type>::max_size() const {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::max_size() const {
   return std::numeric_limits<size_type>::max();
 }
 
-template <typename key_type, typename value_type>
-void BinaryTree<key_type, value_type>::erase(iterator pos) {
-  if (pos != end()) root_ = remove(root_, pos.iter_node->key);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::erase(
+    iterator pos) {
+  if (pos != end()) EraseNode(pos.iter_node);
 }
 
-template <typename key_type, typename value_type>
-bool BinaryTree<key_type, value_type>::erase(const key_type &key) {
-  if (contains(key)) {
-    root_ = remove(root_, key);
-    return true;
-  }
-  return false;
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool BinaryTree<key_type, value_type, Compare, NodeAllocator>::erase(
+    const key_type &key) {
+  node_type *node = FindNode(key);
+  if (node == nullptr) return false;
+  EraseNode(node);
+  return true;
 }
 
-template <typename key_type, typename value_type>
-void BinaryTree<key_type, value_type>::swap(BinaryTree &other) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::swap(
+    BinaryTree &other) {
   std::swap(root_, other.root_);
+  alloc_.swap(other.alloc_);
+  std::swap(comp_, other.comp_);
 }
 
-template <typename key_type, typename value_type>
-void BinaryTree<key_type, value_type>::merge(BinaryTree &other) {
-  merge(this->root_, other.root_, other);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::merge(
+    BinaryTree &other) {
+  if (this == &other || other.root_ == nullptr) return;
+  node_type *duplicates = nullptr;
+  alloc_.adopt(other.alloc_);
+  root_ = Union(root_, other.root_, duplicates);
+  root_->parent = nullptr;
+  other.root_ = nullptr;
+  if (duplicates == nullptr) return;
+  duplicates->parent = nullptr;
+  if (NodeAllocator::kBulkRelease) {
+    // Память узлов теперь принадлежит этому пулу, поэтому оставшиеся в
+    // other элементы пересоздаются в его собственном пуле
+    other.root_ = other.copy(duplicates);
+    clear(duplicates);
+  } else {
+    other.root_ = duplicates;
+  }
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::MergeEquivalent(
+    BinaryTree &other) {
+  if (this == &other || other.root_ == nullptr) return;
+  alloc_.adopt(other.alloc_);
+  size_type n = size(root_);
+  size_type m = size(other.root_);
+  size_type depth = 1;
+  while ((size_type(1) << depth) <= n + m) ++depth;
+  // Узлы собираются в массивы указателей: чтения из массива независимы,
+  // а обход связного списка ждет каждого промаха кеша
+  vector<node_type *> incoming(m);
+  node_type **out = incoming.data();
+  Flatten(other.root_, out);
+  other.root_ = nullptr;
+  if (m * depth < n + m) {
+    // Вставка по одному: O(m log n) меньше полной пересборки
+    for (size_type j = 0; j < m; ++j) {
+      incoming[j]->left = incoming[j]->right = nullptr;
+      root_ = InsertNode(root_, incoming[j]);
+    }
+  } else {
+    // Свои узлы лежат в хвосте массива, и слияние с начала не
+    // затирает еще не прочитанные: запись идет в k = i - m + j <= i
+    vector<node_type *> nodes(n + m);
+    out = nodes.data() + m;
+    Flatten(root_, out);
+    size_type i = m, j = 0, k = 0;
+    while (i < n + m && j < m) {
+      if (comp_(incoming[j]->key, nodes[i]->key)) {
+        nodes[k++] = incoming[j++];
+      } else {
+        nodes[k++] = nodes[i++];
+      }
+    }
+    while (j < m) nodes[k++] = incoming[j++];
+    root_ = FromArray(nodes.data(), 0, n + m);
+  }
+  root_->parent = nullptr;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::CopyFrom(
+    const BinaryTree &other) {
+  if (this == &other) return;
+  clear();
+  comp_ = other.comp_;
+  root_ = copy(other.root_);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::set_union(
+    BinaryTree &other) {
+  if (this == &other || other.root_ == nullptr) return;
+  node_type *duplicates = nullptr;
+  alloc_.adopt(other.alloc_);
+  root_ = Union(root_, other.root_, duplicates);
+  root_->parent = nullptr;
+  other.root_ = nullptr;
+  clear(duplicates);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::set_intersection(
+    const BinaryTree &other) {
+  if (this == &other) return;
+  root_ = Intersection(root_, other.root_);
+  if (root_ != nullptr) root_->parent = nullptr;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::set_difference(
+    const BinaryTree &other) {
+  if (this == &other) {
+    clear();
+    return;
+  }
+  root_ = Difference(root_, other.root_);
+  if (root_ != nullptr) root_->parent = nullptr;
 }
 
-template <typename key_type, typename value_type>
-void BinaryTree<key_type, value_type>::clear() {
-  clear(root_);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::clear() {
+  if (!NodeAllocator::kBulkRelease ||
+      !std::is_trivially_destructible<node_type>::value) {
+    clear(root_);
+  }
+  alloc_.release();
   root_ = nullptr;
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::iterator
-BinaryTree<key_type, value_type>::begin() {
-  Node<key_type, value_type> *minNode = GetMin(root_);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::begin() {
+  node_type *minNode = GetMin(root_);
   if (minNode == nullptr) {
     return this->end();
   }
-  return iterator(minNode);
+  return iterator(minNode, this);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::end() {
+  return iterator(nullptr, this);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare,
+                    NodeAllocator>::reverse_iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::rbegin() {
+  return reverse_iterator(iterator(GetMax(root_), this));
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::iterator
-BinaryTree<key_type, value_type>::end() {
-  return iterator(nullptr);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare,
+                    NodeAllocator>::reverse_iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::rend() {
+  return reverse_iterator(end());
 }
 
-template <typename key_type, typename value_type>
-int BinaryTree<key_type, value_type>::Height() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+int BinaryTree<key_type, value_type, Compare, NodeAllocator>::Height() {
   return Height(root_);
 }
 
-template <typename key_type, typename value_type>
-int BinaryTree<key_type, value_type>::BalanceFactor() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+int BinaryTree<key_type, value_type, Compare, NodeAllocator>::BalanceFactor() {
   return BalanceFactor(root_);
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::RightRotate() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::RightRotate() {
   return RightRotate(root_);
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::LeftRotate() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::LeftRotate() {
   return LeftRotate(root_);
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::Balance() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Balance() {
   return Balance(root_);
 }
 
-template <typename key_type, typename value_type>
-bool BinaryTree<key_type, value_type>::IsBalanced() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool BinaryTree<key_type, value_type, Compare, NodeAllocator>::IsBalanced() {
+  if (root_ != nullptr && root_->parent != nullptr) return false;
   return IsBalanced(root_);
 }
 
-template <typename key_type, typename value_type>
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
 template <class... Args>
-vector<std::pair<typename BinaryTree<key_type, value_type>::iterator, bool>>
-BinaryTree<key_type, value_type>::insert_many(Args &&...args) {
-  vector<std::pair<typename BinaryTree<key_type, value_type>::iterator, bool>>
-      res;
+vector<
+    std::pair<typename BinaryTree<key_type, value_type, Compare,
+                                  NodeAllocator>::iterator, bool>>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::insert_many(
+    Args &&...args) {
+  vector<std::pair<iterator, bool>> res;
   (..., res.push_back(insert(std::forward<Args>(args))));
 
   return res;
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::iterator
-BinaryTree<key_type, value_type>::iterator::operator++(int) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::nth(size_type k) {
+  node_type *node = root_;
+  while (node != nullptr) {
+    size_type left_size = size(node->left);
+    if (k < left_size) {
+      node = node->left;
+    } else if (k > left_size) {
+      k -= left_size + 1;
+      node = node->right;
+    } else {
+      return iterator(node, this);
+    }
+  }
+  return end();
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::rank(
+    const key_type &key) const {
+  return LowerRank(key);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K, typename C, typename>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::rank(
+    const K &key) const {
+  return LowerRank(key);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::count_range(
+    const key_type &lo, const key_type &hi) const {
+  if (!comp_(lo, hi)) return 0;
+  return rank(hi) - rank(lo);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::frozen_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::freeze() const {
+  return frozen_type(iterator(GetMin(root_), this), size(), comp_);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator::operator++(
+    int) {
   iterator temp = *this;
   ++(*this);
   return temp;
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::iterator &
-BinaryTree<key_type, value_type>::iterator::operator++() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator &
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::iterator::operator++() {
   if (iter_node == nullptr) return *this;
   if (iter_node->right != nullptr) {
     iter_node = iter_node->right;
     while (iter_node->left != nullptr) iter_node = iter_node->left;
   } else {
-    Node<key_type, value_type> *parent = iter_node->parent;
+    node_type *parent = iter_node->parent;
     while (parent != nullptr && iter_node == parent->right) {
       iter_node = parent;
       parent = parent->parent;
@@ -251,215 +555,771 @@ BinaryTree<key_type, value_type>::iterator::operator++() {
   return *this;
 }
 
-template <typename key_type, typename value_type>
-bool BinaryTree<key_type, value_type>::iterator::operator==(
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator::operator--(
+    int) {
+  iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator &
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::iterator::operator--() {
+  if (iter_node == nullptr) {
+    if (iter_tree != nullptr) iter_node = GetMax(iter_tree->root_);
+    return *this;
+  }
+  if (iter_node->left != nullptr) {
+    iter_node = GetMax(iter_node->left);
+  } else {
+    node_type *parent = iter_node->parent;
+    while (parent != nullptr && iter_node == parent->left) {
+      iter_node = parent;
+      parent = parent->parent;
+    }
+    iter_node = parent;
+  }
+  return *this;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator::operator==(
     const iterator &other) const {
-  return iter_node == other.iter_node && iter_past_node == other.iter_past_node;
+  return iter_node == other.iter_node;
 }
 
-template <typename key_type, typename value_type>
-bool BinaryTree<key_type, value_type>::iterator::operator!=(
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator::operator!=(
     const iterator &other) const {
   return !(*this == other);
 }
 
-template <typename key_type, typename value_type>
-const value_type &BinaryTree<key_type, value_type>::iterator::operator*() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+const value_type &
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::iterator::operator*() {
   static value_type dummy;
-  return (iter_node != nullptr) ? iter_node->value : dummy;
+  return (iter_node != nullptr) ? NodeValue(*iter_node) : dummy;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+const key_type &
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator::first() {
+  static key_type dummy;
+  return (iter_node != nullptr) ? iter_node->key : dummy;
 }
 
-template <typename key_type, typename value_type>
-value_type &BinaryTree<key_type, value_type>::iterator::second() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+value_type &
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::iterator::second() {
   static value_type dummy;
-  return (iter_node != nullptr) ? iter_node->value : dummy;
+  return (iter_node != nullptr) ? NodeValue(*iter_node) : dummy;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare,
+                    NodeAllocator>::reverse_iterator
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::reverse_iterator::operator++(
+    int) {
+  reverse_iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare,
+                    NodeAllocator>::reverse_iterator &
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::reverse_iterator::operator++() {
+  if (iter_.iter_node != nullptr) --iter_;
+  return *this;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare,
+                    NodeAllocator>::reverse_iterator
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::reverse_iterator::operator--(
+    int) {
+  reverse_iterator temp = *this;
+  --(*this);
+  return temp;
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::insert(
-    Node<key_type, value_type> *node, const key_type &key,
-    const value_type &value, bool &inserted) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare,
+                    NodeAllocator>::reverse_iterator &
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::reverse_iterator::operator--() {
+  if (iter_.iter_node == nullptr) {
+    if (iter_.iter_tree != nullptr) {
+      iter_.iter_node = GetMin(iter_.iter_tree->root_);
+    }
+  } else {
+    ++iter_;
+  }
+  return *this;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::reverse_iterator::operator==(
+    const reverse_iterator &other) const {
+  return iter_ == other.iter_;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool
+BinaryTree<key_type, value_type, Compare,
+           NodeAllocator>::reverse_iterator::operator!=(
+    const reverse_iterator &other) const {
+  return !(*this == other);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K, typename... Args>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::CreateNode(
+    K &&key, Args &&...args) {
+  if constexpr (kKeyOnly) {
+    return alloc_.create(std::forward<K>(key));
+  } else {
+    return alloc_.create(std::forward<K>(key), std::forward<Args>(args)...);
+  }
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K, typename... Args>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Emplace(
+    node_type *node, K &&key, node_type *&result, bool &inserted,
+    Args &&...args) {
+  inserted = false;
+  return EmplaceBelow(node, nullptr, std::forward<K>(key), result, inserted,
+                      std::forward<Args>(args)...);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K, typename... Args>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::EmplaceBelow(
+    node_type *node, node_type *candidate, K &&key, node_type *&result,
+    bool &inserted, Args &&...args) {
   if (node == nullptr) {
+    if (candidate != nullptr && !comp_(candidate->key, key)) {
+      result = candidate;
+      return nullptr;
+    }
     inserted = true;
-    return new Node<key_type, value_type>(key, value);
+    result = CreateNode(std::forward<K>(key), std::forward<Args>(args)...);
+    return result;
   }
-  if (key < node->key) {
-    node->left = insert(node->left, key, value, inserted);
-  } else if (key > node->key) {
-    node->right = insert(node->right, key, value, inserted);
+  if (comp_(key, node->key)) {
+    node->left = EmplaceBelow(node->left, candidate, std::forward<K>(key),
+                              result, inserted, std::forward<Args>(args)...);
   } else {
-    inserted = false;
+    node->right = EmplaceBelow(node->right, node, std::forward<K>(key), result,
+                               inserted, std::forward<Args>(args)...);
   }
-  return Balance(node);
+  return inserted ? Balance(node) : node;
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::remove(
-    Node<key_type, value_type> *node, const key_type &key) {
-  if (node == nullptr) return node;
-  if (key < node->key) {
-    node->left = remove(node->left, key);
-  } else if (key > node->key) {
-    node->right = remove(node->right, key);
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+std::pair<typename BinaryTree<key_type, value_type, Compare,
+                              NodeAllocator>::node_type *,
+          bool>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::EmplaceNode(
+    node_type *new_node) {
+  bool inserted = false;
+  node_type *result = nullptr;
+  root_ = InsertUniqueBelow(root_, nullptr, new_node, result, inserted);
+  if (!inserted) alloc_.destroy(new_node);
+  return {result, inserted};
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+std::pair<typename BinaryTree<key_type, value_type, Compare,
+                              NodeAllocator>::node_type *,
+          bool>
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::EmplaceNodeHint(
+    node_type *hint, node_type *new_node) {
+  if (hint != nullptr && !comp_(new_node->key, hint->key)) {
+    if (comp_(hint->key, new_node->key)) return EmplaceNode(new_node);
+    alloc_.destroy(new_node);
+    return {hint, false};
+  }
+  // Предшественник hint: максимум левого поддерева или первый предок,
+  // в правом поддереве которого лежит hint
+  node_type *prev = nullptr;
+  if (hint == nullptr) {
+    prev = root_ == nullptr ? nullptr : GetMax(root_);
+  } else if (hint->left != nullptr) {
+    prev = GetMax(hint->left);
+  } else {
+    node_type *child = hint;
+    prev = hint->parent;
+    while (prev != nullptr && child == prev->left) {
+      child = prev;
+      prev = prev->parent;
+    }
+  }
+  if (prev != nullptr && !comp_(prev->key, new_node->key)) {
+    return EmplaceNode(new_node);
+  }
+  // Между соседями у prev нет правого потомка или у hint нет левого
+  node_type *parent = nullptr;
+  if (prev != nullptr && prev->right == nullptr) {
+    parent = prev;
+    prev->right = new_node;
+  } else if (hint != nullptr) {
+    parent = hint;
+    hint->left = new_node;
   } else {
-    if (node->left == nullptr && node->right == nullptr) {
-      delete node;
+    root_ = new_node;
+  }
+  new_node->parent = parent;
+  while (parent != nullptr) {
+    node_type *up = parent->parent;
+    node_type *top = Balance(parent);
+    if (top != parent) Replace(up, parent, top);
+    parent = up;
+  }
+  return {new_node, true};
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::InsertUniqueBelow(
+    node_type *node, node_type *candidate, node_type *new_node,
+    node_type *&result, bool &inserted) {
+  if (node == nullptr) {
+    if (candidate != nullptr && !comp_(candidate->key, new_node->key)) {
+      result = candidate;
       return nullptr;
-    } else if (node->left == nullptr) {
-      Node<key_type, value_type> *temp = node->right;
-      delete node;
-      return temp;
-    } else if (node->right == nullptr) {
-      Node<key_type, value_type> *temp = node->left;
-      delete node;
-      return temp;
+    }
+    inserted = true;
+    result = new_node;
+    return new_node;
+  }
+  if (comp_(new_node->key, node->key)) {
+    node->left =
+        InsertUniqueBelow(node->left, candidate, new_node, result, inserted);
+  } else {
+    node->right =
+        InsertUniqueBelow(node->right, node, new_node, result, inserted);
+  }
+  return inserted ? Balance(node) : node;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::LowerBound(
+    const K &key) const {
+  node_type *node = root_, *result = nullptr;
+  while (node != nullptr) {
+    if (comp_(node->key, key)) {
+      node = node->right;
     } else {
-      Node<key_type, value_type> *temp = GetMin(node->right);
-      node->key = temp->key;
-      node->value = temp->value;
-      node->right = remove(node->right, temp->key);
+      result = node;
+      node = node->left;
     }
   }
-  UpdateHeight(node);
-  return Balance(node);
+  return result;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::UpperBound(
+    const K &key) const {
+  node_type *node = root_, *result = nullptr;
+  while (node != nullptr) {
+    if (comp_(key, node->key)) {
+      result = node;
+      node = node->left;
+    } else {
+      node = node->right;
+    }
+  }
+  return result;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::FindNode(
+    const K &key) const {
+  node_type *node = LowerBound(key);
+  return node != nullptr && !comp_(key, node->key) ? node : nullptr;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::LowerRank(
+    const K &key) const {
+  node_type *node = root_;
+  size_type result = 0;
+  while (node != nullptr) {
+    if (comp_(node->key, key)) {
+      result += size(node->left) + 1;
+      node = node->right;
+    } else {
+      node = node->left;
+    }
+  }
+  return result;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename K>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::UpperRank(
+    const K &key) const {
+  node_type *node = root_;
+  size_type result = 0;
+  while (node != nullptr) {
+    if (comp_(key, node->key)) {
+      node = node->left;
+    } else {
+      result += size(node->left) + 1;
+      node = node->right;
+    }
+  }
+  return result;
 }
 
-template <typename key_type, typename value_type>
-void BinaryTree<key_type, value_type>::clear(Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::Replace(
+    node_type *parent, node_type *node, node_type *replacement) {
+  if (parent == nullptr) {
+    root_ = replacement;
+  } else if (parent->left == node) {
+    parent->left = replacement;
+  } else {
+    parent->right = replacement;
+  }
+  if (replacement != nullptr) replacement->parent = parent;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::EraseNode(
+    node_type *node) {
+  // Самый нижний узел, у которого изменилось поддерево
+  node_type *start = node->parent;
+  if (node->left == nullptr || node->right == nullptr) {
+    Replace(node->parent, node,
+            node->left != nullptr ? node->left : node->right);
+  } else {
+    node_type *successor = GetMin(node->right);
+    if (successor->parent != node) {
+      start = successor->parent;
+      Replace(successor->parent, successor, successor->right);
+      successor->right = node->right;
+    } else {
+      start = successor;
+    }
+    successor->left = node->left;
+    Replace(node->parent, node, successor);
+    UpdateNode(successor);
+  }
+  alloc_.destroy(node);
+  while (start != nullptr) {
+    node_type *parent = start->parent;
+    node_type *top = Balance(start);
+    if (top != start) Replace(parent, start, top);
+    start = parent;
+  }
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::clear(
+    node_type *node) {
   if (node) {
     clear(node->left);
     clear(node->right);
-    delete node;
+    alloc_.destroy(node);
   }
 }
 
-template <typename key_type, typename value_type>
-void BinaryTree<key_type, value_type>::merge(Node<key_type, value_type> *&into,
-                                             Node<key_type, value_type> *&from,
-                                             BinaryTree &other) {
-  if (from == nullptr) {
-    return;
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Join(
+    node_type *left, node_type *middle, node_type *right) {
+  int left_height = Height(left);
+  int right_height = Height(right);
+  if (left_height > right_height + 1) {
+    left->right = Join(left->right, middle, right);
+    return Balance(left);
   }
-  if (!this->contains(from->key)) {
-    bool inserted = false;
-    into = insert(into, from->key, from->value, inserted);
-    if (inserted) {
-      Node<key_type, value_type> *left_from = from->left;
-      Node<key_type, value_type> *right_from = from->right;
-      merge(into, left_from, other);
-      merge(into, right_from, other);
-      if (other.contains(from->key)) {
-        other.erase(from->key);
-      }
-    }
-  } else {
-    merge(into, from->left, other);
-    merge(into, from->right, other);
+  if (right_height > left_height + 1) {
+    right->left = Join(left, middle, right->left);
+    return Balance(right);
+  }
+  middle->left = left;
+  middle->right = right;
+  UpdateNode(middle);
+  return middle;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Join2(
+    node_type *left, node_type *right) {
+  if (left == nullptr) return right;
+  if (right == nullptr) return left;
+  node_type *last = nullptr;
+  left = SplitLast(left, last);
+  return Join(left, last, right);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::SplitLast(
+    node_type *node, node_type *&last) {
+  if (node->right == nullptr) {
+    last = node;
+    return node->left;
   }
+  node->right = SplitLast(node->right, last);
+  return Balance(node);
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::size_type
-BinaryTree<key_type, value_type>::size(Node<key_type, value_type> *node) const {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::Split(
+    node_type *node, const key_type &key, node_type *&left, node_type *&found,
+    node_type *&right) {
   if (node == nullptr) {
-    return 0;
+    left = found = right = nullptr;
+  } else if (comp_(key, node->key)) {
+    node_type *inner = nullptr;
+    Split(node->left, key, left, found, inner);
+    right = Join(inner, node, node->right);
+  } else if (comp_(node->key, key)) {
+    node_type *inner = nullptr;
+    Split(node->right, key, inner, found, right);
+    left = Join(node->left, node, inner);
   } else {
-    return size(node->left) + size(node->right) + 1;
+    left = node->left;
+    right = node->right;
+    found = node;
   }
 }
 
-template <typename key_type, typename value_type>
-int BinaryTree<key_type, value_type>::Height(Node<key_type, value_type> *node) {
-  if (node == nullptr) return 0;
-  return 1 + std::max(Height(node->left), Height(node->right));
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Union(
+    node_type *first, node_type *second, node_type *&duplicates) {
+  duplicates = nullptr;
+  if (first == nullptr) return second;
+  if (second == nullptr) return first;
+  node_type *less = nullptr, *equal = nullptr, *greater = nullptr;
+  Split(second, first->key, less, equal, greater);
+  node_type *left_duplicates = nullptr, *right_duplicates = nullptr;
+  node_type *left = Union(first->left, less, left_duplicates);
+  node_type *right = Union(first->right, greater, right_duplicates);
+  duplicates = equal != nullptr
+                   ? Join(left_duplicates, equal, right_duplicates)
+                   : Join2(left_duplicates, right_duplicates);
+  return Join(left, first, right);
 }
 
-template <typename key_type, typename value_type>
-int BinaryTree<key_type, value_type>::BalanceFactor(
-    Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Intersection(
+    node_type *node, const node_type *other) {
+  if (node == nullptr) return nullptr;
+  if (other == nullptr) {
+    clear(node);
+    return nullptr;
+  }
+  node_type *less = nullptr, *equal = nullptr, *greater = nullptr;
+  Split(node, other->key, less, equal, greater);
+  node_type *left = Intersection(less, other->left);
+  node_type *right = Intersection(greater, other->right);
+  return equal != nullptr ? Join(left, equal, right) : Join2(left, right);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::Difference(
+    node_type *node, const node_type *other) {
+  if (node == nullptr || other == nullptr) return node;
+  node_type *less = nullptr, *equal = nullptr, *greater = nullptr;
+  Split(node, other->key, less, equal, greater);
+  if (equal != nullptr) alloc_.destroy(equal);
+  return Join2(Difference(less, other->left),
+               Difference(greater, other->right));
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::size_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::size(
+    node_type *node) const {
+  return node == nullptr ? 0 : node->size;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+int BinaryTree<key_type, value_type, Compare, NodeAllocator>::Height(
+    node_type *node) {
+  return node == nullptr ? 0 : node->height;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+int BinaryTree<key_type, value_type, Compare, NodeAllocator>::BalanceFactor(
+    node_type *node) {
   if (node == nullptr) return 0;
   return Height(node->left) - Height(node->right);
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::RightRotate(
-    Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::RightRotate(
+    node_type *node) {
   if (node == nullptr || node->left == nullptr) {
     return node;
   }
-  Node<key_type, value_type> *left = node->left;
-  Node<key_type, value_type> *left_right = left->right;
+  node_type *left = node->left;
+  node_type *left_right = left->right;
 
+  left->parent = node->parent;
   left->right = node;
   node->left = left_right;
 
+  UpdateNode(node);
+  UpdateNode(left);
   return left;
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::LeftRotate(
-    Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::LeftRotate(
+    node_type *node) {
   if (node == nullptr || node->right == nullptr) return node;
-  Node<key_type, value_type> *right = node->right;
-  Node<key_type, value_type> *right_left = right->left;
+  node_type *right = node->right;
+  node_type *right_left = right->left;
+  right->parent = node->parent;
   right->left = node;
   node->right = right_left;
+  UpdateNode(node);
+  UpdateNode(right);
   return right;
 }
 
-template <typename key_type, typename value_type>
-int BinaryTree<key_type, value_type>::UpdateHeight(
-    Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+int BinaryTree<key_type, value_type, Compare, NodeAllocator>::UpdateNode(
+    node_type *node) {
   if (node == nullptr) return 0;
-  int left_height = UpdateHeight(node->left);
-  int right_height = UpdateHeight(node->right);
-  node->height = 1 + std::max(left_height, right_height);
+  node->height = 1 + std::max(Height(node->left), Height(node->right));
+  node->size = size(node->left) + size(node->right) + 1;
+  if (node->left != nullptr) node->left->parent = node;
+  if (node->right != nullptr) node->right->parent = node;
   return node->height;
 }
 
-template <typename key_type, typename value_type>
-bool BinaryTree<key_type, value_type>::IsBalanced(
-    Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+bool BinaryTree<key_type, value_type, Compare, NodeAllocator>::IsBalanced(
+    node_type *node) {
   if (node == nullptr) return true;
   int left_height = Height(node->left);
   int right_height = Height(node->right);
-  return abs(left_height - right_height) <= 1 && IsBalanced(node->left) &&
+  return node->height == 1 + std::max(left_height, right_height) &&
+         node->size == size(node->left) + size(node->right) + 1 &&
+         (node->left == nullptr || node->left->parent == node) &&
+         (node->right == nullptr || node->right->parent == node) &&
+         abs(left_height - right_height) <= 1 && IsBalanced(node->left) &&
          IsBalanced(node->right);
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::GetMin(
-    Node<key_type, value_type> *node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::GetMin(
+    node_type *node) {
   while (node && node->left) node = node->left;
   return node;
 }
 
-template <typename key_type, typename value_type>
-Node<key_type, value_type> *BinaryTree<key_type, value_type>::copy(
-    Node<key_type, value_type> *other_node) {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::GetMax(
+    node_type *node) {
+  while (node && node->right) node = node->right;
+  return node;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+template <typename Item>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::BuildBalanced(
+    vector<Item> &items, size_type lo, size_type hi) {
+  if (lo == hi) return nullptr;
+  size_type mid = lo + (hi - lo) / 2;
+  // Узлы создаются в порядке обхода, поэтому соседние ключи лежат рядом
+  // в памяти пула
+  node_type *left = BuildBalanced(items, lo, mid);
+  node_type *node = nullptr;
+  if constexpr (std::is_same<Item, key_type>::value) {
+    // Одни ключи: узел множества хранит ключ один раз, иначе значением
+    // служит копия ключа
+    if constexpr (kKeyOnly) {
+      node = CreateNode(std::move(items[mid]));
+    } else {
+      node = CreateNode(items[mid], std::move(items[mid]));
+    }
+  } else {
+    node =
+        CreateNode(std::move(items[mid].first), std::move(items[mid].second));
+  }
+  node->left = left;
+  node->right = BuildBalanced(items, mid + 1, hi);
+  UpdateNode(node);
+  return node;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+void BinaryTree<key_type, value_type, Compare, NodeAllocator>::Flatten(
+    node_type *node, node_type **&out) {
+  if (node == nullptr) return;
+  Flatten(node->left, out);
+  *out++ = node;
+  Flatten(node->right, out);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::FromArray(
+    node_type **nodes, size_type lo, size_type hi) {
+  if (lo == hi) return nullptr;
+  size_type mid = lo + (hi - lo) / 2;
+  node_type *node = nodes[mid];
+  node->left = FromArray(nodes, lo, mid);
+  node->right = FromArray(nodes, mid + 1, hi);
+  UpdateNode(node);
+  return node;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::InsertNode(
+    node_type *node, node_type *new_node) {
+  if (node == nullptr) {
+    UpdateNode(new_node);
+    return new_node;
+  }
+  if (comp_(new_node->key, node->key)) {
+    node->left = InsertNode(node->left, new_node);
+  } else {
+    node->right = InsertNode(node->right, new_node);
+  }
+  return Balance(node);
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::copy(
+    node_type *other_node) {
   if (other_node == nullptr) return nullptr;
-  Node<key_type, value_type> *new_node =
-      new Node<key_type, value_type>(other_node->key, other_node->value);
+  node_type *new_node = CreateNode(other_node->key, NodeValue(*other_node));
+  new_node->height = other_node->height;
+  new_node->size = other_node->size;
   new_node->left = copy(other_node->left);
   new_node->right = copy(other_node->right);
+  if (new_node->left != nullptr) new_node->left->parent = new_node;
+  if (new_node->right != nullptr) new_node->right->parent = new_node;
+  return new_node;
+}
+
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::node_type *
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::MoveElements(
+    node_type *other_node) {
+  if (other_node == nullptr) return nullptr;
+  node_type *new_node = CreateNode(std::move(other_node->key),
+                                   std::move(NodeValue(*other_node)));
+  new_node->height = other_node->height;
+  new_node->size = other_node->size;
+  new_node->left = MoveElements(other_node->left);
+  new_node->right = MoveElements(other_node->right);
+  if (new_node->left != nullptr) new_node->left->parent = new_node;
+  if (new_node->right != nullptr) new_node->right->parent = new_node;
   return new_node;
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::key_type
-BinaryTree<key_type, value_type>::GetRootKey() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::key_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::GetRootKey() {
   return root_->key;
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::key_type
-BinaryTree<key_type, value_type>::GetLeftChildKey() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::key_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::GetLeftChildKey() {
   return root_->left->key;
 }
 
-template <typename key_type, typename value_type>
-typename BinaryTree<key_type, value_type>::key_type
-BinaryTree<key_type, value_type>::GetRightChildKey() {
+template <typename key_type, typename value_type, typename Compare,
+          typename NodeAllocator>
+typename BinaryTree<key_type, value_type, Compare, NodeAllocator>::key_type
+BinaryTree<key_type, value_type, Compare, NodeAllocator>::GetRightChildKey() {
   return root_->right->key;
 }
 
@@ -0,0 +1,715 @@
+#include "../include/s21_btree.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+BTree<Key, T, Compare>::BTree() : root_(nullptr), size_(0), comp_() {}
+
+template <typename Key, typename T, typename Compare>
+BTree<Key, T, Compare>::BTree(const Compare &comp)
+    : root_(nullptr), size_(0), comp_(comp) {}
+
+template <typename Key, typename T, typename Compare>
+BTree<Key, T, Compare>::BTree(const BTree &other)
+    : root_(nullptr), size_(other.size_), comp_(other.comp_) {
+  if (other.root_ != nullptr) root_ = CopyTree(other.root_);
+}
+
+template <typename Key, typename T, typename Compare>
+BTree<Key, T, Compare>::BTree(BTree &&other) noexcept
+    : root_(other.root_), size_(other.size_), comp_(std::move(other.comp_)) {
+  other.root_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename Key, typename T, typename Compare>
+BTree<Key, T, Compare>::~BTree() {
+  clear();
+}
+
+template <typename Key, typename T, typename Compare>
+BTree<Key, T, Compare> &BTree<Key, T, Compare>::operator=(
+    const BTree &other) {
+  if (this != &other) {
+    BTree copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+BTree<Key, T, Compare> &BTree<Key, T, Compare>::operator=(
+    BTree &&other) noexcept {
+  if (this != &other) {
+    clear();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::find(
+    const key_type &key) {
+  iterator it = LowerBound(key);
+  if (it != end() && comp_(key, it.first())) return end();
+  return it;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::find(
+    const K &key) {
+  iterator it = LowerBound(key);
+  if (it != end() && comp_(key, it.first())) return end();
+  return it;
+}
+
+template <typename Key, typename T, typename Compare>
+bool BTree<Key, T, Compare>::contains(const key_type &key) {
+  return find(key) != end();
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+bool BTree<Key, T, Compare>::contains(const K &key) {
+  return find(key) != end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::lower_bound(
+    const key_type &key) {
+  return LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::lower_bound(
+    const K &key) {
+  return LowerBound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::upper_bound(
+    const key_type &key) {
+  return UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::upper_bound(
+    const K &key) {
+  return UpperBound(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::key_compare
+BTree<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+bool BTree<Key, T, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::size_type BTree<Key, T, Compare>::size()
+    const {
+  return size_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::size_type BTree<Key, T, Compare>::max_size()
+    const {
+  return std::numeric_limits<size_type>::max();
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::erase(iterator pos) {
+  node_type *node = pos.iter_node;
+  size_type i = pos.iter_position;
+  if (node == nullptr) return;
+
+  DestroySlot(node, i);
+  if (!node->leaf) {
+    // На место элемента встает предшественник из самого правого листа
+    // левого поддерева, и удаление сводится к удалению из листа
+    node_type *leaf = Child(node, i);
+    while (!leaf->leaf) leaf = Child(leaf, leaf->count);
+    MoveSlot(node, i, leaf, leaf->count - 1);
+    node = leaf;
+  } else {
+    for (size_type k = i + 1; k < node->count; ++k) {
+      MoveSlot(node, k - 1, node, k);
+    }
+  }
+  --node->count;
+  --size_;
+  Rebalance(node);
+}
+
+template <typename Key, typename T, typename Compare>
+bool BTree<Key, T, Compare>::erase(const key_type &key) {
+  iterator it = find(key);
+  if (it == end()) return false;
+  erase(it);
+  return true;
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::swap(BTree &other) {
+  std::swap(root_, other.root_);
+  std::swap(size_, other.size_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::clear() {
+  if (root_ != nullptr) DestroyTree(root_);
+  root_ = nullptr;
+  size_ = 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::begin() {
+  if (root_ == nullptr) return end();
+  node_type *node = root_;
+  while (!node->leaf) node = Child(node, 0);
+  return iterator(node, 0, this);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::end() {
+  return iterator(nullptr, 0, this);
+}
+
+template <typename Key, typename T, typename Compare>
+bool BTree<Key, T, Compare>::IsValid() const {
+  if (root_ == nullptr) return size_ == 0;
+  if (root_->parent != nullptr) return false;
+  size_type leaf_depth = 0;
+  size_type count = 0;
+  return IsValid(root_, nullptr, nullptr, 1, leaf_depth, count) &&
+         count == size_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator
+BTree<Key, T, Compare>::Iterator::operator++(int) {
+  iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator &
+BTree<Key, T, Compare>::Iterator::operator++() {
+  if (iter_node == nullptr) return *this;
+  if (!iter_node->leaf) {
+    iter_node = Child(iter_node, iter_position + 1);
+    while (!iter_node->leaf) iter_node = Child(iter_node, 0);
+    iter_position = 0;
+    return *this;
+  }
+  ++iter_position;
+  while (iter_node != nullptr && iter_position == iter_node->count) {
+    iter_position = iter_node->position;
+    iter_node = iter_node->parent;
+  }
+  if (iter_node == nullptr) iter_position = 0;
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator
+BTree<Key, T, Compare>::Iterator::operator--(int) {
+  iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::iterator &
+BTree<Key, T, Compare>::Iterator::operator--() {
+  if (iter_node == nullptr || !iter_node->leaf) {
+    node_type *node = iter_node == nullptr
+                          ? (iter_tree != nullptr ? iter_tree->root_ : nullptr)
+                          : Child(iter_node, iter_position);
+    if (node == nullptr) return *this;
+    while (!node->leaf) node = Child(node, node->count);
+    iter_node = node;
+    iter_position = node->count - 1;
+  } else if (iter_position > 0) {
+    --iter_position;
+  } else {
+    node_type *node = iter_node;
+    while (node->parent != nullptr && node->position == 0) {
+      node = node->parent;
+    }
+    iter_node = node->parent;
+    iter_position = iter_node == nullptr ? 0 : node->position - 1;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+bool BTree<Key, T, Compare>::Iterator::operator==(const iterator &other) const {
+  return iter_node == other.iter_node && iter_position == other.iter_position;
+}
+
+template <typename Key, typename T, typename Compare>
+bool BTree<Key, T, Compare>::Iterator::operator!=(const iterator &other) const {
+  return !(*this == other);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::const_reference
+BTree<Key, T, Compare>::Iterator::operator*() const {
+  if (iter_node == nullptr) {
+    throw std::out_of_range("Dereferencing end iterator");
+  }
+  return Value(iter_node, iter_position);
+}
+
+template <typename Key, typename T, typename Compare>
+const typename BTree<Key, T, Compare>::key_type &
+BTree<Key, T, Compare>::Iterator::first() const {
+  if (iter_node == nullptr) {
+    throw std::out_of_range("Dereferencing end iterator");
+  }
+  return iter_node->keys[iter_position];
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::reference
+BTree<Key, T, Compare>::Iterator::second() const {
+  if (iter_node == nullptr) {
+    throw std::out_of_range("Dereferencing end iterator");
+  }
+  return Value(iter_node, iter_position);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename BTree<Key, T, Compare>::iterator, bool>
+BTree<Key, T, Compare>::EmplaceUnique(K &&key, Args &&...args) {
+  if (root_ == nullptr) root_ = new node_type();
+  node_type *node = root_;
+  while (true) {
+    size_type i = LowerIndex(node, key);
+    if (i < node->count && !comp_(key, node->keys[i])) {
+      return {iterator(node, i, this), false};
+    }
+    if (node->leaf) {
+      return {InsertAt(node, i, std::forward<K>(key),
+                       std::forward<Args>(args)...),
+              true};
+    }
+    node = Child(node, i);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::EmplaceMulti(
+    K &&key, Args &&...args) {
+  if (root_ == nullptr) root_ = new node_type();
+  node_type *node = root_;
+  size_type i = UpperIndex(node, key);
+  while (!node->leaf) {
+    node = Child(node, i);
+    i = UpperIndex(node, key);
+  }
+  return InsertAt(node, i, std::forward<K>(key), std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Compare>
+template <bool kMulti>
+void BTree<Key, T, Compare>::Merge(BTree &other) {
+  if (this == &other) return;
+  BTree rest(other.comp_);
+  for (iterator it = other.begin(); it != other.end(); ++it) {
+    node_type *node = it.iter_node;
+    size_type i = it.iter_position;
+    bool inserted = true;
+    // Ключ перемещается только при вставке, поэтому при неудаче его
+    // можно переложить в rest
+    if constexpr (kKeyOnly) {
+      if constexpr (kMulti) {
+        EmplaceMulti(std::move(node->keys[i]));
+      } else {
+        inserted = EmplaceUnique(std::move(node->keys[i])).second;
+      }
+      if (!inserted) rest.EmplaceMulti(std::move(node->keys[i]));
+    } else {
+      if constexpr (kMulti) {
+        EmplaceMulti(std::move(node->keys[i]), std::move(node->values[i]));
+      } else {
+        inserted = EmplaceUnique(std::move(node->keys[i]),
+                                 std::move(node->values[i]))
+                       .second;
+      }
+      if (!inserted) {
+        rest.EmplaceMulti(std::move(node->keys[i]),
+                          std::move(node->values[i]));
+      }
+    }
+  }
+  other.swap(rest);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::reference BTree<Key, T, Compare>::Value(
+    node_type *node, size_type i) {
+  if constexpr (kKeyOnly) {
+    return node->keys[i];
+  } else {
+    return node->values[i];
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::LowerBound(
+    const K &key) {
+  iterator result = end();
+  node_type *node = root_;
+  while (node != nullptr) {
+    size_type i = LowerIndex(node, key);
+    if (i < node->count) result = iterator(node, i, this);
+    if (node->leaf) break;
+    node = Child(node, i);
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::UpperBound(
+    const K &key) {
+  iterator result = end();
+  node_type *node = root_;
+  while (node != nullptr) {
+    size_type i = UpperIndex(node, key);
+    if (i < node->count) result = iterator(node, i, this);
+    if (node->leaf) break;
+    node = Child(node, i);
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename BTree<Key, T, Compare>::size_type BTree<Key, T, Compare>::LowerIndex(
+    const node_type *node, const K &key) const {
+  // Длина отрезка меняется одинаково при любом исходе сравнения, поэтому
+  // компилятор заменяет ветвление условной пересылкой
+  size_type lo = 0;
+  size_type len = node->count;
+  if (len == 0) return 0;
+  while (len > 1) {
+    size_type half = len / 2;
+    if (comp_(node->keys[lo + half], key)) lo += half;
+    len -= half;
+  }
+  return lo + (comp_(node->keys[lo], key) ? 1 : 0);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename BTree<Key, T, Compare>::size_type BTree<Key, T, Compare>::UpperIndex(
+    const node_type *node, const K &key) const {
+  size_type lo = 0;
+  size_type len = node->count;
+  if (len == 0) return 0;
+  while (len > 1) {
+    size_type half = len / 2;
+    if (!comp_(key, node->keys[lo + half])) lo += half;
+    len -= half;
+  }
+  return lo + (comp_(key, node->keys[lo]) ? 0 : 1);
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::node_type *BTree<Key, T, Compare>::Child(
+    const node_type *node, size_type i) {
+  return static_cast<const internal_node_type *>(node)->children[i];
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::SetChild(node_type *node, size_type i,
+                                      node_type *child) {
+  static_cast<internal_node_type *>(node)->children[i] = child;
+  child->parent = node;
+  child->position = static_cast<unsigned short>(i);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+void BTree<Key, T, Compare>::ConstructSlot(node_type *node, size_type i,
+                                           K &&key, Args &&...args) {
+  new (&node->keys[i]) key_type(std::forward<K>(key));
+  if constexpr (!kKeyOnly) {
+    try {
+      new (&node->values[i]) T(std::forward<Args>(args)...);
+    } catch (...) {
+      node->keys[i].~key_type();
+      throw;
+    }
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::DestroySlot(node_type *node, size_type i) {
+  node->keys[i].~key_type();
+  if constexpr (!kKeyOnly) node->values[i].~T();
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::MoveSlot(node_type *dst, size_type j,
+                                      node_type *src, size_type i) {
+  new (&dst->keys[j]) key_type(std::move(src->keys[i]));
+  src->keys[i].~key_type();
+  if constexpr (!kKeyOnly) {
+    new (&dst->values[j]) T(std::move(src->values[i]));
+    src->values[i].~T();
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+typename BTree<Key, T, Compare>::iterator BTree<Key, T, Compare>::InsertAt(
+    node_type *node, size_type i, K &&key, Args &&...args) {
+  if (node->count == kNodeSlots) {
+    Split(node);
+    if (i > node->count) {
+      i -= node->count + 1;
+      node = Child(node->parent, node->position + 1);
+    }
+  }
+  for (size_type k = node->count; k > i; --k) MoveSlot(node, k, node, k - 1);
+  try {
+    ConstructSlot(node, i, std::forward<K>(key), std::forward<Args>(args)...);
+  } catch (...) {
+    for (size_type k = i; k < node->count; ++k) MoveSlot(node, k, node, k + 1);
+    throw;
+  }
+  ++node->count;
+  ++size_;
+  return iterator(node, i, this);
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::Split(node_type *node) {
+  node_type *parent = node->parent;
+  if (parent == nullptr) {
+    parent = new internal_node_type();
+    SetChild(parent, 0, node);
+    root_ = parent;
+  } else if (parent->count == kNodeSlots) {
+    Split(parent);
+    parent = node->parent;
+  }
+
+  size_type mid = kNodeSlots / 2;
+  node_type *sibling =
+      node->leaf ? new node_type() : new internal_node_type();
+  for (size_type j = mid + 1; j < kNodeSlots; ++j) {
+    MoveSlot(sibling, j - mid - 1, node, j);
+  }
+  if (!node->leaf) {
+    for (size_type j = mid + 1; j <= kNodeSlots; ++j) {
+      SetChild(sibling, j - mid - 1, Child(node, j));
+    }
+  }
+  sibling->count = static_cast<unsigned short>(kNodeSlots - mid - 1);
+
+  size_type p = node->position;
+  for (size_type k = parent->count; k > p; --k) {
+    MoveSlot(parent, k, parent, k - 1);
+    SetChild(parent, k + 1, Child(parent, k));
+  }
+  MoveSlot(parent, p, node, mid);
+  SetChild(parent, p + 1, sibling);
+  ++parent->count;
+  node->count = static_cast<unsigned short>(mid);
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::Rebalance(node_type *node) {
+  while (node != root_ && node->count < kMinSlots) {
+    node_type *parent = node->parent;
+    size_type p = node->position;
+    node_type *left = p > 0 ? Child(parent, p - 1) : nullptr;
+    node_type *right = p < parent->count ? Child(parent, p + 1) : nullptr;
+    if (left != nullptr && left->count > kMinSlots) {
+      RotateRight(parent, p - 1);
+      return;
+    }
+    if (right != nullptr && right->count > kMinSlots) {
+      RotateLeft(parent, p);
+      return;
+    }
+    MergeChildren(parent, left != nullptr ? p - 1 : p);
+    node = parent;
+  }
+  if (root_->count == 0) {
+    node_type *old_root = root_;
+    if (root_->leaf) {
+      root_ = nullptr;
+    } else {
+      root_ = Child(old_root, 0);
+      root_->parent = nullptr;
+      root_->position = 0;
+    }
+    DeleteNode(old_root);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::RotateRight(node_type *parent, size_type s) {
+  node_type *left = Child(parent, s);
+  node_type *right = Child(parent, s + 1);
+  for (size_type k = right->count; k > 0; --k) MoveSlot(right, k, right, k - 1);
+  if (!right->leaf) {
+    for (size_type k = right->count + 1; k > 0; --k) {
+      SetChild(right, k, Child(right, k - 1));
+    }
+    SetChild(right, 0, Child(left, left->count));
+  }
+  MoveSlot(right, 0, parent, s);
+  MoveSlot(parent, s, left, left->count - 1);
+  --left->count;
+  ++right->count;
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::RotateLeft(node_type *parent, size_type s) {
+  node_type *left = Child(parent, s);
+  node_type *right = Child(parent, s + 1);
+  MoveSlot(left, left->count, parent, s);
+  if (!left->leaf) SetChild(left, left->count + 1, Child(right, 0));
+  MoveSlot(parent, s, right, 0);
+  for (size_type k = 1; k < right->count; ++k) MoveSlot(right, k - 1, right, k);
+  if (!right->leaf) {
+    for (size_type k = 1; k <= right->count; ++k) {
+      SetChild(right, k - 1, Child(right, k));
+    }
+  }
+  ++left->count;
+  --right->count;
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::MergeChildren(node_type *parent, size_type s) {
+  node_type *left = Child(parent, s);
+  node_type *right = Child(parent, s + 1);
+  size_type base = left->count + 1;
+  MoveSlot(left, left->count, parent, s);
+  for (size_type j = 0; j < right->count; ++j) {
+    MoveSlot(left, base + j, right, j);
+  }
+  if (!left->leaf) {
+    for (size_type j = 0; j <= right->count; ++j) {
+      SetChild(left, base + j, Child(right, j));
+    }
+  }
+  left->count = static_cast<unsigned short>(base + right->count);
+
+  for (size_type k = s + 1; k < parent->count; ++k) {
+    MoveSlot(parent, k - 1, parent, k);
+    SetChild(parent, k, Child(parent, k + 1));
+  }
+  --parent->count;
+  right->count = 0;
+  DeleteNode(right);
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::DeleteNode(node_type *node) {
+  if (node->leaf) {
+    delete node;
+  } else {
+    delete static_cast<internal_node_type *>(node);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+typename BTree<Key, T, Compare>::node_type *BTree<Key, T, Compare>::CopyTree(
+    const node_type *node) {
+  node_type *copy = node->leaf ? new node_type() : new internal_node_type();
+  if (!copy->leaf) {
+    for (size_type i = 0; i <= node->count; ++i) {
+      static_cast<internal_node_type *>(copy)->children[i] = nullptr;
+    }
+  }
+  try {
+    for (; copy->count < node->count; ++copy->count) {
+      size_type i = copy->count;
+      if constexpr (kKeyOnly) {
+        ConstructSlot(copy, i, node->keys[i]);
+      } else {
+        ConstructSlot(copy, i, node->keys[i], node->values[i]);
+      }
+    }
+    if (!node->leaf) {
+      for (size_type i = 0; i <= node->count; ++i) {
+        SetChild(copy, i, CopyTree(Child(node, i)));
+      }
+    }
+  } catch (...) {
+    if (!copy->leaf) {
+      for (size_type i = 0; i <= node->count; ++i) {
+        node_type *child = Child(copy, i);
+        if (child != nullptr) DestroyTree(child);
+      }
+    }
+    for (size_type i = 0; i < copy->count; ++i) DestroySlot(copy, i);
+    DeleteNode(copy);
+    throw;
+  }
+  return copy;
+}
+
+template <typename Key, typename T, typename Compare>
+void BTree<Key, T, Compare>::DestroyTree(node_type *node) {
+  if (!node->leaf) {
+    for (size_type i = 0; i <= node->count; ++i) DestroyTree(Child(node, i));
+  }
+  for (size_type i = 0; i < node->count; ++i) DestroySlot(node, i);
+  DeleteNode(node);
+}
+
+template <typename Key, typename T, typename Compare>
+bool BTree<Key, T, Compare>::IsValid(const node_type *node,
+                                     const key_type *lo, const key_type *hi,
+                                     size_type depth, size_type &leaf_depth,
+                                     size_type &count) const {
+  if (node->count == 0 || node->count > kNodeSlots) return false;
+  if (node != root_ && node->count < kMinSlots) return false;
+  for (size_type i = 0; i < node->count; ++i) {
+    const key_type &key = node->keys[i];
+    if (i > 0 && comp_(key, node->keys[i - 1])) return false;
+    if ((lo != nullptr && comp_(key, *lo)) ||
+        (hi != nullptr && comp_(*hi, key))) {
+      return false;
+    }
+  }
+  count += node->count;
+  if (node->leaf) {
+    if (leaf_depth == 0) leaf_depth = depth;
+    return leaf_depth == depth;
+  }
+  for (size_type i = 0; i <= node->count; ++i) {
+    const node_type *child = Child(node, i);
+    if (child->parent != node || child->position != i) return false;
+    const key_type *child_lo = i > 0 ? &node->keys[i - 1] : lo;
+    const key_type *child_hi = i < node->count ? &node->keys[i] : hi;
+    if (!IsValid(child, child_lo, child_hi, depth + 1, leaf_depth, count)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace s21
@@ -0,0 +1,80 @@
+#include "../include/s21_btree_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+btree_map<Key, T, Compare>::btree_map(
+    std::initializer_list<value_type> const &items) {
+  for (const value_type &item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+btree_map<Key, T, Compare>::btree_map(InputIt first, InputIt last) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename Key, typename T, typename Compare>
+T &btree_map<Key, T, Compare>::at(const key_type &key) {
+  iterator it = this->find(key);
+  if (it == this->end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it.second();
+}
+
+template <typename Key, typename T, typename Compare>
+T &btree_map<Key, T, Compare>::operator[](const key_type &key) {
+  return try_emplace(key).first.second();
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename btree_map<Key, T, Compare>::iterator, bool>
+btree_map<Key, T, Compare>::insert(const value_type &value) {
+  return this->EmplaceUnique(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename btree_map<Key, T, Compare>::iterator, bool>
+btree_map<Key, T, Compare>::insert_or_assign(const key_type &key,
+                                             const mapped_type &obj) {
+  auto result = this->EmplaceUnique(key, obj);
+  if (!result.second) result.first.second() = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename btree_map<Key, T, Compare>::iterator, bool>
+btree_map<Key, T, Compare>::emplace(Args &&...args) {
+  std::pair<key_type, mapped_type> item(std::forward<Args>(args)...);
+  return this->EmplaceUnique(std::move(item.first), std::move(item.second));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename btree_map<Key, T, Compare>::iterator, bool>
+btree_map<Key, T, Compare>::try_emplace(K &&key, Args &&...args) {
+  return this->EmplaceUnique(std::forward<K>(key),
+                             std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+vector<std::pair<typename btree_map<Key, T, Compare>::iterator, bool>>
+btree_map<Key, T, Compare>::insert_many(Args &&...args) {
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(std::make_pair(iterator(), insert(args).second)));
+  // Вставка сдвигает элементы в узлах, поэтому итераторы берутся заново
+  // после всех вставок
+  size_type k = 0;
+  (..., (results[k++].first = this->find(args.first)));
+  return results;
+}
+
+template <typename Key, typename T, typename Compare>
+void btree_map<Key, T, Compare>::merge(btree_map &other) {
+  this->template Merge<false>(other);
+}
+
+}  // namespace s21
@@ -0,0 +1,65 @@
+#include "../include/s21_btree_multiset.h"
+
+namespace s21 {
+
+template <typename Key, typename Compare>
+btree_multiset<Key, Compare>::btree_multiset(
+    std::initializer_list<value_type> const &items) {
+  for (const value_type &item : items) insert(item);
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+btree_multiset<Key, Compare>::btree_multiset(InputIt first, InputIt last) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename Key, typename Compare>
+typename btree_multiset<Key, Compare>::iterator
+btree_multiset<Key, Compare>::insert(const value_type &value) {
+  return this->EmplaceMulti(value);
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+typename btree_multiset<Key, Compare>::iterator
+btree_multiset<Key, Compare>::emplace(Args &&...args) {
+  return this->EmplaceMulti(key_type(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Compare>
+typename btree_multiset<Key, Compare>::size_type
+btree_multiset<Key, Compare>::count(const key_type &key) {
+  size_type result = 0;
+  for (iterator it = this->lower_bound(key), last = this->upper_bound(key);
+       it != last; ++it) {
+    ++result;
+  }
+  return result;
+}
+
+template <typename Key, typename Compare>
+std::pair<typename btree_multiset<Key, Compare>::iterator,
+          typename btree_multiset<Key, Compare>::iterator>
+btree_multiset<Key, Compare>::equal_range(const key_type &key) {
+  return {this->lower_bound(key), this->upper_bound(key)};
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+vector<std::pair<typename btree_multiset<Key, Compare>::iterator, bool>>
+btree_multiset<Key, Compare>::insert_many(Args &&...args) {
+  (..., insert(args));
+  // Вставка сдвигает элементы в узлах, поэтому итераторы берутся после
+  // всех вставок; равные элементы не различаются
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(std::make_pair(this->find(args), true)));
+  return results;
+}
+
+template <typename Key, typename Compare>
+void btree_multiset<Key, Compare>::merge(btree_multiset &other) {
+  this->template Merge<true>(other);
+}
+
+}  // namespace s21
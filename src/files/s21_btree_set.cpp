@@ -0,0 +1,54 @@
+#include "../include/s21_btree_set.h"
+
+namespace s21 {
+
+template <typename Key, typename Compare>
+btree_set<Key, Compare>::btree_set(
+    std::initializer_list<value_type> const &items) {
+  for (const value_type &item : items) insert(item);
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+btree_set<Key, Compare>::btree_set(InputIt first, InputIt last) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename Key, typename Compare>
+std::pair<typename btree_set<Key, Compare>::iterator, bool>
+btree_set<Key, Compare>::insert(const value_type &value) {
+  return this->EmplaceUnique(value);
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+std::pair<typename btree_set<Key, Compare>::iterator, bool>
+btree_set<Key, Compare>::emplace(Args &&...args) {
+  return this->EmplaceUnique(key_type(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Compare>
+typename btree_set<Key, Compare>::size_type btree_set<Key, Compare>::count(
+    const key_type &key) {
+  return this->contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+vector<std::pair<typename btree_set<Key, Compare>::iterator, bool>>
+btree_set<Key, Compare>::insert_many(Args &&...args) {
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(std::make_pair(iterator(), insert(args).second)));
+  // Вставка сдвигает элементы в узлах, поэтому итераторы берутся заново
+  // после всех вставок
+  size_type k = 0;
+  (..., (results[k++].first = this->find(args)));
+  return results;
+}
+
+template <typename Key, typename Compare>
+void btree_set<Key, Compare>::merge(btree_set &other) {
+  this->template Merge<false>(other);
+}
+
+}  // namespace s21
@@ -0,0 +1,859 @@
+#include "../include/s21_concurrent_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+concurrent_map<Key, T, Compare>::concurrent_map()
+    : holder_(), size_(0), comp_() {}
+
+template <typename Key, typename T, typename Compare>
+concurrent_map<Key, T, Compare>::concurrent_map(const Compare &comp)
+    : holder_(), size_(0), comp_(comp) {}
+
+template <typename Key, typename T, typename Compare>
+concurrent_map<Key, T, Compare>::concurrent_map(
+    std::initializer_list<value_type> const &items)
+    : holder_(), size_(0), comp_() {
+  for (const value_type &item : items) insert(item.first, item.second);
+}
+
+template <typename Key, typename T, typename Compare>
+concurrent_map<Key, T, Compare>::~concurrent_map() {
+  DestroyTree(holder_.right.load());
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::insert(const key_type &key,
+                                             const mapped_type &obj) {
+  return Update(key, Mode::kInsert, new Value(obj)) == Result::kAbsent;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  return Update(key, Mode::kAssign, new Value(obj)) == Result::kAbsent;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::erase(const key_type &key) {
+  return Update(key, Mode::kErase, nullptr) == Result::kPresent;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::find(const key_type &key,
+                                           mapped_type &value) const {
+  EpochDomain::Guard guard;
+  while (true) {
+    Result result = AttemptGet(key, &holder_, 1, holder_.version.load(),
+                               &value);
+    if (result != Result::kRetry) return result == Result::kPresent;
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::contains(const key_type &key) const {
+  EpochDomain::Guard guard;
+  while (true) {
+    Result result = AttemptGet(key, &holder_, 1, holder_.version.load(),
+                               nullptr);
+    if (result != Result::kRetry) return result == Result::kPresent;
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::size_type
+concurrent_map<Key, T, Compare>::size() const {
+  return size_.load(std::memory_order_relaxed);
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::empty() const {
+  return size() == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::key_compare
+concurrent_map<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename F>
+void concurrent_map<Key, T, Compare>::for_each(F f) const {
+  ForEach(holder_.right.load(), f);
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::IsValid() const {
+  int height = 0;
+  return IsValid(holder_.right.load(), nullptr, nullptr, height);
+}
+
+template <typename Key, typename T, typename Compare>
+int concurrent_map<Key, T, Compare>::Direction(const key_type &key,
+                                               const node_type *node) const {
+  if (node == &holder_) return 1;
+  if (comp_(key, node->key)) return -1;
+  return comp_(node->key, key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::Child(const node_type *node, int dir) {
+  return dir < 0 ? node->left.load(std::memory_order_acquire)
+                 : node->right.load(std::memory_order_acquire);
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::SetChild(node_type *node, int dir,
+                                               node_type *child) {
+  if (dir < 0) {
+    node->left.store(child, std::memory_order_release);
+  } else {
+    node->right.store(child, std::memory_order_release);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+int concurrent_map<Key, T, Compare>::Height(const node_type *node) {
+  return node == nullptr ? 0 : node->height.load();
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::Lock(node_type *node) {
+  uint64_t version = node->version.load(std::memory_order_relaxed);
+  for (unsigned spins = 0;; ++spins) {
+    if (!(version & kLocked) &&
+        node->version.compare_exchange_weak(version, version | kLocked,
+                                            std::memory_order_acquire,
+                                            std::memory_order_relaxed)) {
+      return;
+    }
+    // Владелец блокировки мог быть вытеснен: долго крутиться бесполезно
+    if (spins >= 64) std::this_thread::yield();
+    version = node->version.load(std::memory_order_relaxed);
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::Unlock(node_type *node) {
+  node->version.fetch_and(~kLocked, std::memory_order_release);
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::WaitUntilNotShrinking(
+    const node_type *node) {
+  for (unsigned spins = 0;
+       node->version.load(std::memory_order_acquire) & kShrinking; ++spins) {
+    if (spins >= 64) std::this_thread::yield();
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::Changed(const node_type *node,
+                                              uint64_t version) {
+  return ((node->version.load(std::memory_order_acquire) ^ version) &
+          ~kLocked) != 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::Result
+concurrent_map<Key, T, Compare>::AttemptGet(const key_type &key,
+                                            const node_type *node, int dir,
+                                            uint64_t version,
+                                            mapped_type *out) const {
+  while (true) {
+    node_type *child = Child(node, dir);
+    // Пока версия node прежняя, ключ не мог покинуть поддерево node, и
+    // прочитанная ссылка на потомка годится для спуска
+    if (Changed(node, version)) return Result::kRetry;
+    if (child == nullptr) return Result::kAbsent;
+    int next = Direction(key, child);
+    if (next == 0) {
+      Value *box = child->value.load(std::memory_order_acquire);
+      if (box == nullptr) return Result::kAbsent;
+      if (out != nullptr) *out = box->value;
+      return Result::kPresent;
+    }
+    uint64_t child_version = child->version.load(std::memory_order_acquire);
+    if (child_version & kShrinking) {
+      WaitUntilNotShrinking(child);
+    } else if (!(child_version & kUnlinked) && child == Child(node, dir)) {
+      if (Changed(node, version)) return Result::kRetry;
+      Result result = AttemptGet(key, child, next, child_version, out);
+      if (result != Result::kRetry) return result;
+    }
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::Result
+concurrent_map<Key, T, Compare>::Update(const key_type &key, Mode mode,
+                                        Value *box) {
+  Result result;
+  {
+    EpochDomain::Guard guard;
+    do {
+      result = AttemptUpdate(key, mode, box, nullptr, &holder_,
+                             holder_.version.load());
+    } while (result == Result::kRetry);
+  }
+  delete box;
+  if (mode == Mode::kErase && result == Result::kPresent) {
+    size_.fetch_sub(1, std::memory_order_relaxed);
+  } else if (mode != Mode::kErase && result == Result::kAbsent) {
+    size_.fetch_add(1, std::memory_order_relaxed);
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::Result
+concurrent_map<Key, T, Compare>::AttemptUpdate(const key_type &key,
+                                               Mode mode, Value *&box,
+                                               node_type *parent,
+                                               node_type *node,
+                                               uint64_t version) {
+  int dir = Direction(key, node);
+  if (dir == 0) return AttemptNodeUpdate(mode, box, parent, node);
+  while (true) {
+    node_type *child = Child(node, dir);
+    if (Changed(node, version)) return Result::kRetry;
+    if (child == nullptr) {
+      if (mode == Mode::kErase) return Result::kAbsent;
+      // Новый лист подвешивается под заблокированным node. Блокировка
+      // не дает начаться поворотам, а версия подтверждает, что прошлые
+      // повороты не увели key из поддерева node
+      node_type *damaged = nullptr;
+      bool inserted = false;
+      Lock(node);
+      if (Changed(node, version)) {
+        Unlock(node);
+        return Result::kRetry;
+      }
+      if (Child(node, dir) == nullptr) {
+        SetChild(node, dir, new node_type(key, box, node));
+        box = nullptr;
+        inserted = true;
+        damaged = FixHeight(node);
+      }
+      Unlock(node);
+      if (inserted) {
+        FixHeightAndRebalance(damaged);
+        return Result::kAbsent;
+      }
+      // Другой поток успел вставить потомка: шаг повторяется
+    } else {
+      uint64_t child_version = child->version.load(std::memory_order_acquire);
+      if (child_version & (kShrinking | kUnlinked)) {
+        WaitUntilNotShrinking(child);
+      } else if (child == Child(node, dir)) {
+        if (Changed(node, version)) return Result::kRetry;
+        Result result =
+            AttemptUpdate(key, mode, box, node, child, child_version);
+        if (result != Result::kRetry) return result;
+      }
+    }
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::Result
+concurrent_map<Key, T, Compare>::AttemptNodeUpdate(Mode mode, Value *&box,
+                                                   node_type *parent,
+                                                   node_type *node) {
+  if (mode == Mode::kErase) {
+    if (node->value.load(std::memory_order_acquire) == nullptr) {
+      return Result::kAbsent;
+    }
+    if (node->left.load() == nullptr || node->right.load() == nullptr) {
+      // Узел можно вырезать: нужны блокировки родителя и узла
+      Lock(parent);
+      if ((parent->version.load() & kUnlinked) ||
+          node->parent.load() != parent) {
+        Unlock(parent);
+        return Result::kRetry;
+      }
+      Lock(node);
+      Value *prev = node->value.load();
+      if (prev == nullptr) {
+        Unlock(node);
+        Unlock(parent);
+        return Result::kAbsent;
+      }
+      if (!AttemptUnlink(parent, node)) {
+        Unlock(node);
+        Unlock(parent);
+        return Result::kRetry;
+      }
+      Unlock(node);
+      node_type *damaged = FixHeight(parent);
+      Unlock(parent);
+      Retire(prev);
+      Retire(node);
+      FixHeightAndRebalance(damaged);
+      return Result::kPresent;
+    }
+  }
+
+  Lock(node);
+  if (node->version.load() & kUnlinked) {
+    Unlock(node);
+    return Result::kRetry;
+  }
+  Value *prev = node->value.load();
+  if (mode == Mode::kErase) {
+    if (prev == nullptr) {
+      Unlock(node);
+      return Result::kAbsent;
+    }
+    // Пока ждали блокировку, у узла мог пропасть потомок: тогда узел
+    // нужно вырезать, а не оставлять развилкой
+    if (node->left.load() == nullptr || node->right.load() == nullptr) {
+      Unlock(node);
+      return Result::kRetry;
+    }
+    node->value.store(nullptr, std::memory_order_release);
+    Unlock(node);
+    Retire(prev);
+    return Result::kPresent;
+  }
+  if (mode == Mode::kInsert && prev != nullptr) {
+    Unlock(node);
+    return Result::kPresent;
+  }
+  node->value.store(box, std::memory_order_release);
+  box = nullptr;
+  Unlock(node);
+  if (prev == nullptr) return Result::kAbsent;
+  Retire(prev);
+  return Result::kPresent;
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::AttemptUnlink(node_type *parent,
+                                                    node_type *node) {
+  node_type *parent_left = parent->left.load();
+  node_type *parent_right = parent->right.load();
+  if (parent_left != node && parent_right != node) return false;
+  node_type *left = node->left.load();
+  node_type *right = node->right.load();
+  if (left != nullptr && right != nullptr) return false;
+
+  node_type *splice = left != nullptr ? left : right;
+  if (parent_left == node) {
+    parent->left.store(splice, std::memory_order_release);
+  } else {
+    parent->right.store(splice, std::memory_order_release);
+  }
+  if (splice != nullptr) {
+    splice->parent.store(parent);
+  }
+  node->version.store(kUnlinked | kLocked, std::memory_order_release);
+  node->value.store(nullptr, std::memory_order_release);
+  return true;
+}
+
+template <typename Key, typename T, typename Compare>
+int concurrent_map<Key, T, Compare>::NodeCondition(node_type *node) const {
+  node_type *left = node->left.load(std::memory_order_acquire);
+  node_type *right = node->right.load(std::memory_order_acquire);
+  if ((left == nullptr || right == nullptr) &&
+      node->value.load(std::memory_order_acquire) == nullptr) {
+    return kUnlinkRequired;
+  }
+  int height = node->height.load(std::memory_order_relaxed);
+  int hl = Height(left);
+  int hr = Height(right);
+  int balance = hl - hr;
+  if (balance < -1 || balance > 1) return kRebalanceRequired;
+  int replacement = 1 + std::max(hl, hr);
+  return height != replacement ? replacement : kNothingRequired;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::FixHeight(node_type *node) {
+  int condition = NodeCondition(node);
+  if (condition == kRebalanceRequired || condition == kUnlinkRequired) {
+    return node;
+  }
+  if (condition == kNothingRequired) return nullptr;
+  // Высота узла изменилась, и родителю тоже может понадобиться починка.
+  // Поворот может перевесить node к другому родителю, не блокируя node.
+  // Запись высоты здесь и запись parent в повороте - seq_cst, как и их
+  // чтения после: тогда либо здесь виден новый родитель, либо поворот
+  // видит новую высоту
+  node->height.store(condition);
+  return node->parent.load();
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::FixHeightAndRebalance(node_type *node) {
+  // Поворот меняет высоту поддерева parent, но возвращает для починки
+  // более глубокий узел, и если его починка не изменит высот, до parent
+  // цепочка не дойдет. Поэтому parent откладывается и проверяется после
+  // нее (у Bronson et al. такая починка теряется)
+  static_assert(kPendingFixes >= [] {
+    // В AVL-дереве высоты h не меньше F(h + 2) - 1 узлов
+    std::size_t previous = 1, current = 2;
+    int height = 1;
+    while (current - 1 <= std::numeric_limits<std::size_t>::max() - previous) {
+      std::size_t next = previous + current;
+      previous = current;
+      current = next;
+      ++height;
+    }
+    return height;
+  }(), "pending stack is shallower than the tallest AVL tree");
+  node_type *pending[kPendingFixes];
+  int pending_size = 0;
+  // Первый родитель, не поместившийся в pending, и подъем от него
+  node_type *overflow = nullptr;
+  bool walk_up = false;
+  while (true) {
+    // У держателя корня нет родителя: на нем подъем заканчивается
+    int condition = kNothingRequired;
+    node_type *up = node == nullptr
+                        ? nullptr
+                        : node->parent.load(std::memory_order_acquire);
+    if (up != nullptr &&
+        !(node->version.load(std::memory_order_acquire) & kUnlinked)) {
+      condition = NodeCondition(node);
+    }
+    if (condition == kNothingRequired) {
+      if (pending_size != 0) {
+        node = pending[--pending_size];
+      } else if (overflow != nullptr) {
+        node = overflow;
+        overflow = nullptr;
+        walk_up = true;
+      } else if (walk_up && up != nullptr) {
+        node = up;
+      } else {
+        return;
+      }
+    } else if (condition != kUnlinkRequired &&
+               condition != kRebalanceRequired) {
+      Lock(node);
+      node_type *next = FixHeight(node);
+      Unlock(node);
+      node = next;
+    } else {
+      node_type *parent = node->parent.load(std::memory_order_acquire);
+      Lock(parent);
+      if (!(parent->version.load() & kUnlinked) &&
+          node->parent.load() == parent) {
+        Lock(node);
+        node_type *next = Rebalance(parent, node);
+        Unlock(node);
+        // Повтор на том же parent не откладывает его второй раз
+        if (next != nullptr &&
+            (pending_size == 0 || pending[pending_size - 1] != parent)) {
+          if (pending_size < kPendingFixes) {
+            pending[pending_size++] = parent;
+          } else if (overflow == nullptr) {
+            overflow = parent;
+          }
+        }
+        node = next;
+      }
+      Unlock(parent);
+    }
+  }
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::Rebalance(node_type *parent,
+                                           node_type *node) {
+  node_type *left = node->left.load();
+  node_type *right = node->right.load();
+  if ((left == nullptr || right == nullptr) && node->value.load() == nullptr) {
+    if (AttemptUnlink(parent, node)) {
+      Retire(node);
+      return FixHeight(parent);
+    }
+    return node;
+  }
+  int height = node->height.load(std::memory_order_relaxed);
+  int hl0 = Height(left);
+  int hr0 = Height(right);
+  int replacement = 1 + std::max(hl0, hr0);
+  int balance = hl0 - hr0;
+  if (balance > 1) return RebalanceToRight(parent, node, left, hr0);
+  if (balance < -1) return RebalanceToLeft(parent, node, right, hl0);
+  if (replacement != height) {
+    node->height.store(replacement, std::memory_order_relaxed);
+    return FixHeight(parent);
+  }
+  return nullptr;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::RebalanceToRight(node_type *parent,
+                                                  node_type *node,
+                                                  node_type *left, int hr0) {
+  // Левое поддерево слишком высокое: правый поворот, а если у левого
+  // потомка выше правое поддерево - сначала левый поворот вокруг него
+  Lock(left);
+  node_type *result = node;
+  int hl = left->height.load(std::memory_order_relaxed);
+  if (hl - hr0 > 1) {
+    node_type *left_right = left->right.load();
+    int hll0 = Height(left->left.load());
+    int hlr0 = Height(left_right);
+    if (hll0 >= hlr0) {
+      result =
+          RotateRight(parent, node, left, hr0, hll0, left_right, hlr0);
+    } else {
+      Lock(left_right);
+      int hlr = left_right->height.load(std::memory_order_relaxed);
+      int hlrl = Height(left_right->left.load());
+      int b = hll0 - hlrl;
+      if (hll0 >= hlr) {
+        result = RotateRight(parent, node, left, hr0, hll0, left_right, hlr);
+        Unlock(left_right);
+      } else if (b >= -1 && b <= 1) {
+        result = RotateRightOverLeft(parent, node, left, hr0, hll0,
+                                     left_right, hlrl);
+        Unlock(left_right);
+      } else {
+        // Двойной поворот разбалансировал бы left: сначала чинится он,
+        // node будет сбалансирован позже
+        Unlock(left_right);
+        result = RebalanceToLeft(node, left, left_right, hll0);
+      }
+    }
+  }
+  Unlock(left);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::RebalanceToLeft(node_type *parent,
+                                                 node_type *node,
+                                                 node_type *right, int hl0) {
+  Lock(right);
+  node_type *result = node;
+  int hr = right->height.load(std::memory_order_relaxed);
+  if (hl0 - hr < -1) {
+    node_type *right_left = right->left.load();
+    int hrl0 = Height(right_left);
+    int hrr0 = Height(right->right.load());
+    if (hrr0 >= hrl0) {
+      result = RotateLeft(parent, node, hl0, right, right_left, hrl0, hrr0);
+    } else {
+      Lock(right_left);
+      int hrl = right_left->height.load(std::memory_order_relaxed);
+      int hrlr = Height(right_left->right.load());
+      int b = hrr0 - hrlr;
+      if (hrr0 >= hrl) {
+        result = RotateLeft(parent, node, hl0, right, right_left, hrl, hrr0);
+        Unlock(right_left);
+      } else if (b >= -1 && b <= 1) {
+        result = RotateLeftOverRight(parent, node, hl0, right, right_left,
+                                     hrr0, hrlr);
+        Unlock(right_left);
+      } else {
+        Unlock(right_left);
+        result = RebalanceToRight(node, right, right_left, hrr0);
+      }
+    }
+  }
+  Unlock(right);
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::RotateRight(node_type *parent,
+                                             node_type *node,
+                                             node_type *left, int hr,
+                                             int hll, node_type *left_right,
+                                             int hlr) {
+  uint64_t version = node->version.load(std::memory_order_relaxed);
+  node_type *parent_left = parent->left.load();
+  // node теряет ключи left: читатели внутри node повторят шаг. left
+  // только приобретает ключи, и спуск через него остается верным, если
+  // node.left сменить раньше, чем left.right
+  node->version.store(version | kShrinking, std::memory_order_release);
+  node->left.store(left_right, std::memory_order_release);
+  if (left_right != nullptr) {
+    left_right->parent.store(node);
+  }
+  left->right.store(node, std::memory_order_release);
+  node->parent.store(left, std::memory_order_release);
+  if (parent_left == node) {
+    parent->left.store(left, std::memory_order_release);
+  } else {
+    parent->right.store(left, std::memory_order_release);
+  }
+  left->parent.store(parent, std::memory_order_release);
+
+  // Высота перевешенного left_right перечитывается после смены его
+  // родителя (см. FixHeight)
+  hlr = Height(left_right);
+  int hn = 1 + std::max(hlr, hr);
+  node->height.store(hn, std::memory_order_relaxed);
+  left->height.store(1 + std::max(hll, hn), std::memory_order_relaxed);
+  node->version.store(version + kShrinkStep, std::memory_order_release);
+
+  // Повреждены parent, node и left; чинится столько, сколько позволяют
+  // взятые блокировки, начиная с самого глубокого node
+  int balance_node = hlr - hr;
+  if (balance_node < -1 || balance_node > 1) return node;
+  if ((left_right == nullptr || hr == 0) && node->value.load() == nullptr) {
+    return node;
+  }
+  int balance_left = hll - hn;
+  if (balance_left < -1 || balance_left > 1) return left;
+  if (hll == 0 && left->value.load() == nullptr) return left;
+  return FixHeight(parent);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::RotateLeft(node_type *parent,
+                                            node_type *node, int hl,
+                                            node_type *right,
+                                            node_type *right_left, int hrl,
+                                            int hrr) {
+  uint64_t version = node->version.load(std::memory_order_relaxed);
+  node_type *parent_left = parent->left.load();
+  node->version.store(version | kShrinking, std::memory_order_release);
+  node->right.store(right_left, std::memory_order_release);
+  if (right_left != nullptr) {
+    right_left->parent.store(node);
+  }
+  right->left.store(node, std::memory_order_release);
+  node->parent.store(right, std::memory_order_release);
+  if (parent_left == node) {
+    parent->left.store(right, std::memory_order_release);
+  } else {
+    parent->right.store(right, std::memory_order_release);
+  }
+  right->parent.store(parent, std::memory_order_release);
+
+  hrl = Height(right_left);
+  int hn = 1 + std::max(hl, hrl);
+  node->height.store(hn, std::memory_order_relaxed);
+  right->height.store(1 + std::max(hn, hrr), std::memory_order_relaxed);
+  node->version.store(version + kShrinkStep, std::memory_order_release);
+
+  int balance_node = hrl - hl;
+  if (balance_node < -1 || balance_node > 1) return node;
+  if ((right_left == nullptr || hl == 0) && node->value.load() == nullptr) {
+    return node;
+  }
+  int balance_right = hrr - hn;
+  if (balance_right < -1 || balance_right > 1) return right;
+  if (hrr == 0 && right->value.load() == nullptr) return right;
+  return FixHeight(parent);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::RotateRightOverLeft(
+    node_type *parent, node_type *node, node_type *left, int hr, int hll,
+    node_type *left_right, int hlrl) {
+  uint64_t node_version = node->version.load(std::memory_order_relaxed);
+  uint64_t left_version = left->version.load(std::memory_order_relaxed);
+  node_type *parent_left = parent->left.load();
+  node_type *left_right_left = left_right->left.load();
+  node_type *left_right_right = left_right->right.load();
+
+  // Ключи теряют и node, и left; left_right поднимается на их место
+  node->version.store(node_version | kShrinking, std::memory_order_release);
+  left->version.store(left_version | kShrinking, std::memory_order_release);
+  node->left.store(left_right_right, std::memory_order_release);
+  if (left_right_right != nullptr) {
+    left_right_right->parent.store(node);
+  }
+  left->right.store(left_right_left, std::memory_order_release);
+  if (left_right_left != nullptr) {
+    left_right_left->parent.store(left);
+  }
+  left_right->left.store(left, std::memory_order_release);
+  left->parent.store(left_right, std::memory_order_release);
+  left_right->right.store(node, std::memory_order_release);
+  node->parent.store(left_right, std::memory_order_release);
+  if (parent_left == node) {
+    parent->left.store(left_right, std::memory_order_release);
+  } else {
+    parent->right.store(left_right, std::memory_order_release);
+  }
+  left_right->parent.store(parent, std::memory_order_release);
+
+  int hlrr = Height(left_right_right);
+  hlrl = Height(left_right_left);
+
+  int hn = 1 + std::max(hlrr, hr);
+  node->height.store(hn, std::memory_order_relaxed);
+  int hl = 1 + std::max(hll, hlrl);
+  left->height.store(hl, std::memory_order_relaxed);
+  left_right->height.store(1 + std::max(hl, hn), std::memory_order_relaxed);
+  node->version.store(node_version + kShrinkStep, std::memory_order_release);
+  left->version.store(left_version + kShrinkStep, std::memory_order_release);
+
+  // Развилка left могла остаться с одним потомком. В отличие от Bronson
+  // et al. поворот из-за этого не откладывается (иначе node может так и
+  // остаться несбалансированным): left вырезается сразу, его блокировка и
+  // блокировка нового родителя уже взяты
+  if ((left->left.load() == nullptr || left->right.load() == nullptr) &&
+      left->value.load() == nullptr) {
+    AttemptUnlink(left_right, left);
+    Retire(left);
+    hl = Height(left_right->left.load());
+    left_right->height.store(1 + std::max(hl, hn), std::memory_order_relaxed);
+  }
+
+  int balance_node = hlrr - hr;
+  if (balance_node < -1 || balance_node > 1) return node;
+  if ((left_right_right == nullptr || hr == 0) &&
+      node->value.load() == nullptr) {
+    return node;
+  }
+  int balance_left_right = hl - hn;
+  if (balance_left_right < -1 || balance_left_right > 1) return left_right;
+  return FixHeight(parent);
+}
+
+template <typename Key, typename T, typename Compare>
+typename concurrent_map<Key, T, Compare>::node_type *
+concurrent_map<Key, T, Compare>::RotateLeftOverRight(
+    node_type *parent, node_type *node, int hl, node_type *right,
+    node_type *right_left, int hrr, int hrlr) {
+  uint64_t node_version = node->version.load(std::memory_order_relaxed);
+  uint64_t right_version = right->version.load(std::memory_order_relaxed);
+  node_type *parent_left = parent->left.load();
+  node_type *right_left_left = right_left->left.load();
+  node_type *right_left_right = right_left->right.load();
+
+  node->version.store(node_version | kShrinking, std::memory_order_release);
+  right->version.store(right_version | kShrinking, std::memory_order_release);
+  node->right.store(right_left_left, std::memory_order_release);
+  if (right_left_left != nullptr) {
+    right_left_left->parent.store(node);
+  }
+  right->left.store(right_left_right, std::memory_order_release);
+  if (right_left_right != nullptr) {
+    right_left_right->parent.store(right);
+  }
+  right_left->right.store(right, std::memory_order_release);
+  right->parent.store(right_left, std::memory_order_release);
+  right_left->left.store(node, std::memory_order_release);
+  node->parent.store(right_left, std::memory_order_release);
+  if (parent_left == node) {
+    parent->left.store(right_left, std::memory_order_release);
+  } else {
+    parent->right.store(right_left, std::memory_order_release);
+  }
+  right_left->parent.store(parent, std::memory_order_release);
+
+  int hrll = Height(right_left_left);
+  hrlr = Height(right_left_right);
+
+  int hn = 1 + std::max(hl, hrll);
+  node->height.store(hn, std::memory_order_relaxed);
+  int hr = 1 + std::max(hrlr, hrr);
+  right->height.store(hr, std::memory_order_relaxed);
+  right_left->height.store(1 + std::max(hn, hr), std::memory_order_relaxed);
+  node->version.store(node_version + kShrinkStep, std::memory_order_release);
+  right->version.store(right_version + kShrinkStep,
+                       std::memory_order_release);
+
+  if ((right->left.load() == nullptr || right->right.load() == nullptr) &&
+      right->value.load() == nullptr) {
+    AttemptUnlink(right_left, right);
+    Retire(right);
+    hr = Height(right_left->right.load());
+    right_left->height.store(1 + std::max(hn, hr), std::memory_order_relaxed);
+  }
+
+  int balance_node = hrll - hl;
+  if (balance_node < -1 || balance_node > 1) return node;
+  if ((right_left_left == nullptr || hl == 0) &&
+      node->value.load() == nullptr) {
+    return node;
+  }
+  int balance_right_left = hr - hn;
+  if (balance_right_left < -1 || balance_right_left > 1) return right_left;
+  return FixHeight(parent);
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::Retire(node_type *node) {
+  EpochDomain::Global().Retire(node, &DeleteNode);
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::Retire(Value *box) {
+  EpochDomain::Global().Retire(box, &DeleteValue);
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::DeleteNode(void *node) {
+  node_type *typed = static_cast<node_type *>(node);
+  typed->key.~Key();
+  delete typed;
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::DeleteValue(void *box) {
+  delete static_cast<Value *>(box);
+}
+
+template <typename Key, typename T, typename Compare>
+void concurrent_map<Key, T, Compare>::DestroyTree(node_type *node) {
+  if (node == nullptr) return;
+  DestroyTree(node->left.load());
+  DestroyTree(node->right.load());
+  delete node->value.load();
+  DeleteNode(node);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename F>
+void concurrent_map<Key, T, Compare>::ForEach(const node_type *node, F &f) {
+  if (node == nullptr) return;
+  ForEach(node->left.load(), f);
+  Value *box = node->value.load();
+  if (box != nullptr) f(node->key, box->value);
+  ForEach(node->right.load(), f);
+}
+
+template <typename Key, typename T, typename Compare>
+bool concurrent_map<Key, T, Compare>::IsValid(const node_type *node,
+                                              const key_type *lo,
+                                              const key_type *hi,
+                                              int &height) const {
+  height = 0;
+  if (node == nullptr) return true;
+  if ((lo != nullptr && !comp_(*lo, node->key)) ||
+      (hi != nullptr && !comp_(node->key, *hi))) {
+    return false;
+  }
+  node_type *left = node->left.load();
+  node_type *right = node->right.load();
+  if ((left != nullptr && left->parent.load() != node) ||
+      (right != nullptr && right->parent.load() != node)) {
+    return false;
+  }
+  // Развилка без значения держится, только пока у нее два потомка
+  if ((left == nullptr || right == nullptr) && node->value.load() == nullptr) {
+    return false;
+  }
+  int hl = 0;
+  int hr = 0;
+  if (!IsValid(left, lo, &node->key, hl) ||
+      !IsValid(right, &node->key, hi, hr)) {
+    return false;
+  }
+  height = 1 + std::max(hl, hr);
+  return hl - hr >= -1 && hl - hr <= 1 && node->height.load() == height;
+}
+
+}  // namespace s21
@@ -0,0 +1,180 @@
+#include "../include/s21_concurrent_queue.h"
+
+namespace s21 {
+
+template <typename T>
+concurrent_queue<T>::concurrent_queue()
+    : concurrent_queue(kDefaultCapacity) {}
+
+template <typename T>
+concurrent_queue<T>::concurrent_queue(size_type capacity)
+    : buffer_(nullptr),
+      mask_(RoundUp(capacity) - 1),
+      enqueue_pos_(0),
+      dequeue_pos_(0) {
+  buffer_ = new Slot[mask_ + 1];
+  for (size_type i = 0; i <= mask_; ++i) {
+    buffer_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+concurrent_queue<T>::concurrent_queue(
+    std::initializer_list<value_type> const &items)
+    : concurrent_queue(items.size() > kDefaultCapacity ? items.size()
+                                                       : kDefaultCapacity) {
+  for (const value_type &item : items) try_push(item);
+}
+
+template <typename T>
+concurrent_queue<T>::~concurrent_queue() {
+  size_type end = enqueue_pos_.load(std::memory_order_relaxed);
+  for (size_type pos = dequeue_pos_.load(std::memory_order_relaxed);
+       pos != end; ++pos) {
+    buffer_[pos & mask_].value()->~T();
+  }
+  delete[] buffer_;
+}
+
+template <typename T>
+void concurrent_queue<T>::push(const_reference value) {
+  for (unsigned spins = 0; !try_push(value);) Backoff(spins);
+}
+
+template <typename T>
+void concurrent_queue<T>::pop(reference value) {
+  for (unsigned spins = 0; !try_pop(value);) Backoff(spins);
+}
+
+template <typename T>
+bool concurrent_queue<T>::try_push(const_reference value) {
+  size_type pos;
+  if (Claim(enqueue_pos_, 0, 1, pos) == 0) return false;
+  Slot &slot = buffer_[pos & mask_];
+  new (slot.storage) T(value);
+  slot.sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool concurrent_queue<T>::try_push(value_type &&value) {
+  size_type pos;
+  if (Claim(enqueue_pos_, 0, 1, pos) == 0) return false;
+  Slot &slot = buffer_[pos & mask_];
+  new (slot.storage) T(std::move(value));
+  slot.sequence.store(pos + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+bool concurrent_queue<T>::try_pop(reference value) {
+  size_type pos;
+  if (Claim(dequeue_pos_, 1, 1, pos) == 0) return false;
+  Slot &slot = buffer_[pos & mask_];
+  value = std::move(*slot.value());
+  slot.value()->~T();
+  slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+  return true;
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::try_push_many(
+    const value_type *items, size_type count) {
+  size_type pos;
+  size_type claimed = Claim(enqueue_pos_, 0, count, pos);
+  // Каждая ячейка публикуется отдельно: потребитель может забрать первые
+  // элементы, пока пишутся следующие
+  for (size_type i = 0; i < claimed; ++i) {
+    Slot &slot = buffer_[(pos + i) & mask_];
+    new (slot.storage) T(items[i]);
+    slot.sequence.store(pos + i + 1, std::memory_order_release);
+  }
+  return claimed;
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::try_pop_many(
+    value_type *out, size_type count) {
+  size_type pos;
+  size_type claimed = Claim(dequeue_pos_, 1, count, pos);
+  for (size_type i = 0; i < claimed; ++i) {
+    Slot &slot = buffer_[(pos + i) & mask_];
+    out[i] = std::move(*slot.value());
+    slot.value()->~T();
+    slot.sequence.store(pos + i + mask_ + 1, std::memory_order_release);
+  }
+  return claimed;
+}
+
+template <typename T>
+template <typename... Args>
+void concurrent_queue<T>::insert_many_back(Args &&...args) {
+  (push(std::forward<Args>(args)), ...);
+}
+
+template <typename T>
+bool concurrent_queue<T>::empty() const {
+  return size() == 0;
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::size() const {
+  // Счетчики читаются не одновременно: потребитель может обогнать
+  // прочитанную позицию производителя
+  size_type dequeued = dequeue_pos_.load(std::memory_order_relaxed);
+  size_type enqueued = enqueue_pos_.load(std::memory_order_relaxed);
+  return enqueued > dequeued ? enqueued - dequeued : 0;
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::capacity()
+    const {
+  return mask_ + 1;
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::Claim(
+    std::atomic<size_type> &position, size_type ready, size_type count,
+    size_type &pos) {
+  pos = position.load(std::memory_order_relaxed);
+  while (true) {
+    size_type ready_slots = 0;
+    while (ready_slots < count &&
+           buffer_[(pos + ready_slots) & mask_].sequence.load(
+               std::memory_order_acquire) == pos + ready_slots + ready) {
+      ++ready_slots;
+    }
+    if (ready_slots > 0) {
+      // При неудаче CAS записывает в pos свежую позицию
+      if (position.compare_exchange_weak(pos, pos + ready_slots,
+                                         std::memory_order_relaxed)) {
+        return ready_slots;
+      }
+      continue;
+    }
+    size_type sequence =
+        buffer_[pos & mask_].sequence.load(std::memory_order_acquire);
+    // Номер ячейки отстает от позиции: очередь полна для записи или пуста
+    // для чтения. Номер впереди: pos устарел, его уже заняли
+    auto diff = static_cast<std::ptrdiff_t>(sequence - (pos + ready));
+    if (diff < 0) return 0;
+    if (diff > 0) pos = position.load(std::memory_order_relaxed);
+  }
+}
+
+template <typename T>
+void concurrent_queue<T>::Backoff(unsigned &spins) {
+  // Другой поток мог быть вытеснен, пока держит ячейку: после короткого
+  // ожидания процессор отдается ему
+  if (++spins >= 64) std::this_thread::yield();
+}
+
+template <typename T>
+typename concurrent_queue<T>::size_type concurrent_queue<T>::RoundUp(
+    size_type capacity) {
+  size_type rounded = 2;
+  while (rounded < capacity) rounded *= 2;
+  return rounded;
+}
+
+}  // namespace s21
@@ -0,0 +1,283 @@
+#include "../include/s21_counted_multiset.h"
+
+namespace s21 {
+
+template <typename Key, typename Compare, typename NodeAllocator>
+counted_multiset<Key, Compare, NodeAllocator>::counted_multiset(
+    const std::initializer_list<value_type> &items)
+    : counted_multiset() {
+  assign_sorted(items.begin(), items.end());
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+template <typename InputIt>
+counted_multiset<Key, Compare, NodeAllocator>::counted_multiset(
+    InputIt first, InputIt last)
+    : counted_multiset() {
+  assign_sorted(first, last);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+counted_multiset<Key, Compare, NodeAllocator> &
+counted_multiset<Key, Compare, NodeAllocator>::operator=(
+    counted_multiset &&other) {
+  if (&other != this) {
+    tree_type::operator=(std::move(other));
+    total_ = other.total_;
+    other.total_ = 0;
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+template <typename InputIt>
+void counted_multiset<Key, Compare, NodeAllocator>::assign_sorted(
+    InputIt first, InputIt last) {
+  vector<key_type> keys;
+  for (; first != last; ++first) keys.push_back(*first);
+  bool sorted = true;
+  for (size_type i = 1; i < keys.size() && sorted; ++i) {
+    sorted = !this->comp_(keys[i], keys[i - 1]);
+  }
+  if (!sorted) std::sort(keys.begin(), keys.end(), this->comp_);
+  // Серии равных ключей превращаются в пары (ключ, число копий)
+  vector<std::pair<key_type, size_type>> items;
+  for (size_type i = 0; i < keys.size();) {
+    size_type run = i + 1;
+    while (run < keys.size() && !this->comp_(keys[i], keys[run])) ++run;
+    items.push_back(std::make_pair(keys[i], run - i));
+    i = run;
+  }
+  this->AssignSorted(items, true);
+  total_ = keys.size();
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::begin() {
+  return iterator(tree_type::begin(), 0);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::end() {
+  return iterator(tree_type::end(), 0);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+bool counted_multiset<Key, Compare, NodeAllocator>::empty() const {
+  return total_ == 0;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::size_type
+counted_multiset<Key, Compare, NodeAllocator>::size() const {
+  return total_;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::size_type
+counted_multiset<Key, Compare, NodeAllocator>::distinct_size() const {
+  return tree_type::size();
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::insert(
+    const value_type &value) {
+  return insert(value, 1);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::insert(const value_type &value,
+                                                      size_type n) {
+  if (n == 0) return find(value);
+  bool inserted = false;
+  node_type *node = nullptr;
+  this->root_ =
+      this->Emplace(this->root_, value, node, inserted, size_type(0));
+  node->value += n;
+  total_ += n;
+  return MakeIterator(node, node->value - n);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+template <class... Args>
+vector<std::pair<typename counted_multiset<Key, Compare,
+                                           NodeAllocator>::iterator,
+                 bool>>
+counted_multiset<Key, Compare, NodeAllocator>::insert_many(Args &&...args) {
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(
+            std::make_pair(insert(std::forward<Args>(args)), true)));
+  return results;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+void counted_multiset<Key, Compare, NodeAllocator>::erase(iterator pos) {
+  node_type *node = tree_type::GetNode(pos.node_);
+  if (node != nullptr) EraseOne(node);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+bool counted_multiset<Key, Compare, NodeAllocator>::erase(
+    const key_type &key) {
+  node_type *node = this->FindNode(key);
+  if (node == nullptr) return false;
+  EraseOne(node);
+  return true;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::size_type
+counted_multiset<Key, Compare, NodeAllocator>::erase_all(
+    const key_type &key) {
+  node_type *node = this->FindNode(key);
+  if (node == nullptr) return 0;
+  size_type removed = node->value;
+  total_ -= removed;
+  this->EraseNode(node);
+  return removed;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+void counted_multiset<Key, Compare, NodeAllocator>::clear() {
+  tree_type::clear();
+  total_ = 0;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+void counted_multiset<Key, Compare, NodeAllocator>::swap(
+    counted_multiset &other) {
+  tree_type::swap(other);
+  std::swap(total_, other.total_);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+void counted_multiset<Key, Compare, NodeAllocator>::merge(
+    counted_multiset &other) {
+  if (this == &other) return;
+  for (tree_iterator it = other.tree_type::begin();
+       it != other.tree_type::end(); ++it) {
+    insert(it.first(), it.second());
+  }
+  other.clear();
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::size_type
+counted_multiset<Key, Compare, NodeAllocator>::count(
+    const key_type &key) const {
+  node_type *node = this->FindNode(key);
+  return node == nullptr ? 0 : node->value;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+bool counted_multiset<Key, Compare, NodeAllocator>::contains(
+    const key_type &key) const {
+  return this->FindNode(key) != nullptr;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::find(const key_type &key) {
+  return MakeIterator(this->FindNode(key), 0);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::lower_bound(
+    const key_type &key) {
+  return MakeIterator(this->LowerBound(key), 0);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::upper_bound(
+    const key_type &key) {
+  return MakeIterator(this->UpperBound(key), 0);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+std::pair<typename counted_multiset<Key, Compare, NodeAllocator>::iterator,
+          typename counted_multiset<Key, Compare, NodeAllocator>::iterator>
+counted_multiset<Key, Compare, NodeAllocator>::equal_range(
+    const key_type &key) {
+  // Все копии ключа лежат в одном узле, и конец диапазона - первая
+  // копия следующего узла
+  iterator first = lower_bound(key);
+  node_type *node = tree_type::GetNode(first.node_);
+  if (node == nullptr || this->comp_(key, node->key)) return {first, first};
+  tree_iterator next = first.node_;
+  return {first, iterator(++next, 0)};
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::MakeIterator(node_type *node,
+                                                            size_type index) {
+  return iterator(tree_iterator(node, this), node == nullptr ? 0 : index);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+void counted_multiset<Key, Compare, NodeAllocator>::EraseOne(
+    node_type *node) {
+  --total_;
+  if (--node->value == 0) this->EraseNode(node);
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator &
+counted_multiset<Key, Compare, NodeAllocator>::iterator::operator++() {
+  if (counted_multiset::GetNode(node_) == nullptr) return *this;
+  if (++index_ == node_.second()) {
+    ++node_;
+    index_ = 0;
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::iterator::operator++(int) {
+  iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator &
+counted_multiset<Key, Compare, NodeAllocator>::iterator::operator--() {
+  if (index_ > 0) {
+    --index_;
+    return *this;
+  }
+  --node_;
+  if (counted_multiset::GetNode(node_) != nullptr) {
+    index_ = node_.second() - 1;
+  }
+  return *this;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+typename counted_multiset<Key, Compare, NodeAllocator>::iterator
+counted_multiset<Key, Compare, NodeAllocator>::iterator::operator--(int) {
+  iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+bool counted_multiset<Key, Compare, NodeAllocator>::iterator::operator==(
+    const iterator &other) const {
+  return node_ == other.node_ && index_ == other.index_;
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+bool counted_multiset<Key, Compare, NodeAllocator>::iterator::operator!=(
+    const iterator &other) const {
+  return !(*this == other);
+}
+
+}  // namespace s21
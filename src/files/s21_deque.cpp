@@ -0,0 +1,316 @@
+#include "../include/s21_deque.h"
+
+namespace s21 {
+
+template <typename T>
+deque<T>::deque()
+    : map_(nullptr), map_size_(0), start_(0), size_(0), spare_(nullptr) {}
+
+template <typename T>
+deque<T>::deque(size_type n) : deque() {
+  for (size_type i = 0; i < n; ++i) EmplaceBack();
+}
+
+template <typename T>
+deque<T>::deque(std::initializer_list<value_type> const &items) : deque() {
+  for (const value_type &item : items) EmplaceBack(item);
+}
+
+template <typename T>
+deque<T>::deque(const deque &other) : deque() {
+  for (size_type i = 0; i < other.size_; ++i) EmplaceBack(other[i]);
+}
+
+template <typename T>
+deque<T>::deque(deque &&other) noexcept
+    : map_(other.map_),
+      map_size_(other.map_size_),
+      start_(other.start_),
+      size_(other.size_),
+      spare_(other.spare_) {
+  other.map_ = nullptr;
+  other.spare_ = nullptr;
+  other.map_size_ = other.start_ = other.size_ = 0;
+}
+
+template <typename T>
+deque<T>::~deque() {
+  clear();
+  DeallocateBlock(spare_);
+  delete[] map_;
+}
+
+template <typename T>
+deque<T> &deque<T>::operator=(const deque &other) {
+  if (this != &other) {
+    deque copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename T>
+deque<T> &deque<T>::operator=(deque &&other) noexcept {
+  if (this != &other) {
+    deque moved(std::move(other));
+    swap(moved);
+  }
+  return *this;
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::at(size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index is out of range");
+  return *Position(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::at(size_type pos) const {
+  if (pos >= size_) throw std::out_of_range("Index is out of range");
+  return *Position(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::operator[](size_type pos) {
+  return *Position(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::operator[](size_type pos) const {
+  return *Position(start_ + pos);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::front() {
+  if (size_ == 0) throw std::out_of_range("deque is empty");
+  return *Position(start_);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::front() const {
+  if (size_ == 0) throw std::out_of_range("deque is empty");
+  return *Position(start_);
+}
+
+template <typename T>
+typename deque<T>::reference deque<T>::back() {
+  if (size_ == 0) throw std::out_of_range("deque is empty");
+  return *Position(start_ + size_ - 1);
+}
+
+template <typename T>
+typename deque<T>::const_reference deque<T>::back() const {
+  if (size_ == 0) throw std::out_of_range("deque is empty");
+  return *Position(start_ + size_ - 1);
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename T>
+typename deque<T>::iterator deque<T>::end() {
+  return iterator(this, size_);
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::begin() const {
+  return const_iterator(this, 0);
+}
+
+template <typename T>
+typename deque<T>::const_iterator deque<T>::end() const {
+  return const_iterator(this, size_);
+}
+
+template <typename T>
+bool deque<T>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T>
+typename deque<T>::size_type deque<T>::size() const {
+  return size_;
+}
+
+template <typename T>
+typename deque<T>::size_type deque<T>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(T) / 2;
+}
+
+template <typename T>
+void deque<T>::clear() {
+  while (size_ > 0) pop_back();
+}
+
+template <typename T>
+void deque<T>::push_back(const_reference value) {
+  EmplaceBack(value);
+}
+
+template <typename T>
+void deque<T>::push_back(value_type &&value) {
+  EmplaceBack(std::move(value));
+}
+
+template <typename T>
+void deque<T>::push_front(const_reference value) {
+  EmplaceFront(value);
+}
+
+template <typename T>
+void deque<T>::push_front(value_type &&value) {
+  EmplaceFront(std::move(value));
+}
+
+template <typename T>
+template <typename... Args>
+typename deque<T>::reference deque<T>::emplace_back(Args &&...args) {
+  EmplaceBack(std::forward<Args>(args)...);
+  return *Position(start_ + size_ - 1);
+}
+
+template <typename T>
+template <typename... Args>
+typename deque<T>::reference deque<T>::emplace_front(Args &&...args) {
+  EmplaceFront(std::forward<Args>(args)...);
+  return *Position(start_);
+}
+
+template <typename T>
+void deque<T>::pop_back() {
+  if (size_ == 0) return;
+  size_type pos = start_ + size_ - 1;
+  Position(pos)->~T();
+  --size_;
+  if (size_ == 0 || pos % kBlockSize == 0) ReleaseBlock(pos);
+}
+
+template <typename T>
+void deque<T>::pop_front() {
+  if (size_ == 0) return;
+  size_type pos = start_;
+  Position(pos)->~T();
+  ++start_;
+  --size_;
+  if (size_ == 0 || start_ % kBlockSize == 0) ReleaseBlock(pos);
+}
+
+template <typename T>
+void deque<T>::swap(deque &other) noexcept {
+  std::swap(map_, other.map_);
+  std::swap(map_size_, other.map_size_);
+  std::swap(start_, other.start_);
+  std::swap(size_, other.size_);
+  std::swap(spare_, other.spare_);
+}
+
+template <typename T>
+template <typename... Args>
+void deque<T>::insert_many_back(Args &&...args) {
+  (EmplaceBack(std::forward<Args>(args)), ...);
+}
+
+template <typename T>
+template <typename... Args>
+void deque<T>::insert_many_front(Args &&...args) {
+  // Элементы добавляются в начало по одному, а затем переставляются в
+  // порядок аргументов
+  size_type count = 0;
+  ((EmplaceFront(std::forward<Args>(args)), ++count), ...);
+  for (size_type i = 0; i + 1 < count - i; ++i) {
+    std::swap((*this)[i], (*this)[count - 1 - i]);
+  }
+}
+
+template <typename T>
+T *deque<T>::Position(size_type pos) const {
+  return map_[pos / kBlockSize] + pos % kBlockSize;
+}
+
+template <typename T>
+void deque<T>::EnsureBlock(size_type pos) {
+  T *&block = map_[pos / kBlockSize];
+  if (block != nullptr) return;
+  if (spare_ != nullptr) {
+    block = spare_;
+    spare_ = nullptr;
+  } else {
+    block = AllocateBlock();
+  }
+}
+
+template <typename T>
+void deque<T>::ReleaseBlock(size_type pos) {
+  T *&block = map_[pos / kBlockSize];
+  if (spare_ == nullptr) {
+    spare_ = block;
+  } else {
+    DeallocateBlock(block);
+  }
+  block = nullptr;
+}
+
+template <typename T>
+void deque<T>::RecenterMap() {
+  size_type first = start_ / kBlockSize;
+  size_type used =
+      size_ == 0 ? 0 : (start_ + size_ - 1) / kBlockSize - first + 1;
+  size_type map_size = 2 * (used + 1);
+  if (map_size < kMinMapSize) map_size = kMinMapSize;
+  if (map_size < map_size_) map_size = map_size_;
+
+  T **map = new T *[map_size]();
+  size_type new_first = (map_size - used) / 2;
+  for (size_type i = 0; i < used; ++i) map[new_first + i] = map_[first + i];
+  delete[] map_;
+  map_ = map;
+  map_size_ = map_size;
+  start_ = new_first * kBlockSize + start_ % kBlockSize;
+}
+
+template <typename T>
+template <typename... Args>
+void deque<T>::EmplaceBack(Args &&...args) {
+  if (map_ == nullptr || (start_ + size_) / kBlockSize >= map_size_) {
+    RecenterMap();
+  }
+  size_type pos = start_ + size_;
+  EnsureBlock(pos);
+  try {
+    new (Position(pos)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    if (size_ == 0 || pos % kBlockSize == 0) ReleaseBlock(pos);
+    throw;
+  }
+  ++size_;
+}
+
+template <typename T>
+template <typename... Args>
+void deque<T>::EmplaceFront(Args &&...args) {
+  if (map_ == nullptr || start_ == 0) RecenterMap();
+  size_type pos = start_ - 1;
+  EnsureBlock(pos);
+  try {
+    new (Position(pos)) T(std::forward<Args>(args)...);
+  } catch (...) {
+    if (size_ == 0 || start_ % kBlockSize == 0) ReleaseBlock(pos);
+    throw;
+  }
+  --start_;
+  ++size_;
+}
+
+template <typename T>
+T *deque<T>::AllocateBlock() {
+  return std::allocator<T>().allocate(kBlockSize);
+}
+
+template <typename T>
+void deque<T>::DeallocateBlock(T *block) {
+  if (block != nullptr) std::allocator<T>().deallocate(block, kBlockSize);
+}
+
+}  // namespace s21
@@ -0,0 +1,111 @@
+#include "../include/s21_epoch.h"
+
+namespace s21 {
+
+inline EpochDomain &EpochDomain::Global() {
+  static EpochDomain domain;
+  return domain;
+}
+
+inline EpochDomain::~EpochDomain() {
+  // Потоков, читающих узлы, к этому моменту не осталось
+  Record *record = records_.load();
+  while (record != nullptr) {
+    for (size_t i = 0; i < record->limbo.size(); ++i) {
+      record->limbo[i].deleter(record->limbo[i].ptr);
+    }
+    Record *next = record->next;
+    delete record;
+    record = next;
+  }
+}
+
+inline EpochDomain::Guard::Guard() : record_(Global().ThisThread()) {
+  if (record_->depth++ > 0) return;
+  EpochDomain &domain = Global();
+  // Эпоха публикуется и перечитывается: если она успела сдвинуться до
+  // публикации, сдвиг мог не учесть этот поток
+  uint64_t epoch = domain.epoch_.load();
+  while (true) {
+    record_->state.store((epoch << 1) | 1);
+    uint64_t current = domain.epoch_.load();
+    if (current == epoch) break;
+    epoch = current;
+  }
+}
+
+inline EpochDomain::Guard::~Guard() {
+  if (--record_->depth == 0) record_->state.store(0);
+}
+
+inline void EpochDomain::Retire(void *ptr, void (*deleter)(void *)) {
+  Record *record = ThisThread();
+  record->limbo.push_back(Retired{ptr, deleter, epoch_.load()});
+  if (++record->retired_since_collect >= kCollectPeriod) {
+    record->retired_since_collect = 0;
+    TryAdvance();
+    Collect(record);
+  }
+}
+
+inline uint64_t EpochDomain::epoch() const { return epoch_.load(); }
+
+inline EpochDomain::Record *EpochDomain::ThisThread() {
+  // Запись закрепляется за потоком при первом обращении и возвращается
+  // в домен при его завершении вместе с еще не освобожденными узлами.
+  // Holder один на поток, поэтому домен тоже один - Global()
+  struct Holder {
+    EpochDomain *domain = nullptr;
+    Record *record = nullptr;
+    ~Holder() {
+      if (record == nullptr) return;
+      domain->TryAdvance();
+      domain->Collect(record);
+      record->in_use.store(false, std::memory_order_release);
+    }
+  };
+  static thread_local Holder holder;
+  if (holder.record != nullptr) return holder.record;
+
+  Record *record = records_.load(std::memory_order_acquire);
+  for (; record != nullptr; record = record->next) {
+    bool expected = false;
+    if (record->in_use.compare_exchange_strong(expected, true)) break;
+  }
+  if (record == nullptr) {
+    record = new Record;
+    record->in_use.store(true);
+    Record *head = records_.load();
+    do {
+      record->next = head;
+    } while (!records_.compare_exchange_weak(head, record));
+  }
+  holder.domain = this;
+  holder.record = record;
+  return record;
+}
+
+inline void EpochDomain::TryAdvance() {
+  uint64_t epoch = epoch_.load();
+  for (Record *record = records_.load(); record != nullptr;
+       record = record->next) {
+    uint64_t state = record->state.load();
+    if ((state & 1) && (state >> 1) != epoch) return;
+  }
+  epoch_.compare_exchange_strong(epoch, epoch + 1);
+}
+
+inline void EpochDomain::Collect(Record *record) {
+  uint64_t epoch = epoch_.load();
+  vector<Retired> kept;
+  for (size_t i = 0; i < record->limbo.size(); ++i) {
+    if (record->limbo[i].epoch + 2 <= epoch) {
+      record->limbo[i].deleter(record->limbo[i].ptr);
+    } else {
+      kept.push_back(record->limbo[i]);
+    }
+  }
+  record->limbo.swap(kept);
+}
+
+}  // namespace s21
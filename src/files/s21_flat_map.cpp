@@ -0,0 +1,364 @@
+#include "../include/s21_flat_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Compare>
+flat_map<Key, T, Compare>::flat_map(
+    std::initializer_list<value_type> const &items)
+    : keys_(), values_(), comp_() {
+  insert(items.begin(), items.end());
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+flat_map<Key, T, Compare>::flat_map(InputIt first, InputIt last)
+    : keys_(), values_(), comp_() {
+  insert(first, last);
+}
+
+template <typename Key, typename T, typename Compare>
+T &flat_map<Key, T, Compare>::at(const key_type &key) {
+  iterator pos = find(key);
+  if (pos == end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return pos.second();
+}
+
+template <typename Key, typename T, typename Compare>
+T &flat_map<Key, T, Compare>::operator[](const key_type &key) {
+  return try_emplace(key).first.second();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::begin() {
+  return iterator(this, 0);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::end() {
+  return iterator(this, keys_.size());
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::empty() const {
+  return keys_.empty();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::size()
+    const {
+  return keys_.size();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(Key) + sizeof(T));
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::reserve(size_type count) {
+  keys_.reserve(count);
+  values_.reserve(count);
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::clear() {
+  vector<Key>().swap(keys_);
+  vector<T>().swap(values_);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert(const value_type &value) {
+  size_type i = LowerIndex(value.first);
+  if (i < keys_.size() && !comp_(value.first, keys_[i])) {
+    return {iterator(this, i), false};
+  }
+  return {InsertAt(i, value.first, value.second), true};
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename InputIt>
+void flat_map<Key, T, Compare>::insert(InputIt first, InputIt last) {
+  vector<std::pair<Key, T>> items;
+  for (; first != last; ++first) items.push_back(std::pair<Key, T>(*first));
+  if (items.empty()) return;
+  std::stable_sort(items.begin(), items.end(),
+                   [this](const std::pair<Key, T> &a,
+                          const std::pair<Key, T> &b) {
+                     return comp_(a.first, b.first);
+                   });
+
+  // Слияние старых элементов с новыми; при равенстве ключей первым идет
+  // старый, а следующие равные ему отбрасываются
+  vector<Key> keys;
+  vector<T> values;
+  keys.reserve(keys_.size() + items.size());
+  values.reserve(keys_.size() + items.size());
+  size_type i = 0;
+  size_type j = 0;
+  while (i < keys_.size() || j < items.size()) {
+    bool take_old = j == items.size() ||
+                    (i < keys_.size() && !comp_(items[j].first, keys_[i]));
+    const Key &key = take_old ? keys_[i] : items[j].first;
+    if (keys.empty() || comp_(keys[keys.size() - 1], key)) {
+      keys.push_back(key);
+      values.push_back(take_old ? values_[i] : items[j].second);
+    }
+    if (take_old) {
+      ++i;
+    } else {
+      ++j;
+    }
+  }
+  keys_.swap(keys);
+  values_.swap(values);
+}
+
+template <typename Key, typename T, typename Compare>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::insert_or_assign(const key_type &key,
+                                            const mapped_type &obj) {
+  auto result = try_emplace(key, obj);
+  if (!result.second) result.first.second() = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::emplace(Args &&...args) {
+  std::pair<key_type, mapped_type> item(std::forward<Args>(args)...);
+  return try_emplace(std::move(item.first), std::move(item.second));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+std::pair<typename flat_map<Key, T, Compare>::iterator, bool>
+flat_map<Key, T, Compare>::try_emplace(K &&key, Args &&...args) {
+  size_type i = LowerIndex(key);
+  if (i < keys_.size() && !comp_(key, keys_[i])) {
+    return {iterator(this, i), false};
+  }
+  return {InsertAt(i, std::forward<K>(key), std::forward<Args>(args)...),
+          true};
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename... Args>
+vector<std::pair<typename flat_map<Key, T, Compare>::iterator, bool>>
+flat_map<Key, T, Compare>::insert_many(Args &&...args) {
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(std::make_pair(end(), insert(args).second)));
+  // Вставка сдвигает элементы массивов, поэтому итераторы берутся
+  // заново после всех вставок
+  size_type k = 0;
+  (..., (results[k++].first = find(args.first)));
+  return results;
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::erase(iterator pos) {
+  if (pos.iter_index >= keys_.size()) return;
+  keys_.erase(keys_.begin() + pos.iter_index);
+  values_.erase(values_.begin() + pos.iter_index);
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::erase(const key_type &key) {
+  iterator pos = find(key);
+  if (pos == end()) return false;
+  erase(pos);
+  return true;
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::swap(flat_map &other) {
+  keys_.swap(other.keys_);
+  values_.swap(other.values_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+void flat_map<Key, T, Compare>::merge(flat_map &other) {
+  if (this == &other) return;
+  vector<std::pair<Key, T>> items;
+  flat_map rest(other.comp_);
+  for (size_type i = 0; i < other.size(); ++i) {
+    if (contains(other.keys_[i])) {
+      rest.keys_.push_back(other.keys_[i]);
+      rest.values_.push_back(other.values_[i]);
+    } else {
+      items.push_back(std::make_pair(other.keys_[i], other.values_[i]));
+    }
+  }
+  insert(items.begin(), items.end());
+  other.swap(rest);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::find(
+    const key_type &key) {
+  size_type i = LowerIndex(key);
+  return i < keys_.size() && !comp_(key, keys_[i]) ? iterator(this, i)
+                                                   : end();
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::find(
+    const K &key) {
+  size_type i = LowerIndex(key);
+  return i < keys_.size() && !comp_(key, keys_[i]) ? iterator(this, i)
+                                                   : end();
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::contains(const key_type &key) const {
+  size_type i = LowerIndex(key);
+  return i < keys_.size() && !comp_(key, keys_[i]);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+bool flat_map<Key, T, Compare>::contains(const K &key) const {
+  size_type i = LowerIndex(key);
+  return i < keys_.size() && !comp_(key, keys_[i]);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::lower_bound(const key_type &key) {
+  return iterator(this, LowerIndex(key));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::lower_bound(const K &key) {
+  return iterator(this, LowerIndex(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::upper_bound(const key_type &key) {
+  return iterator(this,
+                  FlatUpperBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::upper_bound(const K &key) {
+  return iterator(this,
+                  FlatUpperBound(keys_.data(), keys_.size(), key, comp_));
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator flat_map<Key, T, Compare>::nth(
+    size_type k) {
+  return k < size() ? iterator(this, k) : end();
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type flat_map<Key, T, Compare>::rank(
+    const key_type &key) const {
+  return LowerIndex(key);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::count_range(const key_type &lo,
+                                       const key_type &hi) const {
+  if (!comp_(lo, hi)) return 0;
+  return rank(hi) - rank(lo);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::key_compare
+flat_map<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename flat_map<Key, T, Compare>::size_type
+flat_map<Key, T, Compare>::LowerIndex(const K &key) const {
+  return FlatLowerBound(keys_.data(), keys_.size(), key, comp_);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename... Args>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::InsertAt(size_type i, K &&key, Args &&...args) {
+  keys_.emplace(keys_.begin() + i, std::forward<K>(key));
+  try {
+    values_.emplace(values_.begin() + i, std::forward<Args>(args)...);
+  } catch (...) {
+    keys_.erase(keys_.begin() + i);
+    throw;
+  }
+  return iterator(this, i);
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::Iterator::operator++(int) {
+  iterator temp = *this;
+  ++iter_index;
+  return temp;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator &
+flat_map<Key, T, Compare>::Iterator::operator++() {
+  ++iter_index;
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator
+flat_map<Key, T, Compare>::Iterator::operator--(int) {
+  iterator temp = *this;
+  --iter_index;
+  return temp;
+}
+
+template <typename Key, typename T, typename Compare>
+typename flat_map<Key, T, Compare>::iterator &
+flat_map<Key, T, Compare>::Iterator::operator--() {
+  --iter_index;
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::Iterator::operator==(
+    const iterator &other) const {
+  return iter_map == other.iter_map && iter_index == other.iter_index;
+}
+
+template <typename Key, typename T, typename Compare>
+bool flat_map<Key, T, Compare>::Iterator::operator!=(
+    const iterator &other) const {
+  return !(*this == other);
+}
+
+template <typename Key, typename T, typename Compare>
+const T &flat_map<Key, T, Compare>::Iterator::operator*() const {
+  return iter_map->values_[iter_index];
+}
+
+template <typename Key, typename T, typename Compare>
+const Key &flat_map<Key, T, Compare>::Iterator::first() const {
+  return iter_map->keys_[iter_index];
+}
+
+template <typename Key, typename T, typename Compare>
+T &flat_map<Key, T, Compare>::Iterator::second() const {
+  return iter_map->values_[iter_index];
+}
+
+}  // namespace s21
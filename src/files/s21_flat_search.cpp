@@ -0,0 +1,175 @@
+#include "../include/s21_flat_search.h"
+
+namespace s21 {
+
+// Без ветвлений процессор не угадывает, какая половина понадобится
+// дальше, поэтому середины обеих половин подгружаются в кеш заранее
+inline void FlatPrefetch(const void *address) {
+#if defined(__GNUC__)
+  __builtin_prefetch(address);
+#else
+  (void)address;
+#endif
+}
+
+template <typename Key>
+std::size_t CountLess(const Key *keys, std::size_t n, Key key) {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) count += keys[i] < key ? 1 : 0;
+  return count;
+}
+
+template <typename Key>
+std::size_t CountGreater(const Key *keys, std::size_t n, Key key) {
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i) count += key < keys[i] ? 1 : 0;
+  return count;
+}
+
+#if defined(__SSE2__)
+// Сравнивает по четыре (по два для double) ключа за инструкцию; маска
+// результатов сравнения переводится в число через popcount
+template <>
+inline std::size_t CountLess<int32_t>(const int32_t *keys, std::size_t n,
+                                      int32_t key) {
+  __m128i needle = _mm_set1_epi32(key);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+    __m128i less = _mm_cmplt_epi32(block, needle);
+    count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(less)));
+  }
+  for (; i < n; ++i) count += keys[i] < key ? 1 : 0;
+  return count;
+}
+
+template <>
+inline std::size_t CountGreater<int32_t>(const int32_t *keys, std::size_t n,
+                                         int32_t key) {
+  __m128i needle = _mm_set1_epi32(key);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(keys + i));
+    __m128i greater = _mm_cmpgt_epi32(block, needle);
+    count += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(greater)));
+  }
+  for (; i < n; ++i) count += key < keys[i] ? 1 : 0;
+  return count;
+}
+
+template <>
+inline std::size_t CountLess<float>(const float *keys, std::size_t n,
+                                    float key) {
+  __m128 needle = _mm_set1_ps(key);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 less = _mm_cmplt_ps(_mm_loadu_ps(keys + i), needle);
+    count += __builtin_popcount(_mm_movemask_ps(less));
+  }
+  for (; i < n; ++i) count += keys[i] < key ? 1 : 0;
+  return count;
+}
+
+template <>
+inline std::size_t CountGreater<float>(const float *keys, std::size_t n,
+                                       float key) {
+  __m128 needle = _mm_set1_ps(key);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m128 greater = _mm_cmpgt_ps(_mm_loadu_ps(keys + i), needle);
+    count += __builtin_popcount(_mm_movemask_ps(greater));
+  }
+  for (; i < n; ++i) count += key < keys[i] ? 1 : 0;
+  return count;
+}
+
+template <>
+inline std::size_t CountLess<double>(const double *keys, std::size_t n,
+                                     double key) {
+  __m128d needle = _mm_set1_pd(key);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128d less = _mm_cmplt_pd(_mm_loadu_pd(keys + i), needle);
+    count += __builtin_popcount(_mm_movemask_pd(less));
+  }
+  for (; i < n; ++i) count += keys[i] < key ? 1 : 0;
+  return count;
+}
+
+template <>
+inline std::size_t CountGreater<double>(const double *keys, std::size_t n,
+                                        double key) {
+  __m128d needle = _mm_set1_pd(key);
+  std::size_t count = 0;
+  std::size_t i = 0;
+  for (; i + 2 <= n; i += 2) {
+    __m128d greater = _mm_cmpgt_pd(_mm_loadu_pd(keys + i), needle);
+    count += __builtin_popcount(_mm_movemask_pd(greater));
+  }
+  for (; i < n; ++i) count += key < keys[i] ? 1 : 0;
+  return count;
+}
+#endif
+
+template <typename Key, typename Compare, typename K>
+std::size_t FlatLowerBound(const Key *keys, std::size_t n, const K &key,
+                           const Compare &comp) {
+  if (n == 0) return 0;
+  std::size_t lo = 0;
+  std::size_t len = n;
+  if constexpr (kFlatNumericSearch<Key, Compare, K>) {
+    constexpr std::size_t kScan =
+        kFlatScanBytes / sizeof(Key) < 2 ? 2 : kFlatScanBytes / sizeof(Key);
+    while (len > kScan) {
+      std::size_t half = len / 2;
+      FlatPrefetch(keys + lo + half / 2);
+      FlatPrefetch(keys + lo + half + half / 2);
+      lo = keys[lo + half] < key ? lo + half : lo;
+      len -= half;
+    }
+    return lo + CountLess(keys + lo, len, key);
+  } else {
+    while (len > 1) {
+      std::size_t half = len / 2;
+      if (comp(keys[lo + half], key)) lo += half;
+      len -= half;
+    }
+    return lo + (comp(keys[lo], key) ? 1 : 0);
+  }
+}
+
+template <typename Key, typename Compare, typename K>
+std::size_t FlatUpperBound(const Key *keys, std::size_t n, const K &key,
+                           const Compare &comp) {
+  if (n == 0) return 0;
+  std::size_t lo = 0;
+  std::size_t len = n;
+  if constexpr (kFlatNumericSearch<Key, Compare, K>) {
+    constexpr std::size_t kScan =
+        kFlatScanBytes / sizeof(Key) < 2 ? 2 : kFlatScanBytes / sizeof(Key);
+    while (len > kScan) {
+      std::size_t half = len / 2;
+      FlatPrefetch(keys + lo + half / 2);
+      FlatPrefetch(keys + lo + half + half / 2);
+      lo = key < keys[lo + half] ? lo : lo + half;
+      len -= half;
+    }
+    return lo + len - CountGreater(keys + lo, len, key);
+  } else {
+    while (len > 1) {
+      std::size_t half = len / 2;
+      if (!comp(key, keys[lo + half])) lo += half;
+      len -= half;
+    }
+    return lo + (comp(key, keys[lo]) ? 0 : 1);
+  }
+}
+
+}  // namespace s21
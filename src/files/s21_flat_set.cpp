@@ -0,0 +1,228 @@
+#include "../include/s21_flat_set.h"
+
+namespace s21 {
+
+template <typename Key, typename Compare>
+flat_set<Key, Compare>::flat_set(
+    std::initializer_list<value_type> const &items)
+    : keys_(), comp_() {
+  insert(items.begin(), items.end());
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+flat_set<Key, Compare>::flat_set(InputIt first, InputIt last)
+    : keys_(), comp_() {
+  insert(first, last);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::begin()
+    const {
+  return keys_.data();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::end() const {
+  return keys_.data() + keys_.size();
+}
+
+template <typename Key, typename Compare>
+bool flat_set<Key, Compare>::empty() const {
+  return keys_.empty();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::size()
+    const {
+  return keys_.size();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::max_size()
+    const {
+  return std::numeric_limits<size_type>::max() / sizeof(Key);
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::reserve(size_type count) {
+  keys_.reserve(count);
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::clear() {
+  vector<Key>().swap(keys_);
+}
+
+template <typename Key, typename Compare>
+std::pair<typename flat_set<Key, Compare>::iterator, bool>
+flat_set<Key, Compare>::insert(const value_type &value) {
+  size_type i = FlatLowerBound(keys_.data(), keys_.size(), value, comp_);
+  if (i < keys_.size() && !comp_(value, keys_[i])) {
+    return {begin() + i, false};
+  }
+  keys_.insert(keys_.begin() + i, value);
+  return {begin() + i, true};
+}
+
+template <typename Key, typename Compare>
+template <typename InputIt>
+void flat_set<Key, Compare>::insert(InputIt first, InputIt last) {
+  vector<Key> items;
+  for (; first != last; ++first) items.push_back(*first);
+  if (items.empty()) return;
+  std::stable_sort(items.begin(), items.end(), comp_);
+
+  // Слияние старых ключей с новыми; при равенстве первым идет старый, а
+  // следующие равные ему отбрасываются
+  vector<Key> merged;
+  merged.reserve(keys_.size() + items.size());
+  size_type i = 0;
+  size_type j = 0;
+  while (i < keys_.size() || j < items.size()) {
+    bool take_old = j == items.size() ||
+                    (i < keys_.size() && !comp_(items[j], keys_[i]));
+    const Key &key = take_old ? keys_[i++] : items[j++];
+    if (merged.empty() || comp_(merged[merged.size() - 1], key)) {
+      merged.push_back(key);
+    }
+  }
+  keys_.swap(merged);
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+std::pair<typename flat_set<Key, Compare>::iterator, bool>
+flat_set<Key, Compare>::emplace(Args &&...args) {
+  return insert(key_type(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Compare>
+template <typename... Args>
+vector<std::pair<typename flat_set<Key, Compare>::iterator, bool>>
+flat_set<Key, Compare>::insert_many(Args &&...args) {
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(std::make_pair(end(), insert(args).second)));
+  // Вставка сдвигает элементы массива, поэтому итераторы берутся заново
+  // после всех вставок
+  size_type k = 0;
+  (..., (results[k++].first = find(args)));
+  return results;
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::erase(iterator pos) {
+  if (pos == end()) return;
+  keys_.erase(keys_.begin() + (pos - begin()));
+}
+
+template <typename Key, typename Compare>
+bool flat_set<Key, Compare>::erase(const key_type &key) {
+  iterator pos = find(key);
+  if (pos == end()) return false;
+  erase(pos);
+  return true;
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::swap(flat_set &other) {
+  keys_.swap(other.keys_);
+  std::swap(comp_, other.comp_);
+}
+
+template <typename Key, typename Compare>
+void flat_set<Key, Compare>::merge(flat_set &other) {
+  if (this == &other) return;
+  vector<Key> rest;
+  for (const Key &key : other.keys_) {
+    if (contains(key)) rest.push_back(key);
+  }
+  insert(other.begin(), other.end());
+  other.keys_.swap(rest);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::find(
+    const key_type &key) const {
+  iterator pos = lower_bound(key);
+  return pos != end() && !comp_(key, *pos) ? pos : end();
+}
+
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::find(
+    const K &key) const {
+  iterator pos = lower_bound(key);
+  return pos != end() && !comp_(key, *pos) ? pos : end();
+}
+
+template <typename Key, typename Compare>
+bool flat_set<Key, Compare>::contains(const key_type &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+bool flat_set<Key, Compare>::contains(const K &key) const {
+  return find(key) != end();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::count(
+    const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::lower_bound(
+    const key_type &key) const {
+  return begin() + FlatLowerBound(begin(), size(), key, comp_);
+}
+
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::lower_bound(
+    const K &key) const {
+  return begin() + FlatLowerBound(begin(), size(), key, comp_);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::upper_bound(
+    const key_type &key) const {
+  return begin() + FlatUpperBound(begin(), size(), key, comp_);
+}
+
+template <typename Key, typename Compare>
+template <typename K, typename C, typename>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::upper_bound(
+    const K &key) const {
+  return begin() + FlatUpperBound(begin(), size(), key, comp_);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::iterator flat_set<Key, Compare>::nth(
+    size_type k) const {
+  return k < size() ? begin() + k : end();
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type flat_set<Key, Compare>::rank(
+    const key_type &key) const {
+  return FlatLowerBound(begin(), size(), key, comp_);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::size_type
+flat_set<Key, Compare>::count_range(const key_type &lo,
+                                    const key_type &hi) const {
+  if (!comp_(lo, hi)) return 0;
+  return rank(hi) - rank(lo);
+}
+
+template <typename Key, typename Compare>
+typename flat_set<Key, Compare>::key_compare flat_set<Key, Compare>::key_comp()
+    const {
+  return comp_;
+}
+
+}  // namespace s21
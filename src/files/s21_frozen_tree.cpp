@@ -0,0 +1,353 @@
+#include "../include/s21_frozen_tree.h"
+
+namespace s21 {
+
+// Возвращает количество единичных младших битов k
+inline size_t FrozenTrailingOnes(size_t k) {
+#if defined(__GNUC__)
+  return ~k == 0 ? sizeof(k) * 8 : __builtin_ctzll(~k);
+#else
+  size_t count = 0;
+  for (; k & 1; k >>= 1) ++count;
+  return count;
+#endif
+}
+
+template <typename Key, typename T, typename Compare>
+FrozenTree<Key, T, Compare>::FrozenTree()
+    : storage_(), values_(), keys_(nullptr), size_(0), comp_() {}
+
+template <typename Key, typename T, typename Compare>
+FrozenTree<Key, T, Compare>::FrozenTree(const Compare &comp)
+    : storage_(), values_(), keys_(nullptr), size_(0), comp_(comp) {}
+
+template <typename Key, typename T, typename Compare>
+template <typename SortedIt>
+FrozenTree<Key, T, Compare>::FrozenTree(SortedIt first, size_type n,
+                                        const Compare &comp)
+    : storage_(), values_(), keys_(nullptr), size_(n), comp_(comp) {
+  if (n == 0) return;
+  // kBlock запасных элементов позволяют сдвинуть раскладку до начала
+  // строки кеша
+  vector<Key>(n + kBlock).swap(storage_);
+  keys_ = storage_.data();
+  Align();
+  if constexpr (!kKeyOnly) vector<mapped_type>(n + 1).swap(values_);
+  Fill(first, 1);
+}
+
+template <typename Key, typename T, typename Compare>
+FrozenTree<Key, T, Compare>::FrozenTree(const FrozenTree &other)
+    : storage_(other.storage_),
+      values_(other.values_),
+      keys_(nullptr),
+      size_(other.size_),
+      comp_(other.comp_) {
+  if (size_ == 0) return;
+  // Копия лежит по другому адресу и может потребовать другого сдвига
+  keys_ = storage_.data() + (other.keys_ - other.storage_.data());
+  Align();
+}
+
+template <typename Key, typename T, typename Compare>
+FrozenTree<Key, T, Compare>::FrozenTree(FrozenTree &&other)
+    : storage_(std::move(other.storage_)),
+      values_(std::move(other.values_)),
+      keys_(other.keys_),
+      size_(other.size_),
+      comp_(other.comp_) {
+  other.keys_ = nullptr;
+  other.size_ = 0;
+}
+
+template <typename Key, typename T, typename Compare>
+FrozenTree<Key, T, Compare> &FrozenTree<Key, T, Compare>::operator=(
+    const FrozenTree &other) {
+  if (this != &other) {
+    FrozenTree copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+FrozenTree<Key, T, Compare> &FrozenTree<Key, T, Compare>::operator=(
+    FrozenTree &&other) {
+  if (this != &other) {
+    storage_ = std::move(other.storage_);
+    values_ = std::move(other.values_);
+    keys_ = other.keys_;
+    size_ = other.size_;
+    comp_ = other.comp_;
+    other.keys_ = nullptr;
+    other.size_ = 0;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+const typename FrozenTree<Key, T, Compare>::mapped_type &
+FrozenTree<Key, T, Compare>::at(const key_type &key) const {
+  iterator pos = find(key);
+  if (pos == end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return *pos;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::begin() const {
+  return iterator(this, size_ == 0 ? 0 : First(1));
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::end() const {
+  return iterator(this, 0);
+}
+
+template <typename Key, typename T, typename Compare>
+bool FrozenTree<Key, T, Compare>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::size_type
+FrozenTree<Key, T, Compare>::size() const {
+  return size_;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::size_type
+FrozenTree<Key, T, Compare>::max_size() const {
+  return std::numeric_limits<size_type>::max() /
+         (sizeof(Key) + (kKeyOnly ? 0 : sizeof(mapped_type)));
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::find(const key_type &key) const {
+  size_type k = LowerIndex(key);
+  return k != 0 && !comp_(key, keys_[k]) ? iterator(this, k) : end();
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::find(const K &key) const {
+  size_type k = LowerIndex(key);
+  return k != 0 && !comp_(key, keys_[k]) ? iterator(this, k) : end();
+}
+
+template <typename Key, typename T, typename Compare>
+bool FrozenTree<Key, T, Compare>::contains(const key_type &key) const {
+  size_type k = LowerIndex(key);
+  return k != 0 && !comp_(key, keys_[k]);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+bool FrozenTree<Key, T, Compare>::contains(const K &key) const {
+  size_type k = LowerIndex(key);
+  return k != 0 && !comp_(key, keys_[k]);
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::size_type
+FrozenTree<Key, T, Compare>::count(const key_type &key) const {
+  // Равные ключи бывают только в снимке multiset
+  size_type result = 0;
+  for (iterator it = lower_bound(key); it != end() && !comp_(key, it.first());
+       ++it) {
+    ++result;
+  }
+  return result;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::lower_bound(const key_type &key) const {
+  return iterator(this, LowerIndex(key));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::lower_bound(const K &key) const {
+  return iterator(this, LowerIndex(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::upper_bound(const key_type &key) const {
+  return iterator(this, UpperIndex(key));
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K, typename C, typename>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::upper_bound(const K &key) const {
+  return iterator(this, UpperIndex(key));
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::key_compare
+FrozenTree<Key, T, Compare>::key_comp() const {
+  return comp_;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename SortedIt>
+void FrozenTree<Key, T, Compare>::Fill(SortedIt &first, size_type k) {
+  if (k > size_) return;
+  Fill(first, 2 * k);
+  keys_[k] = first.first();
+  if constexpr (!kKeyOnly) values_[k] = *first;
+  ++first;
+  Fill(first, 2 * k + 1);
+}
+
+template <typename Key, typename T, typename Compare>
+void FrozenTree<Key, T, Compare>::Align() {
+  size_type current = keys_ - storage_.data();
+  size_type target = current;
+  if constexpr (kFlatScanBytes % sizeof(Key) == 0) {
+    size_type misalign =
+        reinterpret_cast<std::uintptr_t>(storage_.data()) % kFlatScanBytes;
+    if (misalign % sizeof(Key) == 0) {
+      target = (kFlatScanBytes - misalign) % kFlatScanBytes / sizeof(Key);
+    }
+  }
+  if (target < current) {
+    std::move(keys_, keys_ + size_ + 1, storage_.data() + target);
+  } else if (target > current) {
+    std::move_backward(keys_, keys_ + size_ + 1,
+                       storage_.data() + target + size_ + 1);
+  }
+  keys_ = storage_.data() + target;
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename FrozenTree<Key, T, Compare>::size_type
+FrozenTree<Key, T, Compare>::LowerIndex(const K &key) const {
+  // Спуск вправо, пока ключ меньше key. Путь записан в битах k; последний
+  // поворот влево указывает на ответ, поэтому хвост поворотов вправо
+  // вместе с ним отбрасывается
+  size_type k = 1;
+  while (k <= size_) {
+    FlatPrefetch(keys_ + std::min(kBlock * k, size_));
+    k = 2 * k + (comp_(keys_[k], key) ? 1 : 0);
+  }
+  return k >> (FrozenTrailingOnes(k) + 1);
+}
+
+template <typename Key, typename T, typename Compare>
+template <typename K>
+typename FrozenTree<Key, T, Compare>::size_type
+FrozenTree<Key, T, Compare>::UpperIndex(const K &key) const {
+  size_type k = 1;
+  while (k <= size_) {
+    FlatPrefetch(keys_ + std::min(kBlock * k, size_));
+    k = 2 * k + (comp_(key, keys_[k]) ? 0 : 1);
+  }
+  return k >> (FrozenTrailingOnes(k) + 1);
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::size_type
+FrozenTree<Key, T, Compare>::First(size_type k) const {
+  while (2 * k <= size_) k = 2 * k;
+  return k;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::size_type
+FrozenTree<Key, T, Compare>::Last(size_type k) const {
+  while (2 * k + 1 <= size_) k = 2 * k + 1;
+  return k;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::Iterator::operator++(int) {
+  iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator &
+FrozenTree<Key, T, Compare>::Iterator::operator++() {
+  if (iter_index == 0) return *this;
+  if (2 * iter_index + 1 <= iter_tree->size_) {
+    iter_index = iter_tree->First(2 * iter_index + 1);
+  } else {
+    // Подъем, пока элемент - правый потомок; затем к родителю
+    while (iter_index & 1) iter_index >>= 1;
+    iter_index >>= 1;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator
+FrozenTree<Key, T, Compare>::Iterator::operator--(int) {
+  iterator temp = *this;
+  --(*this);
+  return temp;
+}
+
+template <typename Key, typename T, typename Compare>
+typename FrozenTree<Key, T, Compare>::iterator &
+FrozenTree<Key, T, Compare>::Iterator::operator--() {
+  // Как у s21::map, --end() указывает на последний элемент
+  if (iter_index == 0) {
+    iter_index = iter_tree->size_ == 0 ? 0 : iter_tree->Last(1);
+  } else if (2 * iter_index <= iter_tree->size_) {
+    iter_index = iter_tree->Last(2 * iter_index);
+  } else {
+    while (!(iter_index & 1)) iter_index >>= 1;
+    iter_index >>= 1;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Compare>
+bool FrozenTree<Key, T, Compare>::Iterator::operator==(
+    const iterator &other) const {
+  return iter_tree == other.iter_tree && iter_index == other.iter_index;
+}
+
+template <typename Key, typename T, typename Compare>
+bool FrozenTree<Key, T, Compare>::Iterator::operator!=(
+    const iterator &other) const {
+  return !(*this == other);
+}
+
+template <typename Key, typename T, typename Compare>
+const typename FrozenTree<Key, T, Compare>::mapped_type &
+FrozenTree<Key, T, Compare>::Iterator::operator*() const {
+  if (iter_index == 0) {
+    throw std::out_of_range("Iterator is out of range");
+  }
+  return second();
+}
+
+template <typename Key, typename T, typename Compare>
+const Key &FrozenTree<Key, T, Compare>::Iterator::first() const {
+  return iter_tree->keys_[iter_index];
+}
+
+template <typename Key, typename T, typename Compare>
+const typename FrozenTree<Key, T, Compare>::mapped_type &
+FrozenTree<Key, T, Compare>::Iterator::second() const {
+  if constexpr (kKeyOnly) {
+    return iter_tree->keys_[iter_index];
+  } else {
+    return iter_tree->values_[iter_index];
+  }
+}
+
+}  // namespace s21
@@ -1,96 +1,134 @@
 #include "../include/s21_list.h"
 
 namespace s21 {
-template <typename value_type>
-list<value_type>::list() : head_(nullptr), tail_(nullptr), size_(0) {}
-
-template <typename value_type>
-list<value_type>::list(size_type n) : head_(nullptr), tail_(nullptr), size_(0) {
-  for (size_type i = 0; i < n; ++i) push_back(value_type());
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list()
+    : alloc_(), head_(nullptr), tail_(nullptr), size_(0) {}
+
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(const Allocator &alloc)
+    : alloc_(alloc), head_(nullptr), tail_(nullptr), size_(0) {}
+
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(size_type n, const Allocator &alloc)
+    : list(alloc) {
+  for (size_type i = 0; i < n; ++i) LinkBefore(nullptr);
 }
 
-template <typename value_type>
-list<value_type>::list(std::initializer_list<value_type> const &items)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : list(alloc) {
   for (const auto &elem : items) push_back(elem);
 }
 
-template <typename value_type>
-list<value_type>::list(const list &l)
-    : head_(nullptr), tail_(nullptr), size_(0) {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(const list &l)
+    : list(l, NodeTraits::select_on_container_copy_construction(l.alloc_)) {}
+
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(const list &l, const Allocator &alloc)
+    : list(alloc) {
   for (Node *node = l.head_; node; node = node->next) push_back(node->data);
 }
 
-template <typename value_type>
-list<value_type>::list(list &&l) noexcept
-    : head_(l.head_), tail_(l.tail_), size_(l.size_) {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(list &&l) noexcept
+    : alloc_(std::move(l.alloc_)),
+      head_(l.head_),
+      tail_(l.tail_),
+      size_(l.size_) {
   l.head_ = nullptr;
   l.tail_ = nullptr;
   l.size_ = 0;
 }
 
-template <typename value_type>
-list<value_type>::~list() {
-  Node *cur = head_;
-  while (cur) {
-    Node *temp = cur;
-    cur = cur->next;
-    delete temp;
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::list(list &&l, const Allocator &alloc)
+    : list(alloc) {
+  if (alloc_ == l.alloc_) {
+    Steal(l);
+  } else {
+    // Узлы l принадлежат чужому распределителю: элементы переносятся
+    // в свои узлы
+    for (Node *node = l.head_; node; node = node->next) {
+      push_back(std::move(node->data));
+    }
   }
 }
 
-template <typename value_type>
-list<value_type> &list<value_type>::operator=(list<value_type> &&l) noexcept {
+template <typename value_type, typename Allocator>
+list<value_type, Allocator>::~list() {
+  Release();
+}
+
+template <typename value_type, typename Allocator>
+list<value_type, Allocator> &list<value_type, Allocator>::operator=(
+    list &&l) noexcept(kNoexceptMoveAssign) {
   if (this == &l) return *this;
-  clear();
-  head_ = l.head_;
-  tail_ = l.tail_;
-  size_ = l.size_;
-  l.head_ = nullptr;
-  l.tail_ = nullptr;
-  l.size_ = 0;
+  if constexpr (NodeTraits::propagate_on_container_move_assignment::value) {
+    Release();
+    alloc_ = std::move(l.alloc_);
+    Steal(l);
+  } else if (alloc_ == l.alloc_) {
+    Release();
+    Steal(l);
+  } else {
+    list moved(std::move(l), alloc_);
+    Release();
+    Steal(moved);
+  }
   return *this;
 }
 
-template <typename value_type>
-const value_type &list<value_type>::front() const {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::allocator_type
+list<value_type, Allocator>::get_allocator() const {
+  return allocator_type(alloc_);
+}
+
+template <typename value_type, typename Allocator>
+const value_type &list<value_type, Allocator>::front() const {
   if (!head_) throw std::out_of_range("list is empty");
   return head_->data;
 }
 
-template <typename value_type>
-const value_type &list<value_type>::back() const {
+template <typename value_type, typename Allocator>
+const value_type &list<value_type, Allocator>::back() const {
   if (!tail_) throw std::out_of_range("list is empty");
   return tail_->data;
 }
 
-template <typename value_type>
-typename list<value_type>::iterator list<value_type>::begin() {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::begin() {
   return iterator(head_);
 }
 
-template <typename value_type>
-typename list<value_type>::iterator list<value_type>::end() {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::end() {
   return iterator(nullptr);
 }
 
-template <typename value_type>
-bool list<value_type>::empty() {
+template <typename value_type, typename Allocator>
+bool list<value_type, Allocator>::empty() {
   return size_ == 0;
 }
 
-template <typename value_type>
-size_t list<value_type>::size() {
+template <typename value_type, typename Allocator>
+size_t list<value_type, Allocator>::size() {
   return size_;
 }
 
-template <typename value_type>
-size_t list<value_type>::max_size() const {
+template <typename value_type, typename Allocator>
+size_t list<value_type, Allocator>::max_size() const {
   return std::numeric_limits<size_type>::max();
 }
 
-template <typename value_type>
-typename list<value_type>::reference list<value_type>::at(iterator pos) {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::reference list<value_type, Allocator>::at(
+    iterator pos) {
   if (pos.get_cur() == nullptr) {
     throw std::out_of_range("Iterator points to nullptr");
   }
@@ -98,38 +136,39 @@ typename list<value_type>::reference list<value_type>::at(iterator pos) {
   return pos.get_cur()->data;
 }
 
-template <typename value_type>
-void list<value_type>::clear() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::clear() {
   Node *cur = tail_;
   while (cur) {
     Node *temp = cur;
     cur = cur->prev;
-    delete temp;
+    FreeNode(temp);
     head_ = tail_ = nullptr;
     size_ = 0;
   }
 }
 
-template <typename value_type>
-typename list<value_type>::iterator list<value_type>::insert(
-    iterator pos, const_reference value) {
-  Node *cur = pos.get_cur();
-  if (cur == head_) {
-    push_front(value);
-    return iterator(head_);
-  } else {
-    Node *new_node = new Node(value);
-    new_node->next = cur;
-    new_node->prev = cur->prev;
-    if (cur->prev) cur->prev->next = new_node;
-    cur->prev = new_node;
-    ++size_;
-    return iterator(new_node);
-  }
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::insert(iterator pos, const_reference value) {
+  return iterator(LinkBefore(pos.get_cur(), value));
 }
 
-template <typename value_type>
-void list<value_type>::erase(iterator pos) {
+template <typename value_type, typename Allocator>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::insert(iterator pos, value_type &&value) {
+  return iterator(LinkBefore(pos.get_cur(), std::move(value)));
+}
+
+template <typename value_type, typename Allocator>
+template <typename... Args>
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::emplace(iterator pos, Args &&...args) {
+  return iterator(LinkBefore(pos.get_cur(), std::forward<Args>(args)...));
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::erase(iterator pos) {
   if (pos.get_cur() == nullptr) return;
   Node *free_node_element = pos.get_cur();
   if (free_node_element->next) {
@@ -142,25 +181,29 @@ void list<value_type>::erase(iterator pos) {
   } else {
     head_ = free_node_element->next;
   }
-  delete free_node_element;
+  FreeNode(free_node_element);
   --size_;
 }
 
-template <typename value_type>
-void list<value_type>::push_back(const_reference value) {
-  Node *new_node = new Node(value);
-  if (tail_) {
-    tail_->next = new_node;
-    new_node->prev = tail_;
-    tail_ = new_node;
-  } else {
-    head_ = tail_ = new_node;
-  }
-  ++size_;
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_back(const_reference value) {
+  LinkBefore(nullptr, value);
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_back(value_type &&value) {
+  LinkBefore(nullptr, std::move(value));
 }
 
-template <typename value_type>
-void list<value_type>::pop_back() {
+template <typename value_type, typename Allocator>
+template <typename... Args>
+typename list<value_type, Allocator>::reference
+list<value_type, Allocator>::emplace_back(Args &&...args) {
+  return LinkBefore(nullptr, std::forward<Args>(args)...)->data;
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::pop_back() {
   if (!head_) return;
   Node *temp = tail_;
   if (tail_->prev) {
@@ -169,25 +212,29 @@ void list<value_type>::pop_back() {
   } else {
     head_ = tail_ = nullptr;
   }
-  delete temp;
+  FreeNode(temp);
   --size_;
 }
 
-template <typename value_type>
-void list<value_type>::push_front(const_reference value) {
-  Node *new_node = new Node(value);
-  if (head_) {
-    head_->prev = new_node;
-    new_node->next = head_;
-    head_ = new_node;
-  } else {
-    head_ = tail_ = new_node;
-  }
-  ++size_;
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_front(const_reference value) {
+  LinkBefore(head_, value);
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::push_front(value_type &&value) {
+  LinkBefore(head_, std::move(value));
 }
 
-template <typename value_type>
-void list<value_type>::pop_front() {
+template <typename value_type, typename Allocator>
+template <typename... Args>
+typename list<value_type, Allocator>::reference
+list<value_type, Allocator>::emplace_front(Args &&...args) {
+  return LinkBefore(head_, std::forward<Args>(args)...)->data;
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::pop_front() {
   if (!tail_) return;
   Node *temp = head_;
   if (head_->next) {
@@ -196,19 +243,22 @@ void list<value_type>::pop_front() {
   } else {
     head_ = tail_ = nullptr;
   }
-  delete temp;
+  FreeNode(temp);
   --size_;
 }
 
-template <typename value_type>
-void list<value_type>::swap(list &other) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::swap(list &other) {
+  if constexpr (NodeTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
   std::swap(head_, other.head_);
   std::swap(tail_, other.tail_);
   std::swap(size_, other.size_);
 }
 
-template <typename value_type>
-void list<value_type>::merge(list &other) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::merge(list &other) {
   Node *first_1 = head_;
   Node *first_2 = other.head_;
   Node dummy;
@@ -238,8 +288,8 @@ void list<value_type>::merge(list &other) {
   other.size_ = 0;
 }
 
-template <typename value_type>
-void list<value_type>::splice(const_iterator pos, list &other) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::splice(const_iterator pos, list &other) {
   Node *cur = pos.get_cur();
   Node *other_head = other.head_;
   Node *other_tail = other.tail_;
@@ -266,8 +316,8 @@ void list<value_type>::splice(const_iterator pos, list &other) {
   other.size_ = 0;
 }
 
-template <typename value_type>
-void list<value_type>::reverse() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::reverse() {
   Node *cur = head_;
   Node *prev = nullptr;
   Node *next = nullptr;
@@ -281,8 +331,8 @@ void list<value_type>::reverse() {
   std::swap(head_, tail_);
 }
 
-template <typename value_type>
-void list<value_type>::unique() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::unique() {
   if (!head_ || !head_->next) return;
   Node *cur = head_;
   while (cur && cur->next) {
@@ -296,7 +346,7 @@ void list<value_type>::unique() {
         tail_ = cur;
       }
 
-      delete free_node_element;
+      FreeNode(free_node_element);
       --size_;
     } else {
       cur = cur->next;
@@ -304,8 +354,8 @@ void list<value_type>::unique() {
   }
 }
 
-template <typename value_type>
-void list<value_type>::sort() {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::sort() {
   if (size_ < 2) return;
   Node *cur = head_;
   while (cur) {
@@ -318,8 +368,8 @@ void list<value_type>::sort() {
   }
 }
 
-template <typename value_type>
-void list<value_type>::remove(const_reference value) {
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::remove(const_reference value) {
   Node *cur = head_;
   while (cur) {
     if (cur->data == value) {
@@ -335,7 +385,7 @@ void list<value_type>::remove(const_reference value) {
       } else {
         tail_ = free_node_element->prev;
       }
-      delete free_node_element;
+      FreeNode(free_node_element);
       --size_;
     } else {
       cur = cur->next;
@@ -343,38 +393,88 @@ void list<value_type>::remove(const_reference value) {
   }
 }
 
-template <typename value_type>
+template <typename value_type, typename Allocator>
 template <typename... Args>
-typename list<value_type>::iterator list<value_type>::insert_many(
-    const_iterator pos, Args &&...args) {
-  const size_type n = sizeof...(args);
-  value_type arr[] = {std::forward<Args>(args)...};
+typename list<value_type, Allocator>::iterator
+list<value_type, Allocator>::insert_many(const_iterator pos, Args &&...args) {
   Node *cur_node = pos.get_cur();
-  for (size_type i = 0; i < n; ++i) {
-    iterator new_pos = insert(iterator(cur_node), arr[i]);
-    cur_node = new_pos.get_cur()->next;
-  }
+  (LinkBefore(cur_node, std::forward<Args>(args)), ...);
   return iterator(cur_node);
 }
 
-template <typename value_type>
+template <typename value_type, typename Allocator>
 template <typename... Args>
-void list<value_type>::insert_many_back(Args &&...args) {
-  const size_type n = sizeof...(args);
-  value_type arr[] = {std::forward<Args>(args)...};
-  for (size_type i = 0; i < n; ++i) {
-    push_back(arr[i]);
-  }
+void list<value_type, Allocator>::insert_many_back(Args &&...args) {
+  (LinkBefore(nullptr, std::forward<Args>(args)), ...);
+}
+
+template <typename value_type, typename Allocator>
+template <typename... Args>
+void list<value_type, Allocator>::insert_many_front(Args &&...args) {
+  // Все элементы встают перед прежним первым, поэтому порядок аргументов
+  // сохраняется
+  Node *first = head_;
+  (LinkBefore(first, std::forward<Args>(args)), ...);
 }
 
-template <typename value_type>
+template <typename value_type, typename Allocator>
 template <typename... Args>
-void list<value_type>::insert_many_front(Args &&...args) {
-  const size_type n = sizeof...(args);
-  value_type arr[] = {std::forward<Args>(args)...};
-  for (size_type i = n; i > 0; --i) {
-    push_front(arr[i - 1]);
+typename list<value_type, Allocator>::Node *
+list<value_type, Allocator>::LinkBefore(Node *pos, Args &&...args) {
+  Node *new_node = NodeTraits::allocate(alloc_, 1);
+  NodeTraits::construct(alloc_, new_node);
+  try {
+    NodeTraits::construct(alloc_, std::addressof(new_node->data),
+                          std::forward<Args>(args)...);
+  } catch (...) {
+    NodeTraits::destroy(alloc_, new_node);
+    NodeTraits::deallocate(alloc_, new_node, 1);
+    throw;
   }
+  Node *prev = pos != nullptr ? pos->prev : tail_;
+  new_node->prev = prev;
+  new_node->next = pos;
+  if (prev != nullptr) {
+    prev->next = new_node;
+  } else {
+    head_ = new_node;
+  }
+  if (pos != nullptr) {
+    pos->prev = new_node;
+  } else {
+    tail_ = new_node;
+  }
+  ++size_;
+  return new_node;
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::FreeNode(Node *node) {
+  NodeTraits::destroy(alloc_, std::addressof(node->data));
+  NodeTraits::destroy(alloc_, node);
+  NodeTraits::deallocate(alloc_, node, 1);
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::Release() {
+  Node *cur = head_;
+  while (cur) {
+    Node *temp = cur;
+    cur = cur->next;
+    FreeNode(temp);
+  }
+  head_ = tail_ = nullptr;
+  size_ = 0;
+}
+
+template <typename value_type, typename Allocator>
+void list<value_type, Allocator>::Steal(list &other) noexcept {
+  head_ = other.head_;
+  tail_ = other.tail_;
+  size_ = other.size_;
+  other.head_ = nullptr;
+  other.tail_ = nullptr;
+  other.size_ = 0;
 }
 
 }  // namespace s21
\ No newline at end of file
@@ -1,26 +1,52 @@
 #include "../include/s21_map.h"
 
 namespace s21 {
-template <typename key_type, typename mapped_type>
-map<key_type, mapped_type>::map(
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+map<key_type, mapped_type, Compare, NodeAllocator>::map(
     std::initializer_list<value_type> const &items) {
-  for (const auto &item : items) {
-    this->insert(item);
-  }
+  assign_sorted(items.begin(), items.end());
 }
 
-template <typename key_type, typename mapped_type>
-mapped_type &map<key_type, mapped_type>::operator[](const key_type &key) {
-  auto it = this->find(key);
-  if (it == this->end()) {
-    auto pr = this->insert(std::make_pair(key, mapped_type()));
-    it = pr.first;
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+map<key_type, mapped_type, Compare, NodeAllocator>::map(
+    std::initializer_list<value_type> const &items, const NodeAllocator &alloc)
+    : BinaryTree<key_type, mapped_type, Compare, NodeAllocator>(alloc) {
+  assign_sorted(items.begin(), items.end());
+}
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename InputIt>
+map<key_type, mapped_type, Compare, NodeAllocator>::map(
+    InputIt first, InputIt last) {
+  assign_sorted(first, last);
+}
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename InputIt>
+void map<key_type, mapped_type, Compare, NodeAllocator>::assign_sorted(
+    InputIt first, InputIt last) {
+  vector<std::pair<key_type, mapped_type>> items;
+  for (; first != last; ++first) {
+    items.push_back(std::pair<key_type, mapped_type>(*first));
   }
-  return it.second();
+  this->AssignSorted(items, true);
 }
 
-template <typename key_type, typename mapped_type>
-mapped_type &map<key_type, mapped_type>::at(const key_type &key) {
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+mapped_type &map<key_type, mapped_type, Compare, NodeAllocator>::operator[](
+    const key_type &key) {
+  return try_emplace(key).first.second();
+}
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+mapped_type &map<key_type, mapped_type, Compare, NodeAllocator>::at(
+    const key_type &key) {
   auto it = this->find(key);
   if (it == this->end()) {
     throw std::out_of_range("map::at");
@@ -28,19 +54,92 @@ mapped_type &map<key_type, mapped_type>::at(const key_type &key) {
   return it.second();
 }
 
-template <typename key_type, typename mapped_type>
-std::pair<typename map<key_type, mapped_type>::iterator, bool>
-map<key_type, mapped_type>::insert_or_assign(const key_type &key,
-                                             const mapped_type &value) {
-  auto it = this->find(key);
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+std::pair<typename map<key_type, mapped_type, Compare, NodeAllocator>::iterator,
+          bool>
+map<key_type, mapped_type, Compare, NodeAllocator>::insert_or_assign(
+    const key_type &key, const mapped_type &value) {
+  auto result = try_emplace(key, value);
+  if (!result.second) result.first.second() = value;
+  return result;
+}
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, Compare, NodeAllocator>::iterator,
+          bool>
+map<key_type, mapped_type, Compare, NodeAllocator>::emplace(Args &&...args) {
+  auto result =
+      this->EmplaceNode(CreateItemNode(std::forward<Args>(args)...));
+  return {iterator(result.first, this), result.second};
+}
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename... Args>
+typename map<key_type, mapped_type, Compare, NodeAllocator>::iterator
+map<key_type, mapped_type, Compare, NodeAllocator>::emplace_hint(
+    iterator hint, Args &&...args) {
+  node_type *new_node = CreateItemNode(std::forward<Args>(args)...);
+  return iterator(this->EmplaceNodeHint(this->GetNode(hint), new_node).first,
+                  this);
+}
 
-  if (it != this->end()) {
-    it.second() = value;
-    return std::make_pair(iterator(it), false);
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename... Args>
+typename map<key_type, mapped_type, Compare, NodeAllocator>::node_type *
+map<key_type, mapped_type, Compare, NodeAllocator>::CreateItemNode(
+    Args &&...args) {
+  if constexpr (sizeof...(Args) == 2) {
+    return this->alloc_.create(std::forward<Args>(args)...);
+  } else if constexpr (sizeof...(Args) == 1) {
+    // Пара раскладывается на ключ и значение
+    return [this](auto &&item) {
+      using Item = decltype(item);
+      return this->alloc_.create(std::get<0>(std::forward<Item>(item)),
+                                 std::get<1>(std::forward<Item>(item)));
+    }(std::forward<Args>(args)...);
+  } else {
+    std::pair<key_type, mapped_type> item(std::forward<Args>(args)...);
+    return this->alloc_.create(std::move(item.first), std::move(item.second));
   }
+}
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, Compare, NodeAllocator>::iterator,
+          bool>
+map<key_type, mapped_type, Compare, NodeAllocator>::try_emplace(
+    const key_type &key, Args &&...args) {
+  return TryEmplace(key, std::forward<Args>(args)...);
+}
+
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename... Args>
+std::pair<typename map<key_type, mapped_type, Compare, NodeAllocator>::iterator,
+          bool>
+map<key_type, mapped_type, Compare, NodeAllocator>::try_emplace(
+    key_type &&key, Args &&...args) {
+  return TryEmplace(std::move(key), std::forward<Args>(args)...);
+}
 
-  auto result = this->insert(std::make_pair(key, value));
-  return std::make_pair(iterator(result.first), true);
+template <typename key_type, typename mapped_type, typename Compare,
+          typename NodeAllocator>
+template <typename K, typename... Args>
+std::pair<typename map<key_type, mapped_type, Compare, NodeAllocator>::iterator,
+          bool>
+map<key_type, mapped_type, Compare, NodeAllocator>::TryEmplace(
+    K &&key, Args &&...args) {
+  bool inserted = false;
+  node_type *result = nullptr;
+  this->root_ = this->Emplace(this->root_, std::forward<K>(key), result,
+                              inserted, std::forward<Args>(args)...);
+  return {iterator(result, this), inserted};
 }
 
 }  // namespace s21
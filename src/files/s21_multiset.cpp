@@ -2,154 +2,156 @@
 
 namespace s21 {
 
-template <typename key_type>
-multiset<key_type>::multiset(const std::initializer_list<value_type> &items) {
-  for (const value_type &item : items) {
-    this->insert(item);
-  }
-}
-
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::insert(
-    const value_type &value) {
-  this->root_ = insert(this->root_, value, value);
-  return iterator(this->root_);
+template <typename key_type, typename Compare, typename NodeAllocator>
+multiset<key_type, Compare, NodeAllocator>::multiset(
+    const std::initializer_list<value_type> &items) {
+  assign_sorted(items.begin(), items.end());
 }
 
-template <typename key_type>
-Node<typename multiset<key_type>::key_type,
-     typename multiset<key_type>::value_type>
-    *multiset<key_type>::insert(Node<key_type, key_type> *node,
-                                const key_type &key, const value_type &value) {
-  if (node == nullptr) {
-    return new Node<key_type, key_type>(key, value);
-  }
-  if (key <= node->key) {
-    node->left = insert(node->left, key, value);
-  } else {
-    node->right = insert(node->right, key, value);
-  }
-  return this->Balance(node);
+template <typename key_type, typename Compare, typename NodeAllocator>
+multiset<key_type, Compare, NodeAllocator>::multiset(
+    std::initializer_list<value_type> const &items, const NodeAllocator &alloc)
+    : BinaryTree<key_type, key_type, Compare, NodeAllocator>(alloc) {
+  assign_sorted(items.begin(), items.end());
 }
 
-template <typename key_type>
-void multiset<key_type>::merge(multiset &other) {
-  merge(this->root_, other.root_);
-  other.root_ = nullptr;
-  other.clear();
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename InputIt>
+multiset<key_type, Compare, NodeAllocator>::multiset(
+    InputIt first, InputIt last) {
+  assign_sorted(first, last);
 }
 
-template <typename key_type>
-void multiset<key_type>::merge(Node<key_type, key_type> *&into,
-                               Node<key_type, key_type> *from) {
-  if (from == nullptr) {
-    return;
-  }
-
-  Node<key_type, key_type> *left_subtree = from->left;
-  Node<key_type, key_type> *right_subtree = from->right;
-
-  from->left = nullptr;
-  from->right = nullptr;
-
-  this->insert(from->key);
-
-  delete from;
-
-  merge(into, left_subtree);
-  merge(into, right_subtree);
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename InputIt>
+void multiset<key_type, Compare, NodeAllocator>::assign_sorted(
+    InputIt first, InputIt last) {
+  vector<key_type> keys;
+  for (; first != last; ++first) keys.push_back(*first);
+  this->AssignSorted(keys, false);
 }
 
-template <typename key_type>
-typename multiset<key_type>::size_type multiset<key_type>::count(
-    const key_type &key) const {
-  return countRecursive(this->root_, key);
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename multiset<key_type, Compare, NodeAllocator>::iterator
+multiset<key_type, Compare, NodeAllocator>::insert(const value_type &value) {
+  this->root_ = insert(this->root_, value);
+  return iterator(this->root_, this);
 }
 
-template <typename key_type>
-typename multiset<key_type>::size_type multiset<key_type>::countRecursive(
-    Node<key_type, key_type> *node, const key_type &key) const {
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename multiset<key_type, Compare, NodeAllocator>::node_type *
+multiset<key_type, Compare, NodeAllocator>::insert(
+    node_type *node, const key_type &key) {
   if (node == nullptr) {
-    return 0;
+    return this->CreateNode(key, key);
   }
-
-  size_type count = 0;
-
-  if (key == node->key) {
-    count++;
-  }
-
-  if (key <= node->key) {
-    count += countRecursive(node->left, key);
+  // Равные ключи уходят вправо: новый элемент встает после уже
+  // имеющихся, как в std::multiset
+  if (this->comp_(key, node->key)) {
+    node->left = insert(node->left, key);
+  } else {
+    node->right = insert(node->right, key);
   }
+  return this->Balance(node);
+}
 
-  count += countRecursive(node->right, key);
+template <typename key_type, typename Compare, typename NodeAllocator>
+void multiset<key_type, Compare, NodeAllocator>::merge(multiset &other) {
+  this->MergeEquivalent(other);
+}
 
-  return count;
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename multiset<key_type, Compare, NodeAllocator>::size_type
+multiset<key_type, Compare, NodeAllocator>::count(const key_type &key) const {
+  return this->UpperRank(key) - this->LowerRank(key);
 }
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::lower_bound(
-    const key_type &key) {
-  return lower_bound_recursive(this->root_, key);
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename multiset<key_type, Compare, NodeAllocator>::iterator
+multiset<key_type, Compare, NodeAllocator>::lower_bound(const key_type &key) {
+  return iterator(this->LowerBound(key), this);
 }
 
-template <typename key_type>
-Node<typename multiset<key_type>::key_type,
-     typename multiset<key_type>::value_type> *
-s21::multiset<key_type>::lower_bound_recursive(Node<key_type, key_type> *node,
-                                               const key_type &key) {
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename multiset<key_type, Compare, NodeAllocator>::node_type *
+s21::multiset<key_type, Compare, NodeAllocator>::lower_bound_recursive(
+    node_type *node, const key_type &key) {
   if (node == nullptr) {
     return nullptr;
   }
-  if (key == node->key) {
-    return node;
-  }
-  if (key < node->key) {
-    Node<key_type, key_type> *tempNode = lower_bound_recursive(node->left, key);
+  if (!this->comp_(node->key, key)) {
+    node_type *tempNode = lower_bound_recursive(node->left, key);
     return (tempNode != nullptr) ? tempNode : node;
   } else {
     return lower_bound_recursive(node->right, key);
   }
 }
 
-template <typename key_type>
-typename multiset<key_type>::iterator multiset<key_type>::upper_bound(
-    const key_type &key) {
-  return upper_bound_recursive(this->root_, key);
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename multiset<key_type, Compare, NodeAllocator>::iterator
+multiset<key_type, Compare, NodeAllocator>::upper_bound(const key_type &key) {
+  return iterator(this->UpperBound(key), this);
 }
 
-template <typename key_type>
-Node<typename multiset<key_type>::key_type,
-     typename multiset<key_type>::value_type> *
-s21::multiset<key_type>::upper_bound_recursive(Node<key_type, key_type> *node,
-                                               const key_type &key) {
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename multiset<key_type, Compare, NodeAllocator>::node_type *
+s21::multiset<key_type, Compare, NodeAllocator>::upper_bound_recursive(
+    node_type *node, const key_type &key) {
   if (node == nullptr) {
     return nullptr;
   }
-  if (key < node->key) {
-    Node<key_type, key_type> *tempNode = upper_bound_recursive(node->left, key);
+  if (this->comp_(key, node->key)) {
+    node_type *tempNode = upper_bound_recursive(node->left, key);
     return (tempNode != nullptr) ? tempNode : node;
   } else {
     return upper_bound_recursive(node->right, key);
   }
 }
 
-template <typename key_type>
-std::pair<typename multiset<key_type>::iterator,
-          typename multiset<key_type>::iterator>
-multiset<key_type>::equal_range(const key_type &key) {
-  auto lower = lower_bound(key);
-  auto upper = upper_bound(key);
-  auto result = std::make_pair(lower, upper);
-  return result;
+template <typename key_type, typename Compare, typename NodeAllocator>
+std::pair<typename multiset<key_type, Compare, NodeAllocator>::iterator,
+          typename multiset<key_type, Compare, NodeAllocator>::iterator>
+multiset<key_type, Compare, NodeAllocator>::equal_range(const key_type &key) {
+  return {lower_bound(key), upper_bound(key)};
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename K, typename C, typename>
+typename multiset<key_type, Compare, NodeAllocator>::size_type
+multiset<key_type, Compare, NodeAllocator>::count(const K &key) const {
+  return this->UpperRank(key) - this->LowerRank(key);
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename K, typename C, typename>
+typename multiset<key_type, Compare, NodeAllocator>::iterator
+multiset<key_type, Compare, NodeAllocator>::lower_bound(const K &key) {
+  return iterator(this->LowerBound(key), this);
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename K, typename C, typename>
+typename multiset<key_type, Compare, NodeAllocator>::iterator
+multiset<key_type, Compare, NodeAllocator>::upper_bound(const K &key) {
+  return iterator(this->UpperBound(key), this);
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename K, typename C, typename>
+std::pair<typename multiset<key_type, Compare, NodeAllocator>::iterator,
+          typename multiset<key_type, Compare, NodeAllocator>::iterator>
+multiset<key_type, Compare, NodeAllocator>::equal_range(const K &key) {
+  return {lower_bound(key), upper_bound(key)};
 }
 
-template <typename Key>
+template <typename Key, typename Compare, typename NodeAllocator>
 template <class... Args>
-vector<std::pair<typename multiset<Key>::iterator, bool>>
-multiset<Key>::insert_many(Args &&...args) {
-  vector<std::pair<typename multiset<Key>::iterator, bool>> results;
+vector<
+    std::pair<typename multiset<Key, Compare, NodeAllocator>::iterator, bool>>
+multiset<Key, Compare, NodeAllocator>::insert_many(Args &&...args) {
+  vector<std::pair<typename multiset<Key, Compare, NodeAllocator>::iterator,
+                   bool>>
+      results;
   (...,
    results.push_back(std::make_pair(insert(std::forward<Args>(args)), true)));
 
@@ -0,0 +1,141 @@
+#include "../include/s21_node_pool.h"
+
+namespace s21 {
+
+template <typename NodeType>
+NodePool<NodeType>::NodePool()
+    : slabs_(),
+      free_list_(nullptr),
+      cursor_(nullptr),
+      slab_end_(nullptr),
+      next_slab_size_(kFirstSlabSize) {}
+
+template <typename NodeType>
+NodePool<NodeType>::NodePool(NodePool &&other) noexcept : NodePool() {
+  swap(other);
+}
+
+template <typename NodeType>
+NodePool<NodeType>::~NodePool() {
+  release();
+}
+
+template <typename NodeType>
+NodePool<NodeType> &NodePool<NodeType>::operator=(NodePool &&other) noexcept {
+  if (this != &other) {
+    release();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename NodeType>
+template <typename... Args>
+NodeType *NodePool<NodeType>::create(Args &&...args) {
+  Slot *slot = free_list_;
+  if (slot != nullptr) {
+    free_list_ = slot->next;
+  } else {
+    if (cursor_ == slab_end_) grow();
+    slot = cursor_++;
+  }
+  try {
+    return new (slot->storage) node_type(std::forward<Args>(args)...);
+  } catch (...) {
+    slot->next = free_list_;
+    free_list_ = slot;
+    throw;
+  }
+}
+
+template <typename NodeType>
+void NodePool<NodeType>::destroy(node_type *node) {
+  if (node == nullptr) return;
+  node->~node_type();
+  Slot *slot = reinterpret_cast<Slot *>(node);
+  slot->next = free_list_;
+  free_list_ = slot;
+}
+
+template <typename NodeType>
+void NodePool<NodeType>::release() {
+  for (size_type i = 0; i < slabs_.size(); ++i) DeallocateSlab(slabs_[i]);
+  slabs_.clear();
+  free_list_ = nullptr;
+  cursor_ = slab_end_ = nullptr;
+  next_slab_size_ = kFirstSlabSize;
+}
+
+template <typename NodeType>
+void NodePool<NodeType>::adopt(NodePool &other) {
+  if (this == &other) return;
+  for (size_type i = 0; i < other.slabs_.size(); ++i) {
+    slabs_.push_back(other.slabs_[i]);
+  }
+  if (other.free_list_ != nullptr) {
+    Slot *tail = other.free_list_;
+    while (tail->next != nullptr) tail = tail->next;
+    tail->next = free_list_;
+    free_list_ = other.free_list_;
+  }
+  // Неразмеченный остаток чужого блока добавляется к свободным узлам
+  while (other.cursor_ != other.slab_end_) {
+    Slot *slot = other.cursor_++;
+    slot->next = free_list_;
+    free_list_ = slot;
+  }
+  other.slabs_.clear();
+  other.free_list_ = nullptr;
+  other.cursor_ = other.slab_end_ = nullptr;
+  other.next_slab_size_ = kFirstSlabSize;
+}
+
+template <typename NodeType>
+void NodePool<NodeType>::swap(NodePool &other) noexcept {
+  slabs_.swap(other.slabs_);
+  std::swap(free_list_, other.free_list_);
+  std::swap(cursor_, other.cursor_);
+  std::swap(slab_end_, other.slab_end_);
+  std::swap(next_slab_size_, other.next_slab_size_);
+}
+
+template <typename NodeType>
+typename NodePool<NodeType>::size_type NodePool<NodeType>::slab_count() const {
+  return slabs_.size();
+}
+
+template <typename NodeType>
+void NodePool<NodeType>::grow() {
+  Slot *slab = AllocateSlab(next_slab_size_);
+  try {
+    slabs_.push_back(slab);
+  } catch (...) {
+    DeallocateSlab(slab);
+    throw;
+  }
+  cursor_ = slab;
+  slab_end_ = slab + next_slab_size_;
+  if (next_slab_size_ < kMaxSlabSize) next_slab_size_ *= 2;
+}
+
+template <typename NodeType>
+typename NodePool<NodeType>::Slot *NodePool<NodeType>::AllocateSlab(
+    size_type count) {
+  if constexpr (kOverAligned) {
+    return static_cast<Slot *>(::operator new(
+        count * sizeof(Slot), std::align_val_t(alignof(Slot))));
+  } else {
+    return static_cast<Slot *>(::operator new(count * sizeof(Slot)));
+  }
+}
+
+template <typename NodeType>
+void NodePool<NodeType>::DeallocateSlab(Slot *slab) {
+  if constexpr (kOverAligned) {
+    ::operator delete(slab, std::align_val_t(alignof(Slot)));
+  } else {
+    ::operator delete(slab);
+  }
+}
+
+}  // namespace s21
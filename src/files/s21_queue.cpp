@@ -17,6 +17,26 @@ template <typename value_type, typename Container>
 queue<value_type, Container>::queue(queue &&q)
     : container_(std::move(q.container_)) {}
 
+template <typename value_type, typename Container>
+template <typename Alloc, typename>
+queue<value_type, Container>::queue(const Alloc &alloc) : container_(alloc) {}
+
+template <typename value_type, typename Container>
+template <typename Alloc, typename>
+queue<value_type, Container>::queue(
+    std::initializer_list<value_type> const &items, const Alloc &alloc)
+    : container_(items, alloc) {}
+
+template <typename value_type, typename Container>
+template <typename Alloc, typename>
+queue<value_type, Container>::queue(const queue &other, const Alloc &alloc)
+    : container_(other.container_, alloc) {}
+
+template <typename value_type, typename Container>
+template <typename Alloc, typename>
+queue<value_type, Container>::queue(queue &&other, const Alloc &alloc)
+    : container_(std::move(other.container_), alloc) {}
+
 template <typename value_type, typename Container>
 queue<value_type, Container>::~queue() {}
 
@@ -55,6 +75,17 @@ void queue<value_type, Container>::push(const_reference value) {
   return container_.push_back(value);
 }
 
+template <typename value_type, typename Container>
+void queue<value_type, Container>::push(value_type &&value) {
+  container_.push_back(std::move(value));
+}
+
+template <typename value_type, typename Container>
+template <typename... Args>
+void queue<value_type, Container>::emplace(Args &&...args) {
+  container_.emplace_back(std::forward<Args>(args)...);
+}
+
 template <typename value_type, typename Container>
 void queue<value_type, Container>::pop() {
   return container_.pop_front();
@@ -0,0 +1,66 @@
+#include "../include/s21_raw_buffer.h"
+
+namespace s21 {
+
+#if defined(__linux__)
+// Отображается ли буфер из bytes байт через mmap
+inline bool RawMapped(std::size_t bytes) { return bytes >= kRawMapBytes; }
+
+// Длина отображения: bytes, округленное вверх до целых страниц
+inline std::size_t RawMapLength(std::size_t bytes) {
+  static const std::size_t page =
+      static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+  return (bytes + page - 1) / page * page;
+}
+#else
+inline bool RawMapped(std::size_t) { return false; }
+#endif
+
+inline void *RawAllocate(std::size_t bytes) {
+  void *data = nullptr;
+#if defined(__linux__)
+  if (RawMapped(bytes)) {
+    data = mmap(nullptr, RawMapLength(bytes), PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (data == MAP_FAILED) throw std::bad_alloc();
+    return data;
+  }
+#endif
+  data = std::malloc(bytes);
+  if (data == nullptr) throw std::bad_alloc();
+  return data;
+}
+
+inline void *RawReallocate(void *data, std::size_t old_bytes,
+                           std::size_t new_bytes) {
+#if defined(__linux__)
+  if (RawMapped(old_bytes) && RawMapped(new_bytes)) {
+    void *moved = mremap(data, RawMapLength(old_bytes),
+                         RawMapLength(new_bytes), MREMAP_MAYMOVE);
+    if (moved == MAP_FAILED) throw std::bad_alloc();
+    return moved;
+  }
+#endif
+  if (!RawMapped(old_bytes) && !RawMapped(new_bytes)) {
+    void *moved = std::realloc(data, new_bytes);
+    if (moved == nullptr) throw std::bad_alloc();
+    return moved;
+  }
+  // Буфер переходит между malloc и mmap: данные копируются один раз
+  void *moved = RawAllocate(new_bytes);
+  std::memcpy(moved, data, old_bytes < new_bytes ? old_bytes : new_bytes);
+  RawDeallocate(data, old_bytes);
+  return moved;
+}
+
+inline void RawDeallocate(void *data, std::size_t bytes) {
+#if defined(__linux__)
+  if (RawMapped(bytes)) {
+    munmap(data, RawMapLength(bytes));
+    return;
+  }
+#endif
+  std::free(data);
+}
+
+}  // namespace s21
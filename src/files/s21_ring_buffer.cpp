@@ -0,0 +1,333 @@
+#include "../include/s21_ring_buffer.h"
+
+namespace s21 {
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer()
+    : alloc_(), data_(nullptr), capacity_(0), head_(0), size_(0) {}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const Allocator &alloc)
+    : alloc_(alloc), data_(nullptr), capacity_(0), head_(0), size_(0) {}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(
+    std::initializer_list<value_type> const &items, const Allocator &alloc)
+    : ring_buffer(alloc) {
+  reserve(items.size());
+  for (const value_type &item : items) push_back(item);
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const ring_buffer &other)
+    : ring_buffer(
+          other,
+          AllocTraits::select_on_container_copy_construction(other.alloc_)) {}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(const ring_buffer &other,
+                                       const Allocator &alloc)
+    : ring_buffer(alloc) {
+  reserve(other.size_);
+  for (size_type i = 0; i < other.size_; ++i) push_back(other[i]);
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(ring_buffer &&other) noexcept
+    : alloc_(std::move(other.alloc_)),
+      data_(other.data_),
+      capacity_(other.capacity_),
+      head_(other.head_),
+      size_(other.size_) {
+  other.data_ = nullptr;
+  other.capacity_ = other.head_ = other.size_ = 0;
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::ring_buffer(ring_buffer &&other,
+                                       const Allocator &alloc)
+    : ring_buffer(alloc) {
+  if (alloc_ == other.alloc_) {
+    Steal(other);
+  } else {
+    // Блок other не освободить своим распределителем: элементы
+    // переносятся по одному
+    reserve(other.size_);
+    for (size_type i = 0; i < other.size_; ++i) {
+      push_back(std::move(other[i]));
+    }
+  }
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator>::~ring_buffer() {
+  clear();
+  Deallocate(data_, capacity_);
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator> &ring_buffer<T, Allocator>::operator=(
+    const ring_buffer &other) {
+  if (this != &other) {
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      ring_buffer copy(other, other.alloc_);
+      Steal(copy);
+      alloc_ = other.alloc_;
+    } else {
+      ring_buffer copy(other, alloc_);
+      Steal(copy);
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+ring_buffer<T, Allocator> &ring_buffer<T, Allocator>::operator=(
+    ring_buffer &&other) noexcept(kNoexceptMoveAssign) {
+  if (this != &other) {
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      Steal(other);
+      alloc_ = std::move(other.alloc_);
+    } else if (alloc_ == other.alloc_) {
+      Steal(other);
+    } else {
+      ring_buffer moved(std::move(other), alloc_);
+      Steal(moved);
+    }
+  }
+  return *this;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::allocator_type
+ring_buffer<T, Allocator>::get_allocator() const {
+  return alloc_;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::front() {
+  if (size_ == 0) throw std::out_of_range("ring_buffer is empty");
+  return data_[head_];
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::const_reference
+ring_buffer<T, Allocator>::front() const {
+  if (size_ == 0) throw std::out_of_range("ring_buffer is empty");
+  return data_[head_];
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::back() {
+  if (size_ == 0) throw std::out_of_range("ring_buffer is empty");
+  return *Slot(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::const_reference
+ring_buffer<T, Allocator>::back() const {
+  if (size_ == 0) throw std::out_of_range("ring_buffer is empty");
+  return *Slot(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::operator[](size_type pos) {
+  return *Slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::const_reference
+ring_buffer<T, Allocator>::operator[](size_type pos) const {
+  return *Slot(pos);
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::reference ring_buffer<T, Allocator>::at(
+    size_type pos) {
+  if (pos >= size_) throw std::out_of_range("Index is out of range");
+  return *Slot(pos);
+}
+
+template <typename T, typename Allocator>
+bool ring_buffer<T, Allocator>::empty() const {
+  return size_ == 0;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::size() const {
+  return size_;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::max_size() const {
+  return std::numeric_limits<size_type>::max() / sizeof(T) / 2;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::capacity() const {
+  return capacity_;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::reserve(size_type size) {
+  if (size <= capacity_) return;
+  if (size > max_size()) {
+    throw std::length_error("Capacity cannot be greater than maximum size");
+  }
+  Reallocate(GrowCapacity(size), 0, [](T *) {});
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+typename ring_buffer<T, Allocator>::reference
+ring_buffer<T, Allocator>::emplace_back(Args &&...args) {
+  if (size_ == capacity_) {
+    Reallocate(GrowCapacity(size_ + 1), 1, [&](T *data) {
+      AllocTraits::construct(alloc_, data, std::forward<Args>(args)...);
+    });
+  } else {
+    AllocTraits::construct(alloc_, Slot(size_), std::forward<Args>(args)...);
+    ++size_;
+  }
+  return *Slot(size_ - 1);
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::pop_front() {
+  if (size_ == 0) return;
+  AllocTraits::destroy(alloc_, data_ + head_);
+  head_ = (head_ + 1) & (capacity_ - 1);
+  --size_;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::clear() {
+  for (size_type i = 0; i < size_; ++i) AllocTraits::destroy(alloc_, Slot(i));
+  head_ = size_ = 0;
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::swap(ring_buffer &other) noexcept {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc_, other.alloc_);
+  }
+  std::swap(data_, other.data_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+template <typename T, typename Allocator>
+template <typename... Args>
+void ring_buffer<T, Allocator>::insert_many_back(Args &&...args) {
+  constexpr size_type kCount = sizeof...(Args);
+  if (size_ + kCount <= capacity_) {
+    // Свободных мест хватает: элементы буфера не переезжают
+    (push_back(std::forward<Args>(args)), ...);
+    return;
+  }
+  if (size_ + kCount > max_size()) {
+    throw std::length_error("Capacity cannot be greater than maximum size");
+  }
+  Reallocate(GrowCapacity(size_ + kCount), kCount, [&](T *data) {
+    size_type built = 0;
+    try {
+      ((AllocTraits::construct(alloc_, data + built,
+                               std::forward<Args>(args)),
+        ++built),
+       ...);
+    } catch (...) {
+      for (size_type i = 0; i < built; ++i) {
+        AllocTraits::destroy(alloc_, data + i);
+      }
+      throw;
+    }
+  });
+}
+
+template <typename T, typename Allocator>
+T *ring_buffer<T, Allocator>::Slot(size_type pos) const {
+  return data_ + ((head_ + pos) & (capacity_ - 1));
+}
+
+template <typename T, typename Allocator>
+template <typename Build>
+void ring_buffer<T, Allocator>::Reallocate(size_type capacity, size_type gap,
+                                           Build build) {
+  T *data = Allocate(capacity);
+  size_type moved = 0;
+  bool built = false;
+  try {
+    build(data + size_);
+    built = true;
+    for (; moved < size_; ++moved) {
+      AllocTraits::construct(alloc_, data + moved,
+                             std::move_if_noexcept(*Slot(moved)));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) {
+      AllocTraits::destroy(alloc_, data + i);
+    }
+    if (built) {
+      for (size_type i = 0; i < gap; ++i) {
+        AllocTraits::destroy(alloc_, data + size_ + i);
+      }
+    }
+    Deallocate(data, capacity);
+    throw;
+  }
+  size_type size = size_ + gap;
+  clear();
+  Deallocate(data_, capacity_);
+  data_ = data;
+  capacity_ = capacity;
+  size_ = size;
+}
+
+template <typename T, typename Allocator>
+typename ring_buffer<T, Allocator>::size_type
+ring_buffer<T, Allocator>::GrowCapacity(size_type size) const {
+  size_type capacity = capacity_ == 0 ? kMinCapacity : capacity_;
+  while (capacity < size) capacity *= 2;
+  return capacity;
+}
+
+template <typename T, typename Allocator>
+T *ring_buffer<T, Allocator>::Allocate(size_type capacity) {
+  return AllocTraits::allocate(alloc_, capacity);
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::Deallocate(T *data, size_type capacity) {
+  if (data != nullptr) AllocTraits::deallocate(alloc_, data, capacity);
+}
+
+template <typename T, typename Allocator>
+void ring_buffer<T, Allocator>::Steal(ring_buffer &other) noexcept {
+  clear();
+  Deallocate(data_, capacity_);
+  data_ = other.data_;
+  capacity_ = other.capacity_;
+  head_ = other.head_;
+  size_ = other.size_;
+  other.data_ = nullptr;
+  other.capacity_ = other.head_ = other.size_ = 0;
+}
+
+}  // namespace s21
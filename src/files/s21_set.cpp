@@ -3,73 +3,101 @@
 namespace s21 {
 
 // Конструктор со списком инициализации
-template <typename key_type>
-set<key_type>::set(const std::initializer_list<value_type> &items) {
-  for (const value_type &item : items) {
-    this->insert(item);
-  }
+template <typename key_type, typename Compare, typename NodeAllocator>
+set<key_type, Compare, NodeAllocator>::set(
+    const std::initializer_list<value_type> &items) {
+  assign_sorted(items.begin(), items.end());
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+set<key_type, Compare, NodeAllocator>::set(
+    std::initializer_list<value_type> const &items, const NodeAllocator &alloc)
+    : BinaryTree<key_type, key_type, Compare, NodeAllocator>(alloc) {
+  assign_sorted(items.begin(), items.end());
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename InputIt>
+set<key_type, Compare, NodeAllocator>::set(InputIt first, InputIt last) {
+  assign_sorted(first, last);
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename InputIt>
+void set<key_type, Compare, NodeAllocator>::assign_sorted(
+    InputIt first, InputIt last) {
+  vector<key_type> keys;
+  for (; first != last; ++first) keys.push_back(*first);
+  this->AssignSorted(keys, true);
 }
 
 // Оператор присваивания (копирования)
-template <typename key_type>
-set<key_type> &set<key_type>::operator=(const set &other) {
-  if (this != &other) {
-    BinaryTree<key_type, key_type>::operator=(other);
-  }
+template <typename key_type, typename Compare, typename NodeAllocator>
+set<key_type, Compare, NodeAllocator> &
+set<key_type, Compare, NodeAllocator>::operator=(const set &other) {
+  this->CopyFrom(other);
   return *this;
 }
 
 // Оператор присваивания (перемещения)
-template <typename key_type>
-set<key_type> &set<key_type>::operator=(set &&other) noexcept {
+template <typename key_type, typename Compare, typename NodeAllocator>
+set<key_type, Compare, NodeAllocator> &
+set<key_type, Compare, NodeAllocator>::operator=(set &&other) noexcept(
+    NodeAllocator::kMoveAssignNodes) {
   if (this != &other) {
-    BinaryTree<key_type, key_type>::operator=(std::move(other));
+    BinaryTree<key_type, key_type, Compare, NodeAllocator>::operator=(
+        std::move(other));
   }
   return *this;
 }
 
 // Специальные методы для set
-template <typename key_type>
-typename set<key_type>::size_type set<key_type>::count(const key_type &key) {
-  return BinaryTree<key_type, key_type>::contains(key) ? 1 : 0;
-}
-
-template <typename Key>
-typename set<Key>::iterator set<Key>::lower_bound(const key_type &key) {
-  Node<key_type, value_type> *current = this->root_;
-  Node<key_type, value_type> *result = nullptr;
-
-  while (current != nullptr) {
-    if (current->key >= key) {
-      result = current;
-      current = current->left;
-    } else {
-      current = current->right;
-    }
-  }
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename set<key_type, Compare, NodeAllocator>::size_type
+set<key_type, Compare, NodeAllocator>::count(const key_type &key) {
+  return this->FindNode(key) != nullptr ? 1 : 0;
+}
 
-  return result == nullptr ? this->end() : iterator(result);
+template <typename key_type, typename Compare, typename NodeAllocator>
+template <typename K, typename C, typename>
+typename set<key_type, Compare, NodeAllocator>::size_type
+set<key_type, Compare, NodeAllocator>::count(const K &key) {
+  return this->FindNode(key) != nullptr ? 1 : 0;
 }
 
-template <typename Key>
-typename set<Key>::iterator set<Key>::upper_bound(const key_type &key) {
-  Node<key_type, value_type> *current = this->root_;
-  Node<key_type, value_type> *result = nullptr;
+template <typename Key, typename Compare, typename NodeAllocator>
+typename set<Key, Compare, NodeAllocator>::iterator
+set<Key, Compare, NodeAllocator>::lower_bound(const key_type &key) {
+  node_type *result = this->LowerBound(key);
+  return result == nullptr ? this->end() : iterator(result, this);
+}
 
-  while (current != nullptr) {
-    if (current->key > key) {
-      result = current;
-      current = current->left;
-    } else {
-      current = current->right;
-    }
-  }
+template <typename Key, typename Compare, typename NodeAllocator>
+typename set<Key, Compare, NodeAllocator>::iterator
+set<Key, Compare, NodeAllocator>::upper_bound(const key_type &key) {
+  node_type *result = this->UpperBound(key);
+  return result == nullptr ? this->end() : iterator(result, this);
+}
 
-  return result == nullptr ? this->end() : iterator(result);
+template <typename Key, typename Compare, typename NodeAllocator>
+template <typename K, typename C, typename>
+typename set<Key, Compare, NodeAllocator>::iterator
+set<Key, Compare, NodeAllocator>::lower_bound(const K &key) {
+  node_type *result = this->LowerBound(key);
+  return result == nullptr ? this->end() : iterator(result, this);
 }
 
-template <typename key_type>
-typename set<key_type>::value_type set<key_type>::extract(const key_type &key) {
+template <typename Key, typename Compare, typename NodeAllocator>
+template <typename K, typename C, typename>
+typename set<Key, Compare, NodeAllocator>::iterator
+set<Key, Compare, NodeAllocator>::upper_bound(const K &key) {
+  node_type *result = this->UpperBound(key);
+  return result == nullptr ? this->end() : iterator(result, this);
+}
+
+template <typename key_type, typename Compare, typename NodeAllocator>
+typename set<key_type, Compare, NodeAllocator>::value_type
+set<key_type, Compare, NodeAllocator>::extract(const key_type &key) {
   auto it = this->find(key);
   if (it != this->end()) {
     value_type val = *it;
@@ -80,13 +108,31 @@ typename set<key_type>::value_type set<key_type>::extract(const key_type &key) {
 }
 
 // Реализация метода insert_many
-template <typename Key>
+template <typename Key, typename Compare, typename NodeAllocator>
 template <typename... Args>
-vector<std::pair<typename set<Key>::iterator, bool>> set<Key>::insert_many(
-    Args &&...args) {
+vector<std::pair<typename set<Key, Compare, NodeAllocator>::iterator, bool>>
+set<Key, Compare, NodeAllocator>::insert_many(Args &&...args) {
   vector<std::pair<iterator, bool>> results;
   (..., results.push_back(this->insert(std::forward<Args>(args))));
   return results;
 }
 
+template <typename Key, typename Compare, typename NodeAllocator>
+template <typename... Args>
+std::pair<typename set<Key, Compare, NodeAllocator>::iterator, bool>
+set<Key, Compare, NodeAllocator>::emplace(Args &&...args) {
+  auto result = this->EmplaceNode(
+      this->alloc_.create(std::forward<Args>(args)...));
+  return {iterator(result.first, this), result.second};
+}
+
+template <typename Key, typename Compare, typename NodeAllocator>
+template <typename... Args>
+typename set<Key, Compare, NodeAllocator>::iterator
+set<Key, Compare, NodeAllocator>::emplace_hint(iterator hint, Args &&...args) {
+  node_type *new_node = this->alloc_.create(std::forward<Args>(args)...);
+  return iterator(this->EmplaceNodeHint(this->GetNode(hint), new_node).first,
+                  this);
+}
+
 }  // namespace s21
\ No newline at end of file
@@ -0,0 +1,399 @@
+#include "../include/s21_small_vector.h"
+
+namespace s21 {
+
+/* Конструкторы */
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector() noexcept
+    : elems(InlineData()), a_size(0), c_size(N) {}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(size_type n) : small_vector() {
+  reserve(n);
+  std::uninitialized_value_construct(elems, elems + n);
+  a_size = n;
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(
+    std::initializer_list<value_type> const &items)
+    : small_vector() {
+  reserve(items.size());
+  std::uninitialized_copy(items.begin(), items.end(), elems);
+  a_size = items.size();
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(const small_vector &other) : small_vector() {
+  reserve(other.a_size);
+  std::uninitialized_copy(other.elems, other.elems + other.a_size, elems);
+  a_size = other.a_size;
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::small_vector(small_vector &&other) noexcept(kNoexceptMove)
+    : small_vector() {
+  TakeFrom(other);
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N>::~small_vector() {
+  Release();
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(const small_vector &other) {
+  if (this != &other) {
+    small_vector copy(other);
+    *this = std::move(copy);
+  }
+  return *this;
+}
+
+template <typename T, std::size_t N>
+small_vector<T, N> &small_vector<T, N>::operator=(
+    small_vector &&other) noexcept(kNoexceptMove) {
+  if (this != &other) {
+    Release();
+    TakeFrom(other);
+  }
+  return *this;
+}
+
+/* Доступ */
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::at(size_type pos) {
+  if (pos >= a_size) {
+    throw std::out_of_range("Index is out of range");
+  }
+  return elems[pos];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::reference small_vector<T, N>::operator[](
+    size_type pos) {
+  return elems[pos];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::operator[](
+    size_type pos) const {
+  return elems[pos];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::front() {
+  return elems[0];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_reference small_vector<T, N>::back() {
+  return elems[a_size - 1];
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::data() {
+  return elems;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::data() const {
+  return elems;
+}
+
+/* Итератор */
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::begin() {
+  return elems;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::end() {
+  return elems + a_size;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::begin() const {
+  return elems;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::const_iterator small_vector<T, N>::end() const {
+  return elems + a_size;
+}
+
+/* Capacity */
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::empty() const {
+  return !a_size;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::size() const {
+  return a_size;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::max_size() const {
+  return std::numeric_limits<size_type>::max();
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::reserve(size_type size) {
+  if (size > max_size()) {
+    throw std::length_error("Capacity cannot be greater than maximum size");
+  }
+  if (size > c_size) Reallocate(size, a_size, 0, [](value_type *) {});
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::capacity() const {
+  return c_size;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::shrink_to_fit() {
+  if (!is_inline() && c_size > a_size) {
+    Reallocate(a_size, a_size, 0, [](value_type *) {});
+  }
+}
+
+template <typename T, std::size_t N>
+bool small_vector<T, N>::is_inline() const {
+  return elems == InlineData();
+}
+
+/* Модификаторы */
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::clear() {
+  std::destroy(elems, elems + a_size);
+  a_size = 0;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert(
+    iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+typename small_vector<T, N>::iterator small_vector<T, N>::emplace(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos - begin();
+  if (a_size == c_size) {
+    Reallocate(GrowCapacity(a_size + 1), index, 1, [&](value_type *data) {
+      new (data) T(std::forward<Args>(args)...);
+    });
+  } else if (index == a_size) {
+    new (elems + a_size) T(std::forward<Args>(args)...);
+    ++a_size;
+  } else {
+    // args могут ссылаться на сдвигаемый элемент, поэтому новый элемент
+    // создается до сдвига
+    value_type value(std::forward<Args>(args)...);
+    new (elems + a_size) T(std::move(elems[a_size - 1]));
+    ++a_size;
+    std::move_backward(elems + index, elems + a_size - 2,
+                       elems + a_size - 1);
+    elems[index] = std::move(value);
+  }
+  return begin() + index;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::erase(iterator pos) {
+  std::move(pos + 1, end(), pos);
+  --a_size;
+  elems[a_size].~T();
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+typename small_vector<T, N>::reference small_vector<T, N>::emplace_back(
+    Args &&...args) {
+  if (a_size == c_size) {
+    Reallocate(GrowCapacity(a_size + 1), a_size, 1, [&](value_type *data) {
+      new (data) T(std::forward<Args>(args)...);
+    });
+  } else {
+    new (elems + a_size) T(std::forward<Args>(args)...);
+    ++a_size;
+  }
+  return elems[a_size - 1];
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::pop_back() {
+  if (a_size > 0) {
+    --a_size;
+    elems[a_size].~T();
+  }
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::resize(size_type new_size) {
+  if (new_size > c_size) {
+    reserve(new_size);
+  }
+  if (new_size > a_size) {
+    std::uninitialized_value_construct(elems + a_size, elems + new_size);
+  } else {
+    std::destroy(elems + new_size, elems + a_size);
+  }
+  a_size = new_size;
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::swap(small_vector &other) noexcept(kNoexceptMove) {
+  if (!is_inline() && !other.is_inline()) {
+    std::swap(elems, other.elems);
+    std::swap(a_size, other.a_size);
+    std::swap(c_size, other.c_size);
+  } else {
+    // Хотя бы одна сторона во встроенном буфере: ее элементы переносятся
+    small_vector tmp(std::move(other));
+    other = std::move(*this);
+    *this = std::move(tmp);
+  }
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+typename small_vector<T, N>::iterator small_vector<T, N>::insert_many(
+    const_iterator pos, Args &&...args) {
+  constexpr size_type kCount = sizeof...(Args);
+  size_type index = pos - begin();
+  if (a_size + kCount > c_size) {
+    Reallocate(GrowCapacity(a_size + kCount), index, kCount,
+               [&](value_type *data) {
+                 ConstructEach(data, std::forward<Args>(args)...);
+               });
+  } else {
+    // Элементы создаются в конце и одним поворотом встают на место
+    ConstructEach(elems + a_size, std::forward<Args>(args)...);
+    size_type old_size = a_size;
+    a_size += kCount;
+    std::rotate(elems + index, elems + old_size, elems + a_size);
+  }
+  return begin() + index + kCount;
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+void small_vector<T, N>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+/* Память */
+
+template <typename T, std::size_t N>
+template <typename Build>
+void small_vector<T, N>::Reallocate(size_type capacity, size_type index,
+                                    size_type gap, Build build) {
+  // Во встроенный буфер элементы возвращаются только из кучи
+  bool to_inline = capacity <= N;
+  value_type *data = to_inline ? InlineData() : Allocate(capacity);
+  size_type moved = 0;
+  bool built = false;
+  try {
+    build(data + index);
+    built = true;
+    for (; moved < a_size; ++moved) {
+      new (data + moved + (moved < index ? 0 : gap))
+          T(std::move_if_noexcept(elems[moved]));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) data[i + (i < index ? 0 : gap)].~T();
+    if (built) std::destroy(data + index, data + index + gap);
+    if (!to_inline) Deallocate(data, capacity);
+    throw;
+  }
+  size_type size = a_size + gap;
+  clear();
+  if (!is_inline()) Deallocate(elems, c_size);
+  elems = data;
+  c_size = to_inline ? N : capacity;
+  a_size = size;
+}
+
+template <typename T, std::size_t N>
+typename small_vector<T, N>::size_type small_vector<T, N>::GrowCapacity(
+    size_type size) const {
+  size_type grown = c_size * 2;
+  return grown < size ? size : grown;
+}
+
+template <typename T, std::size_t N>
+template <typename... Args>
+void small_vector<T, N>::ConstructEach(value_type *data, Args &&...args) {
+  size_type built = 0;
+  try {
+    ((new (data + built) T(std::forward<Args>(args)), ++built), ...);
+  } catch (...) {
+    std::destroy(data, data + built);
+    throw;
+  }
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::TakeFrom(small_vector &other) noexcept(kNoexceptMove) {
+  if (!other.is_inline()) {
+    elems = other.elems;
+    a_size = other.a_size;
+    c_size = other.c_size;
+    other.elems = other.InlineData();
+    other.a_size = 0;
+    other.c_size = N;
+  } else {
+    std::uninitialized_move(other.elems, other.elems + other.a_size, elems);
+    a_size = other.a_size;
+    other.clear();
+  }
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::Release() {
+  clear();
+  if (!is_inline()) Deallocate(elems, c_size);
+  elems = InlineData();
+  c_size = N;
+}
+
+template <typename T, std::size_t N>
+T *small_vector<T, N>::InlineData() const {
+  return reinterpret_cast<T *>(const_cast<unsigned char *>(buffer));
+}
+
+template <typename T, std::size_t N>
+T *small_vector<T, N>::Allocate(size_type capacity) {
+  return std::allocator<T>().allocate(capacity);
+}
+
+template <typename T, std::size_t N>
+void small_vector<T, N>::Deallocate(value_type *data, size_type capacity) {
+  std::allocator<T>().deallocate(data, capacity);
+}
+
+}  // namespace s21
@@ -18,6 +18,26 @@ template <class T, class Container>
 stack<T, Container>::stack(stack &&stc)
     : container_(std::move(stc.container_)) {}
 
+template <class T, class Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(const Alloc &alloc) : container_(alloc) {}
+
+template <class T, class Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(std::initializer_list<value_type> const &items,
+                           const Alloc &alloc)
+    : container_(items, alloc) {}
+
+template <class T, class Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(const stack &other, const Alloc &alloc)
+    : container_(other.container_, alloc) {}
+
+template <class T, class Container>
+template <typename Alloc, typename>
+stack<T, Container>::stack(stack &&other, const Alloc &alloc)
+    : container_(std::move(other.container_), alloc) {}
+
 template <class T, class Container>
 stack<T, Container>::~stack() {}
 
@@ -53,6 +73,17 @@ void stack<T, Container>::push(const_reference value) {
   container_.push_back(value);
 }
 
+template <class T, class Container>
+void stack<T, Container>::push(value_type &&value) {
+  container_.push_back(std::move(value));
+}
+
+template <class T, class Container>
+template <typename... Args>
+void stack<T, Container>::emplace(Args &&...args) {
+  container_.emplace_back(std::forward<Args>(args)...);
+}
+
 template <class T, class Container>
 void stack<T, Container>::pop() {
   container_.pop_back();
@@ -0,0 +1,522 @@
+#include "../include/s21_swiss_table.h"
+
+namespace s21 {
+
+#if defined(__SSE2__)
+inline SwissGroup::SwissGroup(const int8_t *ctrl)
+    : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ctrl))) {}
+
+inline uint32_t SwissGroup::Match(int8_t h2) const {
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+}
+
+inline uint32_t SwissGroup::MatchEmpty() const {
+  return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(kSwissEmpty), ctrl_));
+}
+
+// Старший бит байта управления установлен ровно у свободных и удаленных
+inline uint32_t SwissGroup::MatchEmptyOrDeleted() const {
+  return _mm_movemask_epi8(ctrl_);
+}
+#else
+inline SwissGroup::SwissGroup(const int8_t *ctrl) : ctrl_(ctrl) {}
+
+inline uint32_t SwissGroup::Match(int8_t h2) const {
+  uint32_t mask = 0;
+  for (std::size_t i = 0; i < kSwissGroupWidth; ++i) {
+    mask |= static_cast<uint32_t>(ctrl_[i] == h2) << i;
+  }
+  return mask;
+}
+
+inline uint32_t SwissGroup::MatchEmpty() const {
+  return Match(kSwissEmpty);
+}
+
+inline uint32_t SwissGroup::MatchEmptyOrDeleted() const {
+  uint32_t mask = 0;
+  for (std::size_t i = 0; i < kSwissGroupWidth; ++i) {
+    mask |= static_cast<uint32_t>(ctrl_[i] < 0) << i;
+  }
+  return mask;
+}
+#endif
+
+// Возвращает номер младшего установленного бита ненулевой маски
+inline std::size_t SwissLowestBit(uint32_t mask) {
+#if defined(__GNUC__)
+  return __builtin_ctz(mask);
+#else
+  std::size_t i = 0;
+  for (; !(mask & 1); mask >>= 1) ++i;
+  return i;
+#endif
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+SwissTable<Key, T, Hash, KeyEqual>::SwissTable()
+    : hash_(),
+      eq_(),
+      ctrl_(nullptr),
+      slots_(nullptr),
+      capacity_(0),
+      size_(0),
+      growth_left_(0),
+      max_load_(0.875f) {}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+SwissTable<Key, T, Hash, KeyEqual>::SwissTable(const SwissTable &other)
+    : hash_(other.hash_),
+      eq_(other.eq_),
+      ctrl_(nullptr),
+      slots_(nullptr),
+      capacity_(0),
+      size_(0),
+      growth_left_(0),
+      max_load_(other.max_load_) {
+  if (other.capacity_ == 0) return;
+  // Копия повторяет расположение ячеек оригинала вместе с удаленными
+  ctrl_ = new int8_t[other.capacity_];
+  slots_ = new Slot[other.capacity_];
+  capacity_ = other.capacity_;
+  std::copy(other.ctrl_, other.ctrl_ + capacity_, ctrl_);
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) {
+      new (&slots_[i].value) slot_value_type(other.slots_[i].value);
+    }
+  }
+  size_ = other.size_;
+  growth_left_ = other.growth_left_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+SwissTable<Key, T, Hash, KeyEqual>::SwissTable(SwissTable &&other) noexcept
+    : hash_(std::move(other.hash_)),
+      eq_(std::move(other.eq_)),
+      ctrl_(other.ctrl_),
+      slots_(other.slots_),
+      capacity_(other.capacity_),
+      size_(other.size_),
+      growth_left_(other.growth_left_),
+      max_load_(other.max_load_) {
+  other.ctrl_ = nullptr;
+  other.slots_ = nullptr;
+  other.capacity_ = 0;
+  other.size_ = 0;
+  other.growth_left_ = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+SwissTable<Key, T, Hash, KeyEqual>::~SwissTable() {
+  Release();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+SwissTable<Key, T, Hash, KeyEqual> &SwissTable<Key, T, Hash, KeyEqual>::
+operator=(const SwissTable &other) {
+  if (this != &other) {
+    SwissTable copy(other);
+    swap(copy);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+SwissTable<Key, T, Hash, KeyEqual> &SwissTable<Key, T, Hash, KeyEqual>::
+operator=(SwissTable &&other) noexcept {
+  if (this != &other) {
+    Release();
+    swap(other);
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::iterator
+SwissTable<Key, T, Hash, KeyEqual>::find(const key_type &key) const {
+  return iterator(this, FindIndex(key, Mix(hash_(key))));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool SwissTable<Key, T, Hash, KeyEqual>::contains(const key_type &key) const {
+  return FindIndex(key, Mix(hash_(key))) != capacity_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::size_type
+SwissTable<Key, T, Hash, KeyEqual>::count(const key_type &key) const {
+  return contains(key) ? 1 : 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool SwissTable<Key, T, Hash, KeyEqual>::empty() const {
+  return size_ == 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::size_type
+SwissTable<Key, T, Hash, KeyEqual>::size() const {
+  return size_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::size_type
+SwissTable<Key, T, Hash, KeyEqual>::max_size() const {
+  return std::numeric_limits<size_type>::max() / (sizeof(Slot) + 1) / 2;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::erase(iterator pos) {
+  size_type i = pos.iter_index;
+  if (i >= capacity_ || ctrl_[i] < 0) return;
+  DestroySlot(slots_[i]);
+  --size_;
+  // Проба идет дальше группы, только если в ней не было свободных ячеек.
+  // Если свободная ячейка в группе есть, ни один поиск не проходил через
+  // нее дальше, и ячейку можно сразу сделать свободной, а не удаленной
+  size_type group = i - i % kSwissGroupWidth;
+  if (SwissGroup(ctrl_ + group).MatchEmpty() != 0) {
+    ctrl_[i] = kSwissEmpty;
+    ++growth_left_;
+  } else {
+    ctrl_[i] = kSwissDeleted;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool SwissTable<Key, T, Hash, KeyEqual>::erase(const key_type &key) {
+  size_type i = FindIndex(key, Mix(hash_(key)));
+  if (i == capacity_) return false;
+  erase(iterator(this, i));
+  return true;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::swap(SwissTable &other) {
+  std::swap(hash_, other.hash_);
+  std::swap(eq_, other.eq_);
+  std::swap(ctrl_, other.ctrl_);
+  std::swap(slots_, other.slots_);
+  std::swap(capacity_, other.capacity_);
+  std::swap(size_, other.size_);
+  std::swap(growth_left_, other.growth_left_);
+  std::swap(max_load_, other.max_load_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::clear() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) DestroySlot(slots_[i]);
+    ctrl_[i] = kSwissEmpty;
+  }
+  size_ = 0;
+  growth_left_ = GrowthLimit(capacity_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::iterator
+SwissTable<Key, T, Hash, KeyEqual>::begin() const {
+  size_type i = 0;
+  while (i < capacity_ && ctrl_[i] < 0) ++i;
+  return iterator(this, i);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::iterator
+SwissTable<Key, T, Hash, KeyEqual>::end() const {
+  return iterator(this, capacity_);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::size_type
+SwissTable<Key, T, Hash, KeyEqual>::bucket_count() const {
+  return capacity_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+float SwissTable<Key, T, Hash, KeyEqual>::load_factor() const {
+  return capacity_ == 0 ? 0.0f : static_cast<float>(size_) / capacity_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+float SwissTable<Key, T, Hash, KeyEqual>::max_load_factor() const {
+  return max_load_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::max_load_factor(float ml) {
+  if (!(ml > 0.0f)) {
+    throw std::invalid_argument("Max load factor must be positive");
+  }
+  // Занятые и удаленные ячейки расходуют запас одинаково
+  size_type used = GrowthLimit(capacity_) - growth_left_;
+  max_load_ = ml > 1.0f ? 1.0f : ml;
+  size_type limit = GrowthLimit(capacity_);
+  if (limit >= used) {
+    growth_left_ = limit - used;
+  } else {
+    rehash(0);
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::rehash(size_type count) {
+  size_type cap = 0;
+  if (count > 0 || size_ > 0) {
+    cap = kSwissGroupWidth;
+    while (cap < count || GrowthLimit(cap) < size_) cap *= 2;
+  }
+  Resize(cap);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::reserve(size_type count) {
+  if (count <= size_ + growth_left_) return;
+  size_type cap = capacity_ == 0 ? kSwissGroupWidth : capacity_;
+  while (GrowthLimit(cap) < count) cap *= 2;
+  Resize(cap);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::hasher
+SwissTable<Key, T, Hash, KeyEqual>::hash_function() const {
+  return hash_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::key_equal
+SwissTable<Key, T, Hash, KeyEqual>::key_eq() const {
+  return eq_;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename SwissTable<Key, T, Hash, KeyEqual>::iterator, bool>
+SwissTable<Key, T, Hash, KeyEqual>::EmplaceUnique(K &&key, Args &&...args) {
+  const key_type &lookup = key;
+  size_t hash = Mix(hash_(lookup));
+  size_type i = FindIndex(lookup, hash);
+  if (i != capacity_) return {iterator(this, i), false};
+
+  i = capacity_ == 0 ? capacity_ : FindInsertIndex(hash);
+  // Удаленная ячейка занимается без роста таблицы; свободная - только
+  // пока не исчерпан запас
+  if (i == capacity_ || (ctrl_[i] == kSwissEmpty && growth_left_ == 0)) {
+    Grow();
+    i = FindInsertIndex(hash);
+  }
+  if constexpr (kKeyOnly) {
+    new (&slots_[i].value) slot_value_type(std::forward<K>(key));
+  } else {
+    new (&slots_[i].value) slot_value_type(
+        std::piecewise_construct, std::forward_as_tuple(std::forward<K>(key)),
+        std::forward_as_tuple(std::forward<Args>(args)...));
+  }
+  if (ctrl_[i] == kSwissEmpty) --growth_left_;
+  ctrl_[i] = static_cast<int8_t>(hash >> 57);
+  ++size_;
+  return {iterator(this, i), true};
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::Merge(SwissTable &other) {
+  if (this == &other) return;
+  for (size_type i = 0; i < other.capacity_; ++i) {
+    if (other.ctrl_[i] < 0) continue;
+    const key_type &key = other.SlotKey(i);
+    if (contains(key)) continue;
+    if constexpr (kKeyOnly) {
+      EmplaceUnique(std::move(other.slots_[i].value));
+    } else {
+      EmplaceUnique(std::move(other.slots_[i].value.first),
+                    std::move(other.slots_[i].value.second));
+    }
+    other.erase(iterator(&other, i));
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::reference
+SwissTable<Key, T, Hash, KeyEqual>::Value(size_type i) const {
+  if constexpr (kKeyOnly) {
+    return slots_[i].value;
+  } else {
+    return slots_[i].value.second;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+size_t SwissTable<Key, T, Hash, KeyEqual>::Mix(size_t hash) {
+  uint64_t mixed = static_cast<uint64_t>(hash) * 0x9E3779B97F4A7C15ULL;
+  return static_cast<size_t>(mixed ^ (mixed >> 32));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::size_type
+SwissTable<Key, T, Hash, KeyEqual>::FindIndex(const key_type &key,
+                                              size_t hash) const {
+  if (capacity_ == 0) return capacity_;
+  // Старшие 7 бит хеша - H2 в байтах управления, младшие выбирают группу
+  int8_t h2 = static_cast<int8_t>(hash >> 57);
+  size_type mask = capacity_ / kSwissGroupWidth - 1;
+  size_type group = hash & mask;
+  for (size_type step = 1;; ++step) {
+    SwissGroup ctrl(ctrl_ + group * kSwissGroupWidth);
+    for (uint32_t match = ctrl.Match(h2); match != 0; match &= match - 1) {
+      size_type i = group * kSwissGroupWidth + SwissLowestBit(match);
+      if (eq_(SlotKey(i), key)) return i;
+    }
+    // Свободная ячейка обрывает пробу: иначе ключ занял бы ее
+    if (ctrl.MatchEmpty() != 0) return capacity_;
+    group = (group + step) & mask;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::size_type
+SwissTable<Key, T, Hash, KeyEqual>::FindInsertIndex(size_t hash) const {
+  size_type mask = capacity_ / kSwissGroupWidth - 1;
+  size_type group = hash & mask;
+  for (size_type step = 1;; ++step) {
+    uint32_t free =
+        SwissGroup(ctrl_ + group * kSwissGroupWidth).MatchEmptyOrDeleted();
+    if (free != 0) return group * kSwissGroupWidth + SwissLowestBit(free);
+    group = (group + step) & mask;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::size_type
+SwissTable<Key, T, Hash, KeyEqual>::GrowthLimit(size_type cap) const {
+  // Хотя бы одна свободная ячейка нужна, чтобы проба отсутствующего
+  // ключа завершалась. При max_load_factor меньше 1/cap произведение
+  // округляется до нуля, но в непустой таблице есть место хотя бы под
+  // один элемент
+  if (cap == 0) return 0;
+  size_type limit = static_cast<size_type>(cap * max_load_);
+  if (limit == 0) limit = 1;
+  return limit < cap - 1 ? limit : cap - 1;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::Resize(size_type cap) {
+  int8_t *old_ctrl = ctrl_;
+  Slot *old_slots = slots_;
+  size_type old_capacity = capacity_;
+
+  ctrl_ = cap == 0 ? nullptr : new int8_t[cap];
+  slots_ = cap == 0 ? nullptr : new Slot[cap];
+  capacity_ = cap;
+  std::fill(ctrl_, ctrl_ + cap, kSwissEmpty);
+  growth_left_ = GrowthLimit(cap) - size_;
+  for (size_type i = 0; i < old_capacity; ++i) {
+    if (old_ctrl[i] < 0) continue;
+    const key_type *key;
+    if constexpr (kKeyOnly) {
+      key = &old_slots[i].value;
+    } else {
+      key = &old_slots[i].value.first;
+    }
+    size_t hash = Mix(hash_(*key));
+    size_type j = FindInsertIndex(hash);
+    ctrl_[j] = static_cast<int8_t>(hash >> 57);
+    new (&slots_[j].value) slot_value_type(std::move(old_slots[i].value));
+    DestroySlot(old_slots[i]);
+  }
+  delete[] old_ctrl;
+  delete[] old_slots;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::Grow() {
+  // Если удаленные ячейки занимают больше половины запаса, таблица
+  // перестраивается в той же емкости, иначе удваивается. При малом
+  // max_load_factor одного удвоения может не хватить на новый элемент
+  size_type cap = capacity_ == 0 ? kSwissGroupWidth : capacity_;
+  if (capacity_ != 0 && size_ * 2 > GrowthLimit(capacity_)) cap *= 2;
+  while (GrowthLimit(cap) <= size_) cap *= 2;
+  Resize(cap);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+const typename SwissTable<Key, T, Hash, KeyEqual>::key_type &
+SwissTable<Key, T, Hash, KeyEqual>::SlotKey(size_type i) const {
+  if constexpr (kKeyOnly) {
+    return slots_[i].value;
+  } else {
+    return slots_[i].value.first;
+  }
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::DestroySlot(Slot &slot) {
+  slot.value.~slot_value_type();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void SwissTable<Key, T, Hash, KeyEqual>::Release() {
+  for (size_type i = 0; i < capacity_; ++i) {
+    if (ctrl_[i] >= 0) DestroySlot(slots_[i]);
+  }
+  delete[] ctrl_;
+  delete[] slots_;
+  ctrl_ = nullptr;
+  slots_ = nullptr;
+  capacity_ = 0;
+  size_ = 0;
+  growth_left_ = 0;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::iterator
+SwissTable<Key, T, Hash, KeyEqual>::Iterator::operator++(int) {
+  iterator temp = *this;
+  ++(*this);
+  return temp;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::iterator &
+SwissTable<Key, T, Hash, KeyEqual>::Iterator::operator++() {
+  size_type capacity = iter_table->capacity_;
+  if (iter_index >= capacity) return *this;
+  ++iter_index;
+  while (iter_index < capacity && iter_table->ctrl_[iter_index] < 0) {
+    ++iter_index;
+  }
+  return *this;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool SwissTable<Key, T, Hash, KeyEqual>::Iterator::operator==(
+    const iterator &other) const {
+  return iter_table == other.iter_table && iter_index == other.iter_index;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+bool SwissTable<Key, T, Hash, KeyEqual>::Iterator::operator!=(
+    const iterator &other) const {
+  return !(*this == other);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::const_reference
+SwissTable<Key, T, Hash, KeyEqual>::Iterator::operator*() const {
+  if (iter_index >= iter_table->capacity_) {
+    throw std::out_of_range("Iterator is out of range");
+  }
+  return iter_table->Value(iter_index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+const Key &SwissTable<Key, T, Hash, KeyEqual>::Iterator::first() const {
+  return iter_table->SlotKey(iter_index);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+typename SwissTable<Key, T, Hash, KeyEqual>::reference
+SwissTable<Key, T, Hash, KeyEqual>::Iterator::second() const {
+  return iter_table->Value(iter_index);
+}
+
+}  // namespace s21
@@ -0,0 +1,83 @@
+#include "../include/s21_unordered_map.h"
+
+namespace s21 {
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(
+    std::initializer_list<value_type> const &items) {
+  this->reserve(items.size());
+  for (const value_type &item : items) insert(item);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_map<Key, T, Hash, KeyEqual>::unordered_map(InputIt first,
+                                                     InputIt last) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<Key, T, Hash, KeyEqual>::at(const key_type &key) {
+  iterator it = this->find(key);
+  if (it == this->end()) {
+    throw std::out_of_range("Key not found");
+  }
+  return it.second();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+T &unordered_map<Key, T, Hash, KeyEqual>::operator[](const key_type &key) {
+  return try_emplace(key).first.second();
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert(const value_type &value) {
+  return this->EmplaceUnique(value.first, value.second);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::insert_or_assign(
+    const key_type &key, const mapped_type &obj) {
+  auto result = this->EmplaceUnique(key, obj);
+  if (!result.second) result.first.second() = obj;
+  return result;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::emplace(Args &&...args) {
+  std::pair<key_type, mapped_type> item(std::forward<Args>(args)...);
+  return this->EmplaceUnique(std::move(item.first), std::move(item.second));
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename K, typename... Args>
+std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator, bool>
+unordered_map<Key, T, Hash, KeyEqual>::try_emplace(K &&key, Args &&...args) {
+  return this->EmplaceUnique(std::forward<K>(key),
+                             std::forward<Args>(args)...);
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+template <typename... Args>
+vector<std::pair<typename unordered_map<Key, T, Hash, KeyEqual>::iterator,
+                 bool>>
+unordered_map<Key, T, Hash, KeyEqual>::insert_many(Args &&...args) {
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(std::make_pair(iterator(), insert(args).second)));
+  // Вставка может перестроить таблицу, поэтому итераторы берутся заново
+  // после всех вставок
+  size_type k = 0;
+  (..., (results[k++].first = this->find(args.first)));
+  return results;
+}
+
+template <typename Key, typename T, typename Hash, typename KeyEqual>
+void unordered_map<Key, T, Hash, KeyEqual>::merge(unordered_map &other) {
+  this->Merge(other);
+}
+
+}  // namespace s21
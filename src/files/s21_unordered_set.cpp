@@ -0,0 +1,50 @@
+#include "../include/s21_unordered_set.h"
+
+namespace s21 {
+
+template <typename Key, typename Hash, typename KeyEqual>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(
+    std::initializer_list<value_type> const &items) {
+  this->reserve(items.size());
+  for (const value_type &item : items) insert(item);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename InputIt>
+unordered_set<Key, Hash, KeyEqual>::unordered_set(InputIt first,
+                                                  InputIt last) {
+  for (; first != last; ++first) insert(*first);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::insert(const value_type &value) {
+  return this->EmplaceUnique(value);
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename... Args>
+std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>
+unordered_set<Key, Hash, KeyEqual>::emplace(Args &&...args) {
+  return this->EmplaceUnique(key_type(std::forward<Args>(args)...));
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+template <typename... Args>
+vector<std::pair<typename unordered_set<Key, Hash, KeyEqual>::iterator, bool>>
+unordered_set<Key, Hash, KeyEqual>::insert_many(Args &&...args) {
+  vector<std::pair<iterator, bool>> results;
+  (..., results.push_back(std::make_pair(iterator(), insert(args).second)));
+  // Вставка может перестроить таблицу, поэтому итераторы берутся заново
+  // после всех вставок
+  size_type k = 0;
+  (..., (results[k++].first = this->find(args)));
+  return results;
+}
+
+template <typename Key, typename Hash, typename KeyEqual>
+void unordered_set<Key, Hash, KeyEqual>::merge(unordered_set &other) {
+  this->Merge(other);
+}
+
+}  // namespace s21
@@ -4,81 +4,148 @@ namespace s21 {
 
 /* Конструкторы */
 
-template <typename T>
-vector<T>::vector() : elems(nullptr), a_size(0), c_size(0) {}
-
-template <typename T>
-vector<T>::vector(size_type n)
-    : elems(new value_type[n]), a_size(n), c_size(n) {
-  for (std::size_t i = 0; i < a_size; ++i) {
-    elems[i] = T();
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector() noexcept(noexcept(Allocator()))
+    : alloc(), elems(nullptr), a_size(0), c_size(0) {}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const Allocator &alloc) noexcept
+    : alloc(alloc), elems(nullptr), a_size(0), c_size(0) {}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(size_type n, const Allocator &alloc)
+    : alloc(alloc), elems(Allocate(n)), a_size(0), c_size(n) {
+  try {
+    ConstructDefault(elems, n);
+  } catch (...) {
+    Deallocate(elems, c_size);
+    throw;
   }
+  a_size = n;
 }
 
-template <typename T>
-vector<T>::vector(std::initializer_list<value_type> const &items)
-    : elems(new value_type[items.size()]),
-      a_size(items.size()),
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(std::initializer_list<value_type> const &items,
+                             const Allocator &alloc)
+    : alloc(alloc),
+      elems(Allocate(items.size())),
+      a_size(0),
       c_size(items.size()) {
-  std::copy(items.begin(), items.end(), elems);
+  try {
+    ConstructRange(elems, items.begin(), items.end());
+  } catch (...) {
+    Deallocate(elems, c_size);
+    throw;
+  }
+  a_size = items.size();
 }
 
-template <typename T>
-vector<T>::vector(const vector &val)
-    : elems(new value_type[val.c_size]),
-      a_size(val.a_size),
-      c_size(val.c_size) {
-  std::copy(val.elems, val.elems + val.a_size, elems);
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector &val)
+    : vector(val,
+             AllocTraits::select_on_container_copy_construction(val.alloc)) {}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(const vector &val, const Allocator &alloc)
+    : alloc(alloc), elems(Allocate(val.c_size)), a_size(0), c_size(val.c_size) {
+  try {
+    ConstructRange(elems, val.elems, val.elems + val.a_size);
+  } catch (...) {
+    Deallocate(elems, c_size);
+    throw;
+  }
+  a_size = val.a_size;
 }
 
-template <typename T>
-vector<T>::vector(vector &&val)
-    : elems(val.elems), a_size(val.a_size), c_size(val.c_size) {
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector &&val) noexcept
+    : alloc(std::move(val.alloc)),
+      elems(val.elems),
+      a_size(val.a_size),
+      c_size(val.c_size) {
   val.elems = nullptr;
   val.a_size = 0;
   val.c_size = 0;
 }
 
-template <typename T>
-vector<T>::~vector() {
-  delete[] elems;
-  a_size = 0;
+template <typename T, typename Allocator>
+vector<T, Allocator>::vector(vector &&val, const Allocator &alloc)
+    : alloc(alloc), elems(nullptr), a_size(0), c_size(0) {
+  if (this->alloc == val.alloc) {
+    Steal(val);
+  } else {
+    // Чужой распределитель не освободит буфер val: элементы переносятся
+    // по одному в свой буфер
+    elems = Allocate(val.a_size);
+    c_size = val.a_size;
+    try {
+      ConstructRange(elems, std::make_move_iterator(val.elems),
+                     std::make_move_iterator(val.elems + val.a_size));
+    } catch (...) {
+      Deallocate(elems, c_size);
+      throw;
+    }
+    a_size = val.a_size;
+  }
+}
+
+template <typename T, typename Allocator>
+vector<T, Allocator>::~vector() {
+  clear();
+  Deallocate(elems, c_size);
   c_size = 0;
   elems = nullptr;
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(const vector &val) {
+template <typename T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(const vector &val) {
   if (this != &val) {
-    delete[] elems;
-    a_size = val.a_size;
-    c_size = val.c_size;
-    elems = new value_type[c_size];
-    std::copy(val.elems, val.elems + a_size, elems);
+    if constexpr (AllocTraits::propagate_on_container_copy_assignment::value) {
+      // Копия создается новым распределителем, старый буфер освобождается
+      // старым
+      vector copy(val, val.alloc);
+      Steal(copy);
+      alloc = val.alloc;
+    } else {
+      vector copy(val, alloc);
+      Steal(copy);
+    }
   }
   return *this;
 }
 
-template <typename T>
-vector<T> &vector<T>::operator=(vector &&val) noexcept {
+template <typename T, typename Allocator>
+vector<T, Allocator> &vector<T, Allocator>::operator=(vector &&val) noexcept(
+    kNoexceptMoveAssign) {
   if (this != &val) {
-    delete[] elems;
-    elems = val.elems;
-    a_size = val.a_size;
-    c_size = val.c_size;
-
-    val.elems = nullptr;
-    val.a_size = 0;
-    val.c_size = 0;
+    if constexpr (AllocTraits::propagate_on_container_move_assignment::value) {
+      Steal(val);
+      alloc = std::move(val.alloc);
+    } else if (alloc == val.alloc) {
+      Steal(val);
+    } else {
+      // Буфер val нельзя освободить своим распределителем: элементы
+      // перемещаются по одному
+      vector moved(std::move(val), alloc);
+      Steal(moved);
+    }
   }
   return *this;
 }
 
+// returns the associated allocator
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::allocator_type
+vector<T, Allocator>::get_allocator() const {
+  return alloc;
+}
+
 /* Доступ */
 
 // access specified element with bounds checking
-template <typename T>
-typename vector<T>::reference vector<T>::at(size_type pos) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::at(
+    size_type pos) {
   if (/*pos < 0 ||*/ pos >= a_size) {
     throw std::out_of_range("Index is out of range");
   }
@@ -86,185 +153,351 @@ typename vector<T>::reference vector<T>::at(size_type pos) {
 }
 
 // access specified element
-template <typename T>
-typename vector<T>::reference vector<T>::operator[](size_type pos) {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::reference vector<T, Allocator>::operator[](
+    size_type pos) {
+  return *(elems + pos);
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::operator[](
+    size_type pos) const {
   return *(elems + pos);
 }
 
 // access the first element
-template <typename T>
-typename vector<T>::const_reference vector<T>::front() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::front() {
   return elems[0];
 }
 
 // access the last element
-template <typename T>
-typename vector<T>::const_reference vector<T>::back() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_reference vector<T, Allocator>::back() {
   return elems[a_size - 1];
 }
 
 // direct access to the underlying contiguous storage
-template <typename T>
-typename vector<T>::iterator vector<T>::data() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::data() {
+  return elems;
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator
+vector<T, Allocator>::data() const {
   return elems;
 }
 
 /* Итератор */
 
 // returns an iterator to the beginning
-template <typename T>
-typename vector<T>::iterator vector<T>::begin() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::begin() {
   return elems;
 }
 
 // returns an iterator to the end
-template <typename T>
-typename vector<T>::iterator vector<T>::end() {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::end() {
+  return elems + a_size;
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator
+vector<T, Allocator>::begin() const {
+  return elems;
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::const_iterator
+vector<T, Allocator>::end() const {
   return elems + a_size;
 }
 
 /* Capacity */
 
 // checks whether the container is empty
-template <typename T>
-bool vector<T>::empty() const {
+template <typename T, typename Allocator>
+bool vector<T, Allocator>::empty() const {
   return !a_size;
 }
 
 // returns the number of elements
-template <typename T>
-typename vector<T>::size_type vector<T>::size() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::size() const {
   return a_size;
 }
 
 // returns the maximum possible number of elements
-template <typename T>
-typename vector<T>::size_type vector<T>::max_size() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type
+vector<T, Allocator>::max_size() const {
   return std::numeric_limits<size_type>::max();
 }
 
 // reserves storage
-template <typename T>
-void vector<T>::reserve(size_type size) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::reserve(size_type size) {
   if (size > max_size()) {
     throw std::length_error("Capacity cannot be greater than maximum size");
   }
-  if (size > c_size) {
-    value_type *new_elems = new value_type[size];
-    for (std::size_t i = 0; i < a_size; i++) {
-      new_elems[i] = elems[i];
-    }
-
-    delete[] elems;
-    elems = new_elems;
-    c_size = size;
-  }
+  if (size > c_size) Reallocate(size, a_size, 0, [](value_type *) {});
 }
 
 // returns the number of elements that can be held in currently allocated
 // storage
-template <typename T>
-typename vector<T>::size_type vector<T>::capacity() const {
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type
+vector<T, Allocator>::capacity() const {
   return c_size;
 }
 
 // reduces memory usage by freeing unused memory
-template <typename T>
-void vector<T>::shrink_to_fit() {
-  if (c_size > a_size) {
-    value_type *new_elems = new value_type[a_size];
-    for (std::size_t i = 0; i < a_size; i++) {
-      new_elems[i] = elems[i];
-    }
-    delete[] elems;
-    elems = new_elems;
-    c_size = a_size;
-  }
+template <typename T, typename Allocator>
+void vector<T, Allocator>::shrink_to_fit() {
+  if (c_size > a_size) Reallocate(a_size, a_size, 0, [](value_type *) {});
 }
 
 /* Модификаторы */
 
 // clears the contents
-template <typename T>
-void vector<T>::clear() {
-  delete[] elems;
-  elems = new value_type[c_size];
+template <typename T, typename Allocator>
+void vector<T, Allocator>::clear() {
+  Destroy(elems, elems + a_size);
   a_size = 0;
 }
 
 // inserts elements
-template <typename T>
-typename vector<T>::iterator vector<T>::insert(iterator pos,
-                                               const_reference value) {
-  size_type index = pos - begin();
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    iterator pos, const_reference value) {
+  return emplace(pos, value);
+}
+
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    iterator pos, value_type &&value) {
+  return emplace(pos, std::move(value));
+}
 
-  if (a_size >= c_size) {
-    reserve(c_size == 0 ? 1 : c_size * 2);
+// constructs element in-place
+template <typename T, typename Allocator>
+template <typename... Args>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::emplace(
+    const_iterator pos, Args &&...args) {
+  size_type index = pos - begin();
+  if (a_size == c_size) {
+    Reallocate(GrowCapacity(a_size + 1), index, 1, [&](value_type *data) {
+      Construct(data, std::forward<Args>(args)...);
+    });
+  } else if (index == a_size) {
+    Construct(elems + a_size, std::forward<Args>(args)...);
+    ++a_size;
+  } else if constexpr (kRelocatable) {
+    // Новый элемент создается до сдвига, потому что args могут ссылаться
+    // на сдвигаемый элемент, и затем встает в промежуток после memmove
+    alignas(T) unsigned char slot[sizeof(T)];
+    value_type *value = reinterpret_cast<value_type *>(slot);
+    Construct(value, std::forward<Args>(args)...);
+    MoveBytes(elems + index + 1, elems + index, a_size - index);
+    MoveBytes(elems + index, value, 1);
+    ++a_size;
+  } else {
+    // args могут ссылаться на сдвигаемый элемент, поэтому новый элемент
+    // создается до сдвига
+    value_type value(std::forward<Args>(args)...);
+    Construct(elems + a_size, std::move(elems[a_size - 1]));
+    ++a_size;
+    std::move_backward(elems + index, elems + a_size - 2,
+                       elems + a_size - 1);
+    elems[index] = std::move(value);
   }
+  return begin() + index;
+}
 
-  iterator new_pos = begin() + index;
-  for (iterator it = end(); it != new_pos; --it) {
-    *it = *(it - 1);
+// erases elements
+template <typename T, typename Allocator>
+void vector<T, Allocator>::erase(iterator pos) {
+  if constexpr (kRelocatable) {
+    Destroy(pos, pos + 1);
+    MoveBytes(pos, pos + 1, end() - pos - 1);
+    --a_size;
+  } else {
+    std::move(pos + 1, end(), pos);
+    --a_size;
+    Destroy(elems + a_size, elems + a_size + 1);
   }
+}
 
-  *new_pos = value;
-  ++a_size;
-  return new_pos;
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::erase(
+    iterator first, iterator last) {
+  size_type count = last - first;
+  if (count == 0) return first;
+  if constexpr (kRelocatable) {
+    Destroy(first, last);
+    MoveBytes(first, last, end() - last);
+  } else {
+    iterator new_end = std::move(last, end(), first);
+    Destroy(new_end, end());
+  }
+  a_size -= count;
+  return first;
 }
 
-// erases elements
-template <typename T>
-void vector<T>::erase(iterator pos) {
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert(
+    const_iterator pos, InputIt first, InputIt last) {
   size_type index = pos - begin();
-  iterator new_pos = begin() + index;
-  for (iterator it = new_pos; it != end() - 1; ++it) {
-    *it = *(it + 1);
+  if constexpr (kForward<InputIt>) {
+    size_type count = std::distance(first, last);
+    if (a_size + count > c_size) {
+      if constexpr (kRelocatable) {
+        RelocateRange(GrowCapacity(a_size + count), index, first, last,
+                      count);
+      } else {
+        Reallocate(GrowCapacity(a_size + count), index, count,
+                   [&](value_type *data) {
+                     ConstructRange(data, first, last);
+                   });
+      }
+    } else if constexpr (kRelocatable) {
+      // Хвост сдвигается заранее, и элементы создаются прямо в промежутке
+      MoveBytes(elems + index + count, elems + index, a_size - index);
+      try {
+        ConstructRange(elems + index, first, last);
+      } catch (...) {
+        MoveBytes(elems + index, elems + index + count, a_size - index);
+        throw;
+      }
+      a_size += count;
+    } else {
+      ConstructRange(elems + a_size, first, last);
+      size_type old_size = a_size;
+      a_size += count;
+      std::rotate(elems + index, elems + old_size, elems + a_size);
+    }
+  } else {
+    // Длина неизвестна до конца прохода: элементы дописываются в конец
+    size_type old_size = a_size;
+    try {
+      for (; first != last; ++first) emplace_back(*first);
+    } catch (...) {
+      Destroy(elems + old_size, elems + a_size);
+      a_size = old_size;
+      throw;
+    }
+    std::rotate(elems + index, elems + old_size, elems + a_size);
   }
-  --a_size;
+  return begin() + index;
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt, typename>
+void vector<T, Allocator>::assign(InputIt first, InputIt last) {
+  if constexpr (kForward<InputIt>) {
+    size_type count = std::distance(first, last);
+    if (count > c_size) {
+      vector fresh(alloc);
+      fresh.elems = fresh.Allocate(count);
+      fresh.c_size = count;
+      fresh.ConstructRange(fresh.elems, first, last);
+      fresh.a_size = count;
+      Steal(fresh);
+    } else if (count > a_size) {
+      InputIt middle = std::next(first, a_size);
+      std::copy(first, middle, elems);
+      ConstructRange(elems + a_size, middle, last);
+      a_size = count;
+    } else {
+      iterator new_end = std::copy(first, last, elems);
+      Destroy(new_end, end());
+      a_size = count;
+    }
+  } else {
+    clear();
+    for (; first != last; ++first) emplace_back(*first);
+  }
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::assign(std::initializer_list<value_type> items) {
+  assign(items.begin(), items.end());
+}
+
+template <typename T, typename Allocator>
+template <typename Range>
+void vector<T, Allocator>::append_range(const Range &range) {
+  insert(end(), std::begin(range), std::end(range));
+}
+
+template <typename T, typename Allocator>
+template <typename Pred>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::remove_if(
+    Pred pred) {
+  iterator new_end = std::remove_if(begin(), end(), pred);
+  size_type removed = end() - new_end;
+  erase(new_end, end());
+  return removed;
 }
 
 // adds an element to the end
-template <typename T>
-void vector<T>::push_back(const_reference value) {
-  if (a_size >= c_size) {
-    reserve(c_size == 0 ? 1 : c_size * 2);
+template <typename T, typename Allocator>
+void vector<T, Allocator>::push_back(const_reference value) {
+  emplace_back(value);
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::push_back(value_type &&value) {
+  emplace_back(std::move(value));
+}
+
+// constructs an element in-place at the end
+template <typename T, typename Allocator>
+template <typename... Args>
+typename vector<T, Allocator>::reference vector<T, Allocator>::emplace_back(
+    Args &&...args) {
+  if (a_size == c_size) {
+    Reallocate(GrowCapacity(a_size + 1), a_size, 1, [&](value_type *data) {
+      Construct(data, std::forward<Args>(args)...);
+    });
+  } else {
+    Construct(elems + a_size, std::forward<Args>(args)...);
+    ++a_size;
   }
-  elems[a_size] = value;
-  a_size++;
+  return elems[a_size - 1];
 }
 
 // removes the last element
-template <typename T>
-void vector<T>::pop_back() {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::pop_back() {
   if (a_size > 0) {
     --a_size;
-    elems[a_size]
-        .~T();  // Вызов деструктора для уничтожения последнего элемента
+    Destroy(elems + a_size, elems + a_size + 1);
   }
 }
 
 // changes the number of elements stored
-template <typename T>
-void vector<T>::resize(size_type new_size) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::resize(size_type new_size) {
   if (new_size > c_size) {
     reserve(new_size);
   }
   if (new_size > a_size) {
-    for (size_type i = a_size; i < new_size; ++i) {
-      elems[i] = T();
-    }
+    ConstructDefault(elems + a_size, new_size - a_size);
   } else {
-    // Если новый размер меньше текущего, вызываем деструктор для "удаляемых"
-    // элементов
-    for (size_type i = new_size; i < a_size; ++i) {
-      elems[i].~T();
-    }
+    Destroy(elems + new_size, elems + a_size);
   }
   a_size = new_size;
 }
 
-template <typename T>
-void vector<T>::swap(vector &other) {
+template <typename T, typename Allocator>
+void vector<T, Allocator>::swap(vector &other) noexcept {
+  if constexpr (AllocTraits::propagate_on_container_swap::value) {
+    std::swap(alloc, other.alloc);
+  }
   std::swap(elems, other.elems);
   std::swap(a_size, other.a_size);
   std::swap(c_size, other.c_size);
@@ -273,41 +506,282 @@ void vector<T>::swap(vector &other) {
 /* Бонус */
 
 //вставить ПАК элементов перед индексом
-template <typename T>
+template <typename T, typename Allocator>
 template <typename... Args>
-typename vector<T>::iterator vector<T>::insert_many(const_iterator pos,
-                                                    Args &&...args) {
+typename vector<T, Allocator>::iterator vector<T, Allocator>::insert_many(
+    const_iterator pos, Args &&...args) {
+  constexpr size_type kCount = sizeof...(Args);
   size_type index = pos - begin();
-  size_type num_new_elements = sizeof...(args);
+  if (a_size + kCount > c_size) {
+    Reallocate(GrowCapacity(a_size + kCount), index, kCount,
+               [&](value_type *data) {
+                 ConstructEach(data, std::forward<Args>(args)...);
+               });
+  } else {
+    // Элементы создаются в конце и одним поворотом встают на место
+    ConstructEach(elems + a_size, std::forward<Args>(args)...);
+    if constexpr (kRelocatable) {
+      // Поворот копированием байтов: новые элементы ждут на стеке, пока
+      // хвост сдвигается одним memmove
+      alignas(T) unsigned char scratch[(kCount > 0 ? kCount : 1) * sizeof(T)];
+      value_type *parked = reinterpret_cast<value_type *>(scratch);
+      MoveBytes(parked, elems + a_size, kCount);
+      MoveBytes(elems + index + kCount, elems + index, a_size - index);
+      MoveBytes(elems + index, parked, kCount);
+      a_size += kCount;
+    } else {
+      size_type old_size = a_size;
+      a_size += kCount;
+      std::rotate(elems + index, elems + old_size, elems + a_size);
+    }
+  }
+  return begin() + index + kCount;
+}
+
+// Вставка элементов в конец
+template <typename T, typename Allocator>
+template <typename... Args>
+void vector<T, Allocator>::insert_many_back(Args &&...args) {
+  insert_many(end(), std::forward<Args>(args)...);
+}
+
+/* Память */
+
+template <typename T, typename Allocator>
+template <typename Build>
+void vector<T, Allocator>::Reallocate(size_type capacity, size_type index,
+                                      size_type gap, Build build) {
+  if constexpr (kRelocatable) {
+    Relocate(capacity, index, gap, build);
+    return;
+  }
+  value_type *data = Allocate(capacity);
+  size_type moved = 0;
+  bool built = false;
+  try {
+    build(data + index);
+    built = true;
+    for (; moved < a_size; ++moved) {
+      Construct(data + moved + (moved < index ? 0 : gap),
+                std::move_if_noexcept(elems[moved]));
+    }
+  } catch (...) {
+    for (size_type i = 0; i < moved; ++i) {
+      AllocTraits::destroy(alloc, data + i + (i < index ? 0 : gap));
+    }
+    if (built) Destroy(data + index, data + index + gap);
+    Deallocate(data, capacity);
+    throw;
+  }
+  size_type size = a_size + gap;
+  clear();
+  Deallocate(elems, c_size);
+  elems = data;
+  c_size = capacity;
+  a_size = size;
+}
+
+template <typename T, typename Allocator>
+template <typename Build>
+void vector<T, Allocator>::Relocate(size_type capacity, size_type index,
+                                    size_type gap, Build build) {
+  // Новые элементы создаются до переноса: build может читать элементы,
+  // которые переедут вместе с буфером
+  alignas(T) unsigned char local[kScratchBytes];
+  bool on_stack = gap * sizeof(T) <= kScratchBytes;
+  value_type *scratch = on_stack ? reinterpret_cast<value_type *>(local)
+                                 : AllocTraits::allocate(alloc, gap);
+  value_type *data = nullptr;
+  try {
+    build(scratch);
+    try {
+      if (kRawStorage && elems != nullptr && capacity != 0) {
+        if (capacity > std::numeric_limits<size_type>::max() / sizeof(T)) {
+          throw std::bad_alloc();
+        }
+        // realloc расширяет блок на месте, если за ним свободно, а
+        // mremap переносит страницы большого буфера без копирования
+        data = static_cast<value_type *>(RawReallocate(
+            elems, c_size * sizeof(T), capacity * sizeof(T)));
+        MoveBytes(data + index + gap, data + index, a_size - index);
+      } else {
+        data = Allocate(capacity);
+        MoveBytes(data, elems, index);
+        MoveBytes(data + index + gap, elems + index, a_size - index);
+        Deallocate(elems, c_size);
+      }
+    } catch (...) {
+      Destroy(scratch, scratch + gap);
+      throw;
+    }
+  } catch (...) {
+    if (!on_stack) AllocTraits::deallocate(alloc, scratch, gap);
+    throw;
+  }
+  MoveBytes(data + index, scratch, gap);
+  if (!on_stack) AllocTraits::deallocate(alloc, scratch, gap);
+  elems = data;
+  c_size = capacity;
+  a_size += gap;
+}
 
-  if (a_size + num_new_elements > c_size) {
-    reserve(a_size + num_new_elements);
+template <typename T, typename Allocator>
+template <typename ForwardIt>
+void vector<T, Allocator>::RelocateRange(size_type capacity, size_type index,
+                                         ForwardIt first, ForwardIt last,
+                                         size_type count) {
+  if (kRawStorage && elems != nullptr && !Aliases(first)) {
+    if (capacity > std::numeric_limits<size_type>::max() / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    elems = static_cast<value_type *>(
+        RawReallocate(elems, c_size * sizeof(T), capacity * sizeof(T)));
+    c_size = capacity;
+    MoveBytes(elems + index + count, elems + index, a_size - index);
+    try {
+      ConstructRange(elems + index, first, last);
+    } catch (...) {
+      MoveBytes(elems + index, elems + index + count, a_size - index);
+      throw;
+    }
+  } else {
+    // Старый буфер жив, пока создаются новые элементы: диапазон может
+    // читать из него
+    value_type *data = Allocate(capacity);
+    try {
+      ConstructRange(data + index, first, last);
+    } catch (...) {
+      Deallocate(data, capacity);
+      throw;
+    }
+    MoveBytes(data, elems, index);
+    MoveBytes(data + index + count, elems + index, a_size - index);
+    Deallocate(elems, c_size);
+    elems = data;
+    c_size = capacity;
   }
+  a_size += count;
+}
 
-  iterator new_pos = begin() + index;
-  vector<value_type> temp = {args...};
+template <typename T, typename Allocator>
+template <typename ForwardIt>
+bool vector<T, Allocator>::Aliases(ForwardIt first) const {
+  using Reference = typename std::iterator_traits<ForwardIt>::reference;
+  if constexpr (std::is_reference_v<Reference> &&
+                std::is_same_v<std::remove_cv_t<std::remove_reference_t<
+                                   Reference>>,
+                               value_type>) {
+    const value_type *item =
+        std::addressof(static_cast<const value_type &>(*first));
+    std::less<const value_type *> less;
+    return !less(item, elems) && less(item, elems + a_size);
+  } else {
+    return false;
+  }
+}
 
-  for (size_type i = 0; i < temp.size(); ++i) {
-    new_pos = insert(new_pos, temp[i]);
-    ++new_pos;
+template <typename T, typename Allocator>
+void vector<T, Allocator>::MoveBytes(value_type *to, const value_type *from,
+                                     size_type n) {
+  if (n != 0) {
+    std::memmove(static_cast<void *>(to), static_cast<const void *>(from),
+                 n * sizeof(T));
   }
+}
 
-  return new_pos;
+template <typename T, typename Allocator>
+typename vector<T, Allocator>::size_type vector<T, Allocator>::GrowCapacity(
+    size_type size) const {
+  size_type grown = c_size == 0 ? 1 : c_size * 2;
+  return grown < size ? size : grown;
 }
 
-// Вставка элементов в конец
-template <typename T>
+template <typename T, typename Allocator>
+template <typename... Args>
+void vector<T, Allocator>::ConstructEach(value_type *data, Args &&...args) {
+  size_type built = 0;
+  try {
+    ((Construct(data + built, std::forward<Args>(args)), ++built), ...);
+  } catch (...) {
+    Destroy(data, data + built);
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+template <typename InputIt>
+void vector<T, Allocator>::ConstructRange(value_type *data, InputIt first,
+                                          InputIt last) {
+  size_type built = 0;
+  try {
+    for (; first != last; ++first, ++built) Construct(data + built, *first);
+  } catch (...) {
+    Destroy(data, data + built);
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::ConstructDefault(value_type *data, size_type n) {
+  size_type built = 0;
+  try {
+    for (; built < n; ++built) Construct(data + built);
+  } catch (...) {
+    Destroy(data, data + built);
+    throw;
+  }
+}
+
+template <typename T, typename Allocator>
 template <typename... Args>
-void vector<T>::insert_many_back(Args &&...args) {
-  size_type num_new_elements = sizeof...(args);
+void vector<T, Allocator>::Construct(value_type *data, Args &&...args) {
+  AllocTraits::construct(alloc, data, std::forward<Args>(args)...);
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::Destroy(value_type *first, value_type *last) {
+  for (; first != last; ++first) AllocTraits::destroy(alloc, first);
+}
+
+template <typename T, typename Allocator>
+T *vector<T, Allocator>::Allocate(size_type capacity) {
+  if (capacity == 0) return nullptr;
+  if constexpr (kRawStorage) {
+    if (capacity > std::numeric_limits<size_type>::max() / sizeof(T)) {
+      throw std::bad_alloc();
+    }
+    return static_cast<value_type *>(RawAllocate(capacity * sizeof(T)));
+  } else {
+    return AllocTraits::allocate(alloc, capacity);
+  }
+}
 
-  // Проверка и резервирование емкости
-  if (a_size + num_new_elements > c_size) {
-    reserve(a_size + num_new_elements);
+template <typename T, typename Allocator>
+void vector<T, Allocator>::Deallocate(value_type *data, size_type capacity) {
+  if (data == nullptr) return;
+  if constexpr (kRawStorage) {
+    RawDeallocate(data, capacity * sizeof(T));
+  } else {
+    AllocTraits::deallocate(alloc, data, capacity);
   }
+}
+
+template <typename T, typename Allocator>
+void vector<T, Allocator>::Steal(vector &other) noexcept {
+  clear();
+  Deallocate(elems, c_size);
+  elems = other.elems;
+  a_size = other.a_size;
+  c_size = other.c_size;
+  other.elems = nullptr;
+  other.a_size = 0;
+  other.c_size = 0;
+}
 
-  // Вставка элементов в конец
-  (insert(end(), std::forward<Args>(args)), ...);
+template <typename T, typename Allocator, typename Pred>
+typename vector<T, Allocator>::size_type erase_if(vector<T, Allocator> &vec,
+                                                  Pred pred) {
+  return vec.remove_if(pred);
 }
 
-}  // namespace s21
\ No newline at end of file
+}  // namespace s21
@@ -1,9 +1,16 @@
 #ifndef CPP2_S21_CONTAINERS_1_AVL_TREE_H
 #define CPP2_S21_CONTAINERS_1_AVL_TREE_H
 
+#include <algorithm>
+#include <functional>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <type_traits>
+#include <utility>
 
+#include "s21_frozen_tree.h"
+#include "s21_node_pool.h"
 #include "s21_vector.h"
 
 namespace s21 {
@@ -15,20 +22,58 @@ struct Node {
   Node *right;
   Node *parent;
   int height;
-  Node(Key key, T value)
-      : key(key),
-        value(value),
+  // Количество узлов в поддереве, включая сам узел
+  size_t size;
+  template <typename K, typename... Args>
+  explicit Node(K &&key, Args &&...args)
+      : key(std::forward<K>(key)),
+        value(std::forward<Args>(args)...),
         left(nullptr),
         right(nullptr),
         parent(nullptr),
-        height(1) {}
+        height(1),
+        size(1) {}
 };
 
+// Узел множества: элемент хранится один раз, в key. Ключ идет последним,
+// чтобы небольшой ключ занимал место выравнивания после height
+template <typename Key>
+struct Node<Key, void> {
+  Node *left;
+  Node *right;
+  Node *parent;
+  // Количество узлов в поддереве, включая сам узел
+  size_t size;
+  int height;
+  Key key;
+  template <typename... Args>
+  explicit Node(Args &&...args)
+      : left(nullptr),
+        right(nullptr),
+        parent(nullptr),
+        size(1),
+        height(1),
+        key(std::forward<Args>(args)...) {}
+};
+
+// Возвращает значение узла; у узла множества значением служит ключ
 template <typename Key, typename T>
+T &NodeValue(Node<Key, T> &node) {
+  return node.value;
+}
+
+template <typename Key>
+Key &NodeValue(Node<Key, void> &node) {
+  return node.key;
+}
+
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename NodeAllocator = NodePool<Node<Key, T>>>
 class BinaryTree {
  public:
   class Iterator;
   class ConstIterator;
+  class ReverseIterator;
 
   using key_type = Key;
   using value_type = T;
@@ -37,36 +82,151 @@ class BinaryTree {
   using size_type = size_t;
   using iterator = Iterator;
   using const_iterator = ConstIterator;
+  using reverse_iterator = ReverseIterator;
+  using key_compare = Compare;
+  using node_allocator_type = NodeAllocator;
+  // Тип узла задает распределитель: Node<Key, T> или Node<Key, void>
+  using node_type = typename NodeAllocator::node_type;
 
  protected:
-  Node<key_type, value_type> *root_;
-
-  // Балансирует дерево
-  Node<key_type, value_type> *Balance(Node<key_type, value_type> *node);
+  node_type *root_;
+
+  // Выделяет и освобождает узлы дерева
+  NodeAllocator alloc_;
+
+  // Задает порядок ключей
+  Compare comp_;
+
+  // Узел множества хранит только ключ
+  static constexpr bool kKeyOnly =
+      std::is_same<node_type, Node<key_type, void>>::value;
+
+  // Создает узел из ключа и значения; узлу множества передается только ключ
+  template <typename K, typename... Args>
+  node_type *CreateNode(K &&key, Args &&...args);
+
+  // Восстанавливает высоту и AVL-баланс узла за O(1), опираясь на
+  // закешированные высоты потомков. Вызывается на пути вставки/удаления
+  node_type *Balance(node_type *node);
+
+  // Ищет key за один спуск и, если его нет, создает узел на месте из args.
+  // В result возвращает найденный или созданный узел
+  template <typename K, typename... Args>
+  node_type *Emplace(node_type *node, K &&key, node_type *&result,
+                     bool &inserted, Args &&...args);
+
+  // Вставляет уже созданный узел, если его ключа еще нет, за один спуск;
+  // иначе разрушает узел. Возвращает узел с этим ключом и признак вставки
+  std::pair<node_type *, bool> EmplaceNode(node_type *new_node);
+
+  // То же с подсказкой: hint - узел, перед которым должен встать новый
+  // (nullptr - конец). Если ключ лежит строго между соседями hint, узел
+  // подвешивается к одному из них без спуска от корня, и балансируется
+  // путь вверх по родителям. Иначе выполняется EmplaceNode
+  std::pair<node_type *, bool> EmplaceNodeHint(node_type *hint,
+                                               node_type *new_node);
+
+  // Возвращает первый узел с ключом не меньше key или nullptr. На каждом
+  // уровне выполняется одно сравнение
+  template <typename K>
+  node_type *LowerBound(const K &key) const;
+
+  // Возвращает первый узел с ключом больше key или nullptr
+  template <typename K>
+  node_type *UpperBound(const K &key) const;
+
+  // Возвращает узел с ключом, эквивалентным key, или nullptr: спуск как
+  // в LowerBound и одно сравнение для проверки равенства в конце
+  template <typename K>
+  node_type *FindNode(const K &key) const;
+
+  // Возвращает количество элементов с ключом меньше key
+  template <typename K>
+  size_type LowerRank(const K &key) const;
+
+  // Возвращает количество элементов с ключом не больше key
+  template <typename K>
+  size_type UpperRank(const K &key) const;
+
+  // Удаляет узел, перевешивая соседей по ссылкам на родителей, и
+  // балансирует путь до корня. Другие узлы не перемещаются
+  void EraseNode(node_type *node);
+
+  // Возвращает узел, на который указывает итератор
+  static node_type *GetNode(const iterator &pos) {
+    return pos.iter_node;
+  }
+
+  // Заменяет содержимое идеально сбалансированным деревом из items за
+  // O(n). Элементы - пары (ключ, значение) или, для множеств, одни ключи.
+  // Неотсортированные items сначала сортируются по ключу. Если unique, из
+  // равных ключей остается первый, как при поочередной вставке
+  template <typename Item>
+  void AssignSorted(vector<Item> &items, bool unique);
+
+  // Ключ элемента AssignSorted
+  static const key_type &ItemKey(
+      const std::pair<key_type, value_type> &item) {
+    return item.first;
+  }
+  static const key_type &ItemKey(const key_type &key) { return key; }
+
+  // Переносит в дерево все узлы other, в том числе с уже имеющимися
+  // ключами; равные элементы other встают после своих. Узлы
+  // перевешиваются без выделения памяти и копирования ключей: немного
+  // узлов вставляется по одному, иначе узлы обоих деревьев сливаются
+  // в массиве указателей и дерево собирается заново за O(n + m)
+  void MergeEquivalent(BinaryTree &other);
+
+  // Заменяет содержимое копией other. Узлы копии выделяет свой
+  // распределитель, как при копирующем присваивании без propagate
+  void CopyFrom(const BinaryTree &other);
 
  public:
   BinaryTree();
+  explicit BinaryTree(const Compare &comp);
+
+  // Узлы выделяет копия alloc; копия дерева получает распределитель от
+  // alloc.select_on_copy()
+  explicit BinaryTree(const NodeAllocator &alloc);
   BinaryTree(
       std::initializer_list<std::pair<key_type, value_type>> const &items);
   BinaryTree(const key_type &key, const value_type &value);
   BinaryTree(const BinaryTree &other);
   BinaryTree(BinaryTree &&other) noexcept;
   ~BinaryTree();
-  BinaryTree &operator=(BinaryTree &&other);
+
+  // Забирает узлы other, если распределитель может их освобождать (см.
+  // NodeAllocator::move_assign); иначе элементы other перемещаются по
+  // одному в узлы своего распределителя
+  BinaryTree &operator=(BinaryTree &&other) noexcept(
+      NodeAllocator::kMoveAssignNodes);
 
   std::pair<iterator, bool> insert(const value_type &value);
   std::pair<iterator, bool> insert(
       const std::pair<key_type, value_type> &value);
   iterator find(const key_type &key);
-  iterator find(Node<key_type, value_type> *node, const key_type &key);
+  iterator find(node_type *node, const key_type &key);
+
+  // Ищет ключ, сравнимый с key_type, без создания временного ключа.
+  // Доступно только для прозрачного компаратора (Compare::is_transparent)
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
 
   // Проверяет, содержится ли элемент с заданным ключом в бинарном дереве
   bool contains(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key);
+
+  // Возвращает объект сравнения ключей
+  key_compare key_comp() const;
 
   // Проверяет контейнер на пустоту
   bool empty() const;
 
-  // Возвращает кол-во узлов в дереве
+  // Возвращает кол-во узлов в дереве за O(1)
   size_type size() const;
 
   // Возвращает максимально возможное количество элементов
@@ -81,18 +241,38 @@ class BinaryTree {
   // Меняет местами содержимое
   void swap(BinaryTree &other);
 
-  // Объединяет два дерева
+  // Переносит в дерево узлы other с ключами, которых еще нет; остальные
+  // остаются в other. Узлы перевешиваются, а не копируются
   void merge(BinaryTree &other);
 
-  // Очищает содержимое
+  // Объединяет с other за O(m log(n/m + 1)), перевешивая его узлы. При
+  // совпадении ключей остается значение из текущего дерева; other
+  // становится пустым
+  void set_union(BinaryTree &other);
+
+  // Оставляет только ключи, которые есть в other, за O(m log(n/m + 1))
+  void set_intersection(const BinaryTree &other);
+
+  // Удаляет ключи, которые есть в other, за O(m log(n/m + 1))
+  void set_difference(const BinaryTree &other);
+
+  // Очищает содержимое. Если узлы тривиально разрушаемы, а распределитель
+  // умеет освобождать память целиком, дерево не обходится
   void clear();
 
   // Возвращает итератор к началу
   iterator begin();
 
-  // Возвращает итератор к концу
+  // Возвращает итератор к концу. Он помнит дерево, поэтому --end()
+  // указывает на последний элемент
   iterator end();
 
+  // Возвращает обратный итератор на последний элемент
+  reverse_iterator rbegin();
+
+  // Возвращает обратный итератор, следующий за первым элементом
+  reverse_iterator rend();
+
   // Вычисление max высоты бинарного дерева
   int Height();
 
@@ -100,13 +280,13 @@ class BinaryTree {
   int BalanceFactor();
 
   // Реализует правое вращение узлов в дереве
-  Node<key_type, value_type> *RightRotate();
+  node_type *RightRotate();
 
   // Реализует левое вращение узлов в дереве
-  Node<key_type, value_type> *LeftRotate();
+  node_type *LeftRotate();
 
   // // Балансирует дерево
-  Node<key_type, value_type> *Balance();
+  node_type *Balance();
 
   // Проверяет, является ли дерево сбалансированным
   bool IsBalanced();
@@ -115,36 +295,86 @@ class BinaryTree {
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
+  // Возвращает итератор на k-й по порядку элемент (с нуля) или end()
+  iterator nth(size_type k);
+
+  // Возвращает количество элементов с ключом строго меньше key
+  size_type rank(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type rank(const K &key) const;
+
+  // Возвращает количество элементов с ключом из полуинтервала [lo, hi)
+  size_type count_range(const key_type &lo, const key_type &hi) const;
+
+  // Снимок дерева: frozen_map для map, frozen_set для set и multiset
+  using frozen_type =
+      FrozenTree<Key, std::conditional_t<kKeyOnly, void, T>, Compare>;
+
+  // Строит неизменяемый снимок за O(n) обходом по возрастанию ключей.
+  // Поиск в снимке идет по массиву без ветвлений и заметно быстрее, чем
+  // в дереве; изменения дерева в снимок не попадают
+  frozen_type freeze() const;
+
   class Iterator {
    private:
-    Node<key_type, value_type> *iter_node;
-    Node<key_type, value_type> *iter_past_node;
+    node_type *iter_node;
+    const BinaryTree *iter_tree;
 
    public:
     friend class BinaryTree;
 
-    Iterator() {}
-    Iterator(Node<key_type, value_type> *node,
-             Node<key_type, value_type> *past_node = nullptr)
-        : iter_node(node), iter_past_node(past_node) {}
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+
+    Iterator() : iter_node(nullptr), iter_tree(nullptr) {}
+    Iterator(node_type *node, const BinaryTree *tree = nullptr)
+        : iter_node(node), iter_tree(tree) {}
 
     iterator operator++(int);
     iterator &operator++();
+    iterator operator--(int);
+    iterator &operator--();
     bool operator==(const iterator &other) const;
     bool operator!=(const iterator &other) const;
     const_reference operator*();
+    const key_type &first();
     reference second();
   };
 
+  class ReverseIterator {
+   private:
+    iterator iter_;
+
+   public:
+    friend class BinaryTree;
+
+    ReverseIterator() = default;
+    explicit ReverseIterator(const iterator &it) : iter_(it) {}
+
+    reverse_iterator operator++(int);
+    reverse_iterator &operator++();
+    reverse_iterator operator--(int);
+    reverse_iterator &operator--();
+    bool operator==(const reverse_iterator &other) const;
+    bool operator!=(const reverse_iterator &other) const;
+    const_reference operator*() { return *iter_; }
+    const key_type &first() { return iter_.first(); }
+    reference second() { return iter_.second(); }
+
+    // Возвращает прямой итератор на тот же элемент
+    iterator base() const { return iter_; }
+  };
+
   class ConstIterator {
    private:
-    const Node<key_type, value_type> *iter_node;
-    const Node<key_type, value_type> *iter_past_node;
+    const node_type *iter_node;
+    const node_type *iter_past_node;
 
    public:
     friend class BinaryTree;
-    ConstIterator(const Node<key_type, value_type> *node,
-                  const Node<key_type, value_type> *past_node = nullptr)
+    ConstIterator(const node_type *node, const node_type *past_node = nullptr)
         : iter_node(node), iter_past_node(past_node) {}
 
     const_iterator operator++(int) const;
@@ -155,48 +385,95 @@ class BinaryTree {
   };
 
  private:
-  // Вставляет новый узел в дерево
-  Node<key_type, value_type> *insert(Node<key_type, value_type> *node,
-                                     const key_type &key,
-                                     const value_type &value, bool &inserted);
+  // Продолжает Emplace ниже node; candidate - последний узел на пути с
+  // ключом не больше key, равенство с ним проверяется в самом низу
+  template <typename K, typename... Args>
+  node_type *EmplaceBelow(node_type *node, node_type *candidate, K &&key,
+                          node_type *&result, bool &inserted,
+                          Args &&...args);
+
+  // Продолжает EmplaceNode ниже node, как EmplaceBelow
+  node_type *InsertUniqueBelow(node_type *node, node_type *candidate,
+                               node_type *new_node, node_type *&result,
+                               bool &inserted);
 
-  // Удаляет узел из дерева
-  Node<key_type, value_type> *remove(Node<key_type, value_type> *node,
-                                     const key_type &key);
+  // Ставит replacement на место node в parent или в корне
+  void Replace(node_type *parent, node_type *node, node_type *replacement);
 
   // Удаляет дерево
-  void clear(Node<key_type, value_type> *node);
+  void clear(node_type *node);
 
-  // Объединяет два дерева
-  void merge(Node<key_type, value_type> *&into,
-             Node<key_type, value_type> *&from, BinaryTree &other);
+  // Соединяет left < middle < right в AVL-дерево за O(|h(left) - h(right)|)
+  node_type *Join(node_type *left, node_type *middle, node_type *right);
 
-  // Возвращает кол-во узлов в дереве
-  size_type size(Node<key_type, value_type> *node) const;
+  // Соединяет left < right, вынимая максимум left в качестве середины
+  node_type *Join2(node_type *left, node_type *right);
 
-  // Вычисление высоту бинарного дерева
-  int Height(Node<key_type, value_type> *node);
+  // Вынимает узел с максимальным ключом и возвращает остаток поддерева
+  node_type *SplitLast(node_type *node, node_type *&last);
+
+  // Разрезает поддерево по key на ключи меньше и больше key; узел с
+  // равным ключом возвращается в found
+  void Split(node_type *node, const key_type &key, node_type *&left,
+             node_type *&found, node_type *&right);
+
+  // Объединяет поддеревья; узлы second с уже имеющимися ключами
+  // собираются в отдельное дерево duplicates
+  node_type *Union(node_type *first, node_type *second, node_type *&duplicates);
+
+  // Оставляет в node ключи, которые есть в other, остальные удаляет
+  node_type *Intersection(node_type *node, const node_type *other);
+
+  // Удаляет из node ключи, которые есть в other
+  node_type *Difference(node_type *node, const node_type *other);
+
+  // Возвращает кол-во узлов в поддереве
+  size_type size(node_type *node) const;
+
+  // Возвращает закешированную высоту поддерева
+  int Height(node_type *node);
 
   // Вычисляет разницу высот левого и правого поддерева
-  int BalanceFactor(Node<key_type, value_type> *node);
+  int BalanceFactor(node_type *node);
 
   // Реализует правое вращение узлов в дереве
-  Node<key_type, value_type> *RightRotate(Node<key_type, value_type> *node);
+  node_type *RightRotate(node_type *node);
 
   // Реализует левое вращение узлов в дереве
-  Node<key_type, value_type> *LeftRotate(Node<key_type, value_type> *node);
+  node_type *LeftRotate(node_type *node);
 
-  // Обновляет значение высоты в узлах
-  int UpdateHeight(Node<key_type, value_type> *node);
+  // Пересчитывает высоту узла по высотам потомков
+  int UpdateNode(node_type *node);
 
-  // Проверяет, сбалансировано ли поддерево
-  bool IsBalanced(Node<key_type, value_type> *node);
+  // Проверяет, сбалансировано ли поддерево и корректны ли высоты, размеры
+  // и ссылки на родителей в узлах
+  bool IsBalanced(node_type *node);
 
   // Возвращает узел с минимальным ключом
-  Node<key_type, value_type> *GetMin(Node<key_type, value_type> *node);
+  static node_type *GetMin(node_type *node);
+
+  // Возвращает узел с максимальным ключом
+  static node_type *GetMax(node_type *node);
+
+  // Строит сбалансированное поддерево из items[lo, hi), забирая элементы
+  template <typename Item>
+  node_type *BuildBalanced(vector<Item> &items, size_type lo, size_type hi);
+
+  // Записывает узлы поддерева в out по возрастанию ключей
+  static void Flatten(node_type *node, node_type **&out);
+
+  // Собирает из nodes[lo, hi) идеально сбалансированное поддерево
+  node_type *FromArray(node_type **nodes, size_type lo, size_type hi);
+
+  // Вставляет готовый узел после равных ему и балансирует путь
+  node_type *InsertNode(node_type *node, node_type *new_node);
 
   // Копирует дерево в текущее
-  Node<key_type, value_type> *copy(Node<key_type, value_type> *other_node);
+  node_type *copy(node_type *other_node);
+
+  // Строит в своих узлах дерево той же формы, перемещая ключи и значения
+  // из узлов other_node
+  node_type *MoveElements(node_type *other_node);
 
   // Возвращает ключ корневого узла
   key_type GetRootKey();
@@ -0,0 +1,285 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_H
+
+#include <cstddef>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Желаемый размер листа B-дерева: четыре строки кеша по 64 байта
+constexpr std::size_t kBTreeNodeBytes = 256;
+
+template <typename T>
+struct BTreeValueSize : std::integral_constant<std::size_t, sizeof(T)> {};
+
+template <>
+struct BTreeValueSize<void> : std::integral_constant<std::size_t, 0> {};
+
+// Возвращает число элементов в узле: столько, сколько помещается в
+// kBTreeNodeBytes вместе с заголовком, но не меньше трех
+template <typename Key, typename T>
+constexpr std::size_t BTreeSlots() {
+  std::size_t slot = sizeof(Key) + BTreeValueSize<T>::value;
+  std::size_t slots = (kBTreeNodeBytes - 2 * sizeof(void *)) / slot;
+  return slots < 3 ? 3 : slots;
+}
+
+// Значения узла хранятся отдельно от ключей, чтобы поиск внутри узла
+// читал подряд только ключи. У множества значений нет
+template <typename T, std::size_t kSlots>
+struct BTreeValues {
+  BTreeValues() {}
+  ~BTreeValues() {}
+  union {
+    T values[kSlots];
+  };
+};
+
+template <std::size_t kSlots>
+struct BTreeValues<void, kSlots> {};
+
+// Лист B-дерева. Элементы [0, count) сконструированы, остальные ячейки
+// массивов - сырая память
+template <typename Key, typename T>
+struct BTreeNode : BTreeValues<T, BTreeSlots<Key, T>()> {
+  static constexpr std::size_t kSlots = BTreeSlots<Key, T>();
+
+  BTreeNode *parent;
+  // Номер узла среди детей родителя
+  unsigned short position;
+  unsigned short count;
+  bool leaf;
+  union {
+    Key keys[kSlots];
+  };
+
+  explicit BTreeNode(bool is_leaf = true)
+      : parent(nullptr), position(0), count(0), leaf(is_leaf) {}
+  ~BTreeNode() {}
+};
+
+// Внутренний узел: ключ i лежит между детьми i и i + 1
+template <typename Key, typename T>
+struct BTreeInternalNode : BTreeNode<Key, T> {
+  BTreeNode<Key, T> *children[BTreeNode<Key, T>::kSlots + 1];
+
+  BTreeInternalNode() : BTreeNode<Key, T>(false) {}
+};
+
+// B-дерево поиска: элементы лежат в широких узлах по несколько строк
+// кеша, поэтому спуск делает в несколько раз меньше переходов по
+// указателям, чем AVL-дерево. T = void задает дерево одних ключей
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class BTree {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using iterator = Iterator;
+  using key_compare = Compare;
+  using node_type = BTreeNode<Key, T>;
+  using internal_node_type = BTreeInternalNode<Key, T>;
+
+  // Максимальное и минимальное (кроме корня) число элементов в узле
+  static constexpr size_type kNodeSlots = node_type::kSlots;
+  static constexpr size_type kMinSlots = (kNodeSlots - 1) / 2;
+
+  BTree();
+  explicit BTree(const Compare &comp);
+  BTree(const BTree &other);
+  BTree(BTree &&other) noexcept;
+  ~BTree();
+  BTree &operator=(const BTree &other);
+  BTree &operator=(BTree &&other) noexcept;
+
+  // Ищет элемент с ключом key; в дереве с повторами - первый из них
+  iterator find(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
+
+  // Проверяет, содержится ли элемент с заданным ключом
+  bool contains(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key);
+
+  // Возвращает итератор на первый элемент с ключом не меньше key
+  iterator lower_bound(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+
+  // Возвращает итератор на первый элемент с ключом больше key
+  iterator upper_bound(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key);
+
+  // Возвращает объект сравнения ключей
+  key_compare key_comp() const;
+
+  // Проверяет контейнер на пустоту
+  bool empty() const;
+
+  // Возвращает кол-во элементов за O(1)
+  size_type size() const;
+
+  // Возвращает максимально возможное количество элементов
+  size_type max_size() const;
+
+  // Стирает элемент в позиции. Элементы в узлах сдвигаются, поэтому
+  // все итераторы становятся недействительными
+  void erase(iterator pos);
+
+  // Стирает элемент с ключом key, если он есть
+  bool erase(const key_type &key);
+
+  // Меняет местами содержимое
+  void swap(BTree &other);
+
+  // Очищает содержимое
+  void clear();
+
+  // Возвращает итератор к началу
+  iterator begin();
+
+  // Возвращает итератор к концу; --end() указывает на последний элемент
+  iterator end();
+
+  // Проверяет инварианты: порядок ключей, заполненность узлов, одинаковую
+  // глубину листьев и ссылки на родителей
+  bool IsValid() const;
+
+  class Iterator {
+   private:
+    node_type *iter_node;
+    size_type iter_position;
+    const BTree *iter_tree;
+
+   public:
+    friend class BTree;
+
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() : iter_node(nullptr), iter_position(0), iter_tree(nullptr) {}
+    Iterator(node_type *node, size_type position, const BTree *tree)
+        : iter_node(node), iter_position(position), iter_tree(tree) {}
+
+    iterator operator++(int);
+    iterator &operator++();
+    iterator operator--(int);
+    iterator &operator--();
+    bool operator==(const iterator &other) const;
+    bool operator!=(const iterator &other) const;
+    const_reference operator*() const;
+    const key_type &first() const;
+    reference second() const;
+  };
+
+ protected:
+  node_type *root_;
+  size_type size_;
+
+  // Задает порядок ключей
+  Compare comp_;
+
+  static constexpr bool kKeyOnly = std::is_void<T>::value;
+
+  // Ищет key и, если его нет, создает элемент на месте из args
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> EmplaceUnique(K &&key, Args &&...args);
+
+  // Создает элемент из args после всех элементов с равным ключом
+  template <typename K, typename... Args>
+  iterator EmplaceMulti(K &&key, Args &&...args);
+
+  // Переносит элементы other. Если не kMulti, элементы с уже имеющимися
+  // ключами остаются в other
+  template <bool kMulti>
+  void Merge(BTree &other);
+
+  // Возвращает значение элемента; у множества значением служит ключ
+  static reference Value(node_type *node, size_type i);
+
+  template <typename K>
+  iterator LowerBound(const K &key);
+
+  template <typename K>
+  iterator UpperBound(const K &key);
+
+ private:
+  // Индекс первого ключа узла, не меньше key (двоичный поиск)
+  template <typename K>
+  size_type LowerIndex(const node_type *node, const K &key) const;
+
+  // Индекс первого ключа узла, больше key
+  template <typename K>
+  size_type UpperIndex(const node_type *node, const K &key) const;
+
+  static node_type *Child(const node_type *node, size_type i);
+
+  // Ставит child на место i среди детей node
+  static void SetChild(node_type *node, size_type i, node_type *child);
+
+  template <typename K, typename... Args>
+  static void ConstructSlot(node_type *node, size_type i, K &&key,
+                            Args &&...args);
+
+  static void DestroySlot(node_type *node, size_type i);
+
+  // Переносит элемент из ячейки (src, i) в сырую ячейку (dst, j);
+  // ячейка-источник становится сырой
+  static void MoveSlot(node_type *dst, size_type j, node_type *src,
+                       size_type i);
+
+  // Вставляет элемент в ячейку i листа, при необходимости разделяя его
+  template <typename K, typename... Args>
+  iterator InsertAt(node_type *node, size_type i, K &&key, Args &&...args);
+
+  // Делит полный узел пополам, поднимая средний элемент в родителя
+  void Split(node_type *node);
+
+  // Восполняет узел, в котором осталось меньше kMinSlots элементов,
+  // за счет соседа или сливает его с соседом
+  void Rebalance(node_type *node);
+
+  // Переносит элемент из левого ребенка через разделитель s в правого
+  static void RotateRight(node_type *parent, size_type s);
+
+  // Переносит элемент из правого ребенка через разделитель s в левого
+  static void RotateLeft(node_type *parent, size_type s);
+
+  // Сливает детей s и s + 1 вместе с разделителем s
+  static void MergeChildren(node_type *parent, size_type s);
+
+  static void DeleteNode(node_type *node);
+
+  // Копирует поддерево
+  static node_type *CopyTree(const node_type *node);
+
+  // Удаляет поддерево
+  static void DestroyTree(node_type *node);
+
+  bool IsValid(const node_type *node, const key_type *lo, const key_type *hi,
+               size_type depth, size_type &leaf_depth,
+               size_type &count) const;
+};
+}  // namespace s21
+
+#include "../files/s21_btree.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_H
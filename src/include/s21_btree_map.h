@@ -0,0 +1,68 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
+
+#include "s21_btree.h"
+
+namespace s21 {
+// Ассоциативный массив на B-дереве с интерфейсом s21::map. В отличие от
+// map, вставка и удаление делают недействительными все итераторы
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class btree_map : public BTree<Key, T, Compare> {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename BTree<Key, T, Compare>::Iterator;
+  using size_type = size_t;
+
+  btree_map() : BTree<Key, T, Compare>(){};
+  btree_map(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  btree_map(InputIt first, InputIt last);
+  btree_map(const btree_map &other) : BTree<Key, T, Compare>(other){};
+  btree_map(btree_map &&other) noexcept
+      : BTree<Key, T, Compare>(std::move(other)){};
+  btree_map &operator=(const btree_map &other) = default;
+  btree_map &operator=(btree_map &&other) noexcept = default;
+  ~btree_map() = default;
+
+  // Дает доступ к указанному элементу с проверкой границ
+  mapped_type &at(const key_type &key);
+
+  // Дает доступ или вставляет указанный элемент
+  mapped_type &operator[](const key_type &key);
+
+  // Вставляет элемент, если ключа еще нет
+  std::pair<iterator, bool> insert(const value_type &value);
+
+  // Вставляет элемент или присваивает текущему элементу, если ключ уже
+  // существует
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+
+  // Создает элемент на месте из args, если ключа еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // Если ключа нет, создает значение на месте из args за один спуск;
+  // иначе ничего не делает и не трогает args
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args);
+
+  // Вставляет новые элементы в контейнер. Возвращаемые итераторы
+  // действительны после всех вставок
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Переносит элементы other с ключами, которых еще нет; остальные
+  // остаются в other
+  void merge(btree_map &other);
+};
+
+}  // namespace s21
+
+#include "../files/s21_btree_map.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_MAP_H
@@ -0,0 +1,56 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_MULTISET_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_MULTISET_H
+
+#include "s21_btree.h"
+
+namespace s21 {
+// Мультимножество на B-дереве с интерфейсом s21::multiset. Равные
+// элементы хранятся в порядке вставки
+template <typename Key, typename Compare = std::less<Key>>
+class btree_multiset : public BTree<Key, void, Compare> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const Key &;
+  using iterator = typename BTree<Key, void, Compare>::Iterator;
+  using size_type = size_t;
+
+  btree_multiset() : BTree<Key, void, Compare>(){};
+  btree_multiset(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  btree_multiset(InputIt first, InputIt last);
+  btree_multiset(const btree_multiset &other)
+      : BTree<Key, void, Compare>(other){};
+  btree_multiset(btree_multiset &&other) noexcept
+      : BTree<Key, void, Compare>(std::move(other)){};
+  btree_multiset &operator=(const btree_multiset &other) = default;
+  btree_multiset &operator=(btree_multiset &&other) noexcept = default;
+  ~btree_multiset() = default;
+
+  // Вставляет элемент после всех равных ему
+  iterator insert(const value_type &value);
+
+  // Создает элемент на месте из args и вставляет его
+  template <typename... Args>
+  iterator emplace(Args &&...args);
+
+  // Возвращает количество элементов, равных key
+  size_type count(const key_type &key);
+
+  // Возвращает диапазон элементов, равных key
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+
+  // Вставляет новые элементы в контейнер
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Переносит все элементы other
+  void merge(btree_multiset &other);
+};
+
+}  // namespace s21
+
+#include "../files/s21_btree_multiset.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_MULTISET_H
@@ -0,0 +1,53 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
+
+#include "s21_btree.h"
+
+namespace s21 {
+// Множество на B-дереве с интерфейсом s21::set. В отличие от set,
+// вставка и удаление делают недействительными все итераторы
+template <typename Key, typename Compare = std::less<Key>>
+class btree_set : public BTree<Key, void, Compare> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const Key &;
+  using iterator = typename BTree<Key, void, Compare>::Iterator;
+  using size_type = size_t;
+
+  btree_set() : BTree<Key, void, Compare>(){};
+  btree_set(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  btree_set(InputIt first, InputIt last);
+  btree_set(const btree_set &other) : BTree<Key, void, Compare>(other){};
+  btree_set(btree_set &&other) noexcept
+      : BTree<Key, void, Compare>(std::move(other)){};
+  btree_set &operator=(const btree_set &other) = default;
+  btree_set &operator=(btree_set &&other) noexcept = default;
+  ~btree_set() = default;
+
+  // Вставляет элемент, если его еще нет
+  std::pair<iterator, bool> insert(const value_type &value);
+
+  // Создает элемент на месте из args и вставляет его
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // Возвращает 1, если элемент есть, иначе 0
+  size_type count(const key_type &key);
+
+  // Вставляет новые элементы в контейнер. Возвращаемые итераторы
+  // действительны после всех вставок
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Переносит элементы other, которых еще нет; остальные остаются в other
+  void merge(btree_set &other);
+};
+
+}  // namespace s21
+
+#include "../files/s21_btree_set.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_BTREE_SET_H
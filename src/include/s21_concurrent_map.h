@@ -0,0 +1,244 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_CONCURRENT_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_CONCURRENT_MAP_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <thread>
+#include <utility>
+
+#include "s21_epoch.h"
+
+namespace s21 {
+// Узел конкурентного AVL-дерева. Все поля, которые читаются без
+// блокировки, атомарны. version - версия и блокировка узла одновременно
+template <typename Key, typename T>
+struct ConcurrentNode {
+  // Значение лежит в отдельном блоке: замена значения подменяет указатель,
+  // и читатель копирует целый блок, а старый освобождается по эпохам
+  struct Value {
+    T value;
+    template <typename... Args>
+    explicit Value(Args &&...args) : value(std::forward<Args>(args)...) {}
+  };
+
+  // Спуск читает ключ, версию и ссылки на потомков: они идут первыми,
+  // чтобы чаще попадать в одну кэш-линию. Ключ не создается только у
+  // корневого держателя дерева
+  union {
+    Key key;
+  };
+  std::atomic<uint64_t> version;
+  std::atomic<ConcurrentNode *> left;
+  std::atomic<ConcurrentNode *> right;
+  // nullptr у узла-развилки: ключ удален, но у узла два потомка
+  std::atomic<Value *> value;
+  std::atomic<int> height;
+  std::atomic<ConcurrentNode *> parent;
+
+  ConcurrentNode()
+      : version(0),
+        left(nullptr),
+        right(nullptr),
+        value(nullptr),
+        height(0),
+        parent(nullptr) {}
+  template <typename K>
+  ConcurrentNode(K &&k, Value *v, ConcurrentNode *p)
+      : key(std::forward<K>(k)),
+        version(0),
+        left(nullptr),
+        right(nullptr),
+        value(v),
+        height(1),
+        parent(p) {}
+  ~ConcurrentNode() {}
+};
+
+// Ассоциативный массив для одновременной работы многих потоков без
+// общей блокировки. Это AVL-дерево с оптимистичной сцепкой блокировок
+// (Bronson et al., 2010):
+// - у каждого узла есть версия; поворот, уносящий ключи из поддерева
+//   узла, помечает версию, и читатель, спускавшийся через узел, повторяет
+//   шаг от родителя. Читатели не берут блокировок;
+// - писатель блокирует только узел, в который вставляет или который
+//   меняет, и узлы, участвующие в повороте, всегда от родителя к потомку;
+// - удаление узла с двумя потомками оставляет его развилкой без значения,
+//   развилки с одним потомком вырезаются при балансировке;
+// - баланс ослаблен: высоты чинятся после изменения снизу вверх и в
+//   состоянии покоя дерево снова строго сбалансировано;
+// - вырезанные узлы и старые значения освобождаются через EpochDomain.
+// Значения возвращаются копией. Копирование и перемещение контейнера
+// запрещены
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class concurrent_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using node_type = ConcurrentNode<Key, T>;
+
+  concurrent_map();
+  explicit concurrent_map(const Compare &comp);
+  concurrent_map(std::initializer_list<value_type> const &items);
+  concurrent_map(const concurrent_map &) = delete;
+  concurrent_map &operator=(const concurrent_map &) = delete;
+  ~concurrent_map();
+
+  // Вставляет элемент, если ключа еще нет. Возвращает true, если
+  // элемент вставлен
+  bool insert(const key_type &key, const mapped_type &obj);
+
+  // Вставляет элемент или заменяет значение существующего. Возвращает
+  // true, если элемент вставлен
+  bool insert_or_assign(const key_type &key, const mapped_type &obj);
+
+  // Стирает элемент с ключом key, если он есть
+  bool erase(const key_type &key);
+
+  // Копирует значение элемента с ключом key в value. Возвращает false,
+  // если ключа нет
+  bool find(const key_type &key, mapped_type &value) const;
+
+  // Проверяет, содержится ли элемент с заданным ключом
+  bool contains(const key_type &key) const;
+
+  // Возвращает кол-во элементов; при одновременных изменениях - на
+  // какой-то момент недавнего прошлого
+  size_type size() const;
+
+  // Проверяет контейнер на пустоту
+  bool empty() const;
+
+  // Возвращает объект сравнения ключей
+  key_compare key_comp() const;
+
+  // Вызывает f(key, value) для элементов по возрастанию ключей. Только
+  // без одновременных изменений
+  template <typename F>
+  void for_each(F f) const;
+
+  // Проверяет порядок ключей, ссылки на родителей, высоты и AVL-баланс.
+  // Только без одновременных изменений
+  bool IsValid() const;
+
+ private:
+  using Value = typename node_type::Value;
+
+  // Биты версии: узел заблокирован; поддерево узла теряет ключи при
+  // повороте; узел вырезан из дерева. Остальные биты - счетчик поворотов
+  static constexpr uint64_t kLocked = 1;
+  static constexpr uint64_t kShrinking = 2;
+  static constexpr uint64_t kUnlinked = 4;
+  static constexpr uint64_t kShrinkStep = 8;
+
+  // Результаты шага поиска и изменения
+  enum class Result { kRetry, kAbsent, kPresent };
+
+  // Что делает Update с найденным или отсутствующим ключом
+  enum class Mode { kInsert, kAssign, kErase };
+
+  // Состояние узла для балансировки: неотрицательное значение - новая
+  // высота узла
+  static constexpr int kUnlinkRequired = -1;
+  static constexpr int kRebalanceRequired = -2;
+  static constexpr int kNothingRequired = -3;
+
+  // Сколько отложенных проверок родителей помнит одна починка: не меньше
+  // высоты AVL-дерева из SIZE_MAX узлов. Если конкурентные изменения
+  // переполнят стек, починка проходит всех предков по ссылкам parent
+  static constexpr int kPendingFixes = 96;
+
+  // Сравнивает key с ключом узла: -1 - левее, 1 - правее, 0 - равны.
+  // Держатель корня правее любого ключа
+  int Direction(const key_type &key, const node_type *node) const;
+
+  static node_type *Child(const node_type *node, int dir);
+  static void SetChild(node_type *node, int dir, node_type *child);
+  static int Height(const node_type *node);
+
+  static void Lock(node_type *node);
+  static void Unlock(node_type *node);
+
+  // Ждет окончания поворота, уносящего ключи из поддерева node
+  static void WaitUntilNotShrinking(const node_type *node);
+
+  // Проверяет, менялась ли версия node с момента version, не считая
+  // блокировки
+  static bool Changed(const node_type *node, uint64_t version);
+
+  // Поиск ниже node в направлении dir; version - прочитанная версия node
+  Result AttemptGet(const key_type &key, const node_type *node, int dir,
+                    uint64_t version, mapped_type *out) const;
+
+  // Выполняет mode для key; box - новое значение (nullptr для kErase).
+  // Если box не понадобился, он удаляется
+  Result Update(const key_type &key, Mode mode, Value *box);
+
+  Result AttemptUpdate(const key_type &key, Mode mode, Value *&box,
+                       node_type *parent, node_type *node, uint64_t version);
+
+  // Изменяет значение найденного узла node с родителем parent
+  Result AttemptNodeUpdate(Mode mode, Value *&box, node_type *parent,
+                           node_type *node);
+
+  // Вырезает node с не более чем одним потомком; оба узла заблокированы
+  bool AttemptUnlink(node_type *parent, node_type *node);
+
+  int NodeCondition(node_type *node) const;
+
+  // Чинит высоту заблокированного узла и возвращает следующий узел,
+  // требующий внимания, или nullptr
+  node_type *FixHeight(node_type *node);
+
+  // Чинит высоты и баланс от node вверх, пока это требуется
+  void FixHeightAndRebalance(node_type *node);
+
+  // Балансирует node; parent и node заблокированы
+  node_type *Rebalance(node_type *parent, node_type *node);
+  node_type *RebalanceToRight(node_type *parent, node_type *node,
+                              node_type *left, int hr0);
+  node_type *RebalanceToLeft(node_type *parent, node_type *node,
+                             node_type *right, int hl0);
+  node_type *RotateRight(node_type *parent, node_type *node, node_type *left,
+                         int hr, int hll, node_type *left_right, int hlr);
+  node_type *RotateLeft(node_type *parent, node_type *node, int hl,
+                        node_type *right, node_type *right_left, int hrl,
+                        int hrr);
+  node_type *RotateRightOverLeft(node_type *parent, node_type *node,
+                                 node_type *left, int hr, int hll,
+                                 node_type *left_right, int hlrl);
+  node_type *RotateLeftOverRight(node_type *parent, node_type *node, int hl,
+                                 node_type *right, node_type *right_left,
+                                 int hrr, int hrlr);
+
+  // Передает вырезанный узел и его значение на освобождение по эпохам
+  static void Retire(node_type *node);
+  static void Retire(Value *box);
+  static void DeleteNode(void *node);
+  static void DeleteValue(void *box);
+
+  // Удаляет поддерево без ожидания эпох
+  static void DestroyTree(node_type *node);
+
+  template <typename F>
+  static void ForEach(const node_type *node, F &f);
+
+  bool IsValid(const node_type *node, const key_type *lo,
+               const key_type *hi, int &height) const;
+
+  // Держатель корня: корень - его правый потомок
+  node_type holder_;
+  std::atomic<size_type> size_;
+  Compare comp_;
+};
+}  // namespace s21
+
+#include "../files/s21_concurrent_map.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_CONCURRENT_MAP_H
@@ -0,0 +1,115 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_CONCURRENT_QUEUE_H
+#define CPP2_S21_CONTAINERS_1_S21_CONCURRENT_QUEUE_H
+
+#include <atomic>
+#include <cstddef>
+#include <initializer_list>
+#include <new>
+#include <thread>
+#include <utility>
+
+namespace s21 {
+// Размер кэш-линии, на которую выравниваются счетчики очереди
+constexpr std::size_t kCacheLineSize = 64;
+
+// Ограниченная очередь для многих производителей и многих потребителей
+// без блокировок (D. Vyukov). Элементы лежат в кольце из степени двойки
+// ячеек, и у каждой ячейки есть номер последовательности:
+// - ячейка pos свободна для записи, когда ее номер равен pos;
+// - после записи номер становится pos + 1, и ячейку можно читать;
+// - после чтения номер становится pos + capacity: ячейка ждет записи
+//   на следующем круге.
+// Производитель и потребитель занимают позицию одним CAS своего счетчика,
+// после чего работают с ячейкой без гонок. Счетчики лежат в разных
+// кэш-линиях, чтобы производители и потребители не мешали друг другу.
+// Память не выделяется после конструктора. Копирование и перемещение
+// элементов не должны бросать исключений: иначе занятая ячейка не
+// освободится. Копирование и перемещение самой очереди запрещены
+template <typename T>
+class concurrent_queue {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = size_t;
+
+  // Емкость очереди по умолчанию
+  static constexpr size_type kDefaultCapacity = 1024;
+
+  concurrent_queue();
+  // Емкость округляется вверх до степени двойки
+  explicit concurrent_queue(size_type capacity);
+  concurrent_queue(std::initializer_list<value_type> const &items);
+  concurrent_queue(const concurrent_queue &) = delete;
+  concurrent_queue &operator=(const concurrent_queue &) = delete;
+  ~concurrent_queue();
+
+  // Добавляет элемент в конец; если очередь полна, ждет места
+  void push(const_reference value);
+
+  // Извлекает первый элемент в value; если очередь пуста, ждет элемента
+  void pop(reference value);
+
+  // Добавляет элемент, если есть место. Возвращает false, если очередь
+  // полна
+  bool try_push(const_reference value);
+  bool try_push(value_type &&value);
+
+  // Извлекает первый элемент в value. Возвращает false, если очередь
+  // пуста
+  bool try_pop(reference value);
+
+  // Добавляет до count элементов из items одним захватом позиций.
+  // Возвращает, сколько добавлено
+  size_type try_push_many(const value_type *items, size_type count);
+
+  // Извлекает до count элементов в out одним захватом позиций.
+  // Возвращает, сколько извлечено
+  size_type try_pop_many(value_type *out, size_type count);
+
+  // Добавляет элементы в конец, ожидая места для каждого
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+  // Проверяет очередь на пустоту; при одновременных изменениях ответ
+  // может сразу устареть
+  bool empty() const;
+
+  // Возвращает количество элементов на какой-то момент недавнего прошлого
+  size_type size() const;
+
+  // Возвращает емкость очереди
+  size_type capacity() const;
+
+ private:
+  struct Slot {
+    std::atomic<size_type> sequence;
+    alignas(T) unsigned char storage[sizeof(T)];
+
+    T *value() { return std::launder(reinterpret_cast<T *>(storage)); }
+  };
+
+  // Находит, сколько ячеек подряд с позиции pos готовы к записи (ready
+  // равен 0) или к чтению (ready равен 1), и занимает их CAS счетчика
+  // position. Возвращает число занятых ячеек; pos - первая из них
+  size_type Claim(std::atomic<size_type> &position, size_type ready,
+                  size_type count, size_type &pos);
+
+  // Ждет, пока другой поток освободит место или добавит элемент
+  static void Backoff(unsigned &spins);
+
+  static size_type RoundUp(size_type capacity);
+
+  Slot *buffer_;
+  size_type mask_;
+  // Счетчики производителей и потребителей - каждый в своей кэш-линии.
+  // Выравнивание класса не дает соседним объектам занять линию
+  // dequeue_pos_
+  alignas(kCacheLineSize) std::atomic<size_type> enqueue_pos_;
+  alignas(kCacheLineSize) std::atomic<size_type> dequeue_pos_;
+};
+}  // namespace s21
+
+#include "../files/s21_concurrent_queue.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_CONCURRENT_QUEUE_H
@@ -0,0 +1,141 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_COUNTED_MULTISET_H
+#define CPP2_S21_CONTAINERS_1_S21_COUNTED_MULTISET_H
+
+#include "AVL_tree.h"
+
+namespace s21 {
+// Мультимножество со сжатием повторов: каждый различный ключ хранится в
+// одном узле AVL-дерева вместе с числом своих копий. Память зависит от
+// числа различных ключей, а не от числа элементов; вставка, удаление
+// одной копии, count и equal_range - один спуск по дереву, O(log k).
+// Итератор проходит каждую копию: это узел и номер копии в нем
+template <typename Key, typename Compare = std::less<Key>,
+          typename NodeAllocator = NodePool<Node<Key, size_t>>>
+class counted_multiset : private BinaryTree<Key, size_t, Compare,
+                                            NodeAllocator> {
+  using tree_type = BinaryTree<Key, size_t, Compare, NodeAllocator>;
+  using tree_iterator = typename tree_type::Iterator;
+
+ public:
+  class CountedIterator;
+
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const Key &;
+  using iterator = CountedIterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+  using node_type = typename tree_type::node_type;
+
+  counted_multiset() : tree_type(), total_(0){};
+  counted_multiset(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  counted_multiset(InputIt first, InputIt last);
+  counted_multiset(const counted_multiset &other)
+      : tree_type(other), total_(other.total_){};
+  counted_multiset(counted_multiset &&other) noexcept
+      : tree_type(std::move(other)), total_(other.total_) {
+    other.total_ = 0;
+  };
+  counted_multiset &operator=(counted_multiset &&other);
+  ~counted_multiset() = default;
+
+  iterator begin();
+  iterator end();
+
+  bool empty() const;
+
+  // Возвращает количество элементов с учетом повторов за O(1)
+  size_type size() const;
+
+  // Возвращает количество различных ключей, то есть узлов дерева
+  size_type distinct_size() const;
+
+  using tree_type::key_comp;
+  using tree_type::max_size;
+
+  // Добавляет копию value; итератор указывает на нее, она идет после
+  // уже имеющихся равных элементов
+  iterator insert(const value_type &value);
+
+  // Добавляет n копий value за один спуск; итератор указывает на первую
+  iterator insert(const value_type &value, size_type n);
+
+  template <class... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Удаляет одну копию; узел удаляется вместе с последней копией.
+  // Итераторы на последнюю копию этого ключа становятся недействительными
+  void erase(iterator pos);
+  bool erase(const key_type &key);
+
+  // Удаляет все копии key и возвращает их количество
+  size_type erase_all(const key_type &key);
+
+  void clear();
+  void swap(counted_multiset &other);
+
+  // Добавляет копии всех элементов other, складывая счетчики; other
+  // становится пустым
+  void merge(counted_multiset &other);
+
+  // Поиск за один спуск: счетчик хранится в узле
+  size_type count(const key_type &key) const;
+  bool contains(const key_type &key) const;
+  iterator find(const key_type &key);
+  iterator lower_bound(const key_type &key);
+  iterator upper_bound(const key_type &key);
+  std::pair<iterator, iterator> equal_range(const key_type &key);
+
+  // Заменяет содержимое элементами [first, last): равные ключи
+  // сворачиваются в счетчики, дерево строится за O(n) для
+  // отсортированного входа, иначе вход сначала сортируется
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
+
+  // Двунаправленный итератор по всем копиям: узел дерева и номер копии
+  // в нем. Переход к соседнему узлу - только после последней копии
+  class CountedIterator {
+   public:
+    friend class counted_multiset;
+
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+    using value_type = Key;
+    using pointer = const Key *;
+    using reference = const Key &;
+
+    CountedIterator() : index_(0) {}
+
+    reference operator*() { return node_.first(); }
+
+    iterator &operator++();
+    iterator operator++(int);
+    iterator &operator--();
+    iterator operator--(int);
+    bool operator==(const iterator &other) const;
+    bool operator!=(const iterator &other) const;
+
+   private:
+    CountedIterator(tree_iterator node, size_type index)
+        : node_(node), index_(index) {}
+
+    tree_iterator node_;
+    size_type index_;
+  };
+
+ private:
+  // Возвращает итератор на копию index узла node или end()
+  iterator MakeIterator(node_type *node, size_type index);
+
+  // Удаляет одну копию из узла node
+  void EraseOne(node_type *node);
+
+  size_type total_;
+};
+}  // namespace s21
+
+#include "../files/s21_counted_multiset.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_COUNTED_MULTISET_H
@@ -0,0 +1,239 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_DEQUE_H
+#define CPP2_S21_CONTAINERS_1_S21_DEQUE_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Число элементов в блоке deque: степень двойки, чтобы блок занимал около
+// bytes байт, но не меньше 16 элементов
+constexpr std::size_t DequeBlockSize(std::size_t element_size,
+                                     std::size_t bytes) {
+  std::size_t count = 16;
+  while (2 * count * element_size <= bytes) count *= 2;
+  return count;
+}
+
+// Двусторонняя очередь на карте блоков одинакового размера. Элемент
+// с номером i лежит в позиции start_ + i пространства карты: блок -
+// позиция / kBlockSize, место в блоке - остаток. Поэтому:
+// - operator[] - два обращения к памяти без ветвлений;
+// - добавление с любого конца занимает место в крайнем блоке, а новый
+//   блок выделяется раз в kBlockSize элементов;
+// - блоки никогда не перемещаются, и ссылки на элементы остаются
+//   действительными при добавлении и удалении на концах (кроме удаленных
+//   элементов); переполненная карта перевыделяется, но это копирует
+//   только указатели на блоки.
+// Выделены только блоки, в которых есть элементы. Один освободившийся
+// блок остается про запас, чтобы очередь, которая то пустеет, то
+// наполняется, не выделяла память на каждом круге
+template <typename T>
+class deque {
+  template <bool Const>
+  class DequeIterator;
+
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = DequeIterator<false>;
+  using const_iterator = DequeIterator<true>;
+
+  // Число элементов в блоке
+  static constexpr size_type kBlockSize = DequeBlockSize(sizeof(T), 512);
+
+  deque();
+  explicit deque(size_type n);
+  deque(std::initializer_list<value_type> const &items);
+  deque(const deque &other);
+  deque(deque &&other) noexcept;
+  ~deque();
+  deque &operator=(const deque &other);
+  deque &operator=(deque &&other) noexcept;
+
+  // Доступ к элементам
+  reference at(size_type pos);
+  const_reference at(size_type pos) const;
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+
+  void clear();
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+  void push_front(const_reference value);
+  void push_front(value_type &&value);
+
+  // Создают элемент на месте из args в конце или в начале
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
+
+  // Удаляют крайний элемент; у пустой очереди ничего не делают
+  void pop_back();
+  void pop_front();
+
+  void swap(deque &other) noexcept;
+
+  // Добавляют новые элементы в конец или начало; в начале они идут в
+  // порядке аргументов
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+  template <typename... Args>
+  void insert_many_front(Args &&...args);
+
+ private:
+  // Итератор произвольного доступа: очередь и номер элемента
+  template <bool Const>
+  class DequeIterator {
+   public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = std::conditional_t<Const, const T *, T *>;
+    using reference = std::conditional_t<Const, const T &, T &>;
+    using container_pointer =
+        std::conditional_t<Const, const deque *, deque *>;
+
+    DequeIterator() : deque_(nullptr), pos_(0) {}
+    DequeIterator(container_pointer container, size_type pos)
+        : deque_(container), pos_(pos) {}
+    // Неконстантный итератор приводится к константному
+    template <bool Other, typename = std::enable_if_t<Const && !Other>>
+    DequeIterator(const DequeIterator<Other> &other)
+        : deque_(other.deque_), pos_(other.pos_) {}
+
+    reference operator*() const { return (*deque_)[pos_]; }
+    pointer operator->() const { return &(*deque_)[pos_]; }
+    reference operator[](difference_type n) const {
+      return (*deque_)[pos_ + n];
+    }
+
+    DequeIterator &operator++() {
+      ++pos_;
+      return *this;
+    }
+    DequeIterator operator++(int) {
+      DequeIterator old = *this;
+      ++pos_;
+      return old;
+    }
+    DequeIterator &operator--() {
+      --pos_;
+      return *this;
+    }
+    DequeIterator operator--(int) {
+      DequeIterator old = *this;
+      --pos_;
+      return old;
+    }
+    DequeIterator &operator+=(difference_type n) {
+      pos_ += n;
+      return *this;
+    }
+    DequeIterator &operator-=(difference_type n) {
+      pos_ -= n;
+      return *this;
+    }
+    DequeIterator operator+(difference_type n) const {
+      return DequeIterator(deque_, pos_ + n);
+    }
+    DequeIterator operator-(difference_type n) const {
+      return DequeIterator(deque_, pos_ - n);
+    }
+    // Сравнения принимают и константные, и неконстантные итераторы
+    template <bool Other>
+    difference_type operator-(const DequeIterator<Other> &other) const {
+      return static_cast<difference_type>(pos_) -
+             static_cast<difference_type>(other.pos_);
+    }
+
+    template <bool Other>
+    bool operator==(const DequeIterator<Other> &other) const {
+      return pos_ == other.pos_ && deque_ == other.deque_;
+    }
+    template <bool Other>
+    bool operator!=(const DequeIterator<Other> &other) const {
+      return !(*this == other);
+    }
+    template <bool Other>
+    bool operator<(const DequeIterator<Other> &other) const {
+      return pos_ < other.pos_;
+    }
+    template <bool Other>
+    bool operator>(const DequeIterator<Other> &other) const {
+      return other < *this;
+    }
+    template <bool Other>
+    bool operator<=(const DequeIterator<Other> &other) const {
+      return !(other < *this);
+    }
+    template <bool Other>
+    bool operator>=(const DequeIterator<Other> &other) const {
+      return !(*this < other);
+    }
+
+   private:
+    friend class DequeIterator<!Const>;
+
+    container_pointer deque_;
+    size_type pos_;
+  };
+
+  // Карта сначала выделяется на столько блоков
+  static constexpr size_type kMinMapSize = 8;
+
+  // Адрес позиции pos пространства карты
+  T *Position(size_type pos) const;
+
+  // Гарантирует, что блок позиции pos выделен
+  void EnsureBlock(size_type pos);
+
+  // Освобождает блок позиции pos, в котором не осталось элементов
+  void ReleaseBlock(size_type pos);
+
+  // Перевыделяет карту так, чтобы занятые блоки оказались посередине и
+  // с обеих сторон было место
+  void RecenterMap();
+
+  // Создает элемент перед началом или после конца
+  template <typename... Args>
+  void EmplaceBack(Args &&...args);
+  template <typename... Args>
+  void EmplaceFront(Args &&...args);
+
+  static T *AllocateBlock();
+  static void DeallocateBlock(T *block);
+
+  T **map_;
+  size_type map_size_;
+  size_type start_;
+  size_type size_;
+  T *spare_;
+};
+}  // namespace s21
+
+#include "../files/s21_deque.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_DEQUE_H
@@ -0,0 +1,90 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_EPOCH_H
+#define CPP2_S21_CONTAINERS_1_S21_EPOCH_H
+
+#include <atomic>
+#include <cstdint>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Освобождение памяти по эпохам для контейнеров с чтением без блокировок.
+// Поток, который читает общие узлы, держит Guard. Удаленный из
+// структуры узел передается в Retire и освобождается только после того,
+// как глобальная эпоха продвинется на два шага: к этому моменту каждый
+// Guard, который мог видеть узел, уже снят. Эпоха продвигается, когда
+// все потоки внутри Guard видели текущую
+class EpochDomain {
+ private:
+  struct Record;
+
+ public:
+  // Общий домен всех контейнеров и единственный экземпляр: запись потока
+  // хранится в одной thread_local переменной
+  static EpochDomain &Global();
+
+  EpochDomain(const EpochDomain &) = delete;
+  EpochDomain &operator=(const EpochDomain &) = delete;
+  ~EpochDomain();
+
+  // Пока объект жив, узлы Global(), прочитанные текущим потоком, не
+  // освобождаются. Guard можно вкладывать друг в друга
+  class Guard {
+   public:
+    Guard();
+    Guard(const Guard &) = delete;
+    Guard &operator=(const Guard &) = delete;
+    ~Guard();
+
+   private:
+    Record *record_;
+  };
+
+  // Откладывает deleter(ptr) до момента, когда ptr не сможет прочитать
+  // ни один поток. ptr уже должен быть недостижим из структуры
+  void Retire(void *ptr, void (*deleter)(void *));
+
+  // Возвращает текущую глобальную эпоху
+  uint64_t epoch() const;
+
+ private:
+  // Эпоха сдвигается после стольких Retire одного потока
+  static constexpr unsigned kCollectPeriod = 64;
+
+  struct Retired {
+    void *ptr;
+    void (*deleter)(void *);
+    uint64_t epoch;
+  };
+
+  // Состояние потока. Записи не удаляются до разрушения домена: поток при
+  // завершении освобождает свою, и ее берет следующий поток
+  struct Record {
+    // (эпоха << 1) | 1, пока поток внутри Guard; 0 вне Guard
+    std::atomic<uint64_t> state{0};
+    std::atomic<bool> in_use{false};
+    Record *next = nullptr;
+    // Поля ниже меняет только владелец записи
+    unsigned depth = 0;
+    unsigned retired_since_collect = 0;
+    vector<Retired> limbo;
+  };
+
+  EpochDomain() = default;
+
+  // Возвращает запись текущего потока
+  Record *ThisThread();
+
+  // Продвигает эпоху, если все потоки внутри Guard видели текущую
+  void TryAdvance();
+
+  // Освобождает узлы записи, удаленные два и более шага эпохи назад
+  void Collect(Record *record);
+
+  std::atomic<uint64_t> epoch_{2};
+  std::atomic<Record *> records_{nullptr};
+};
+}  // namespace s21
+
+#include "../files/s21_epoch.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_EPOCH_H
@@ -0,0 +1,194 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_flat_search.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Ассоциативный массив в двух отсортированных s21::vector - ключей и
+// значений - с интерфейсом s21::map. Поиск читает только плотный массив
+// ключей. Одиночная вставка и удаление сдвигают хвосты массивов за O(n),
+// поэтому контейнер рассчитан на однократное построение и частые чтения.
+// Вставка и удаление делают итераторы недействительными
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class flat_map {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = Iterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  flat_map() : keys_(), values_(), comp_(){};
+  explicit flat_map(const Compare &comp) : keys_(), values_(), comp_(comp){};
+  flat_map(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  flat_map(InputIt first, InputIt last);
+  flat_map(const flat_map &other) = default;
+  flat_map(flat_map &&other) = default;
+  flat_map &operator=(const flat_map &other) = default;
+  flat_map &operator=(flat_map &&other) = default;
+  ~flat_map() = default;
+
+  // Дает доступ к указанному элементу с проверкой границ
+  mapped_type &at(const key_type &key);
+
+  // Дает доступ или вставляет указанный элемент
+  mapped_type &operator[](const key_type &key);
+
+  // Возвращает итератор к началу
+  iterator begin();
+
+  // Возвращает итератор к концу
+  iterator end();
+
+  // Проверяет контейнер на пустоту
+  bool empty() const;
+
+  // Возвращает кол-во элементов
+  size_type size() const;
+
+  // Возвращает максимально возможное количество элементов
+  size_type max_size() const;
+
+  // Резервирует место под count элементов
+  void reserve(size_type count);
+
+  // Очищает содержимое
+  void clear();
+
+  // Вставляет элемент, если ключа еще нет, сдвигая хвосты массивов
+  std::pair<iterator, bool> insert(const value_type &value);
+
+  // Вставляет элементы [first, last): сортирует их и сливает с уже
+  // имеющимися за один проход, без сдвига на каждый элемент. Из равных
+  // ключей остается уже имевшийся или первый из вставляемых
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+
+  // Вставляет элемент или присваивает текущему элементу, если ключ уже
+  // существует
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+
+  // Создает элемент из args, если ключа еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // Если ключа нет, создает значение из args; иначе ничего не делает
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args);
+
+  // Вставляет новые элементы в контейнер. Возвращаемые итераторы
+  // действительны после всех вставок
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Стирает элемент в позиции
+  void erase(iterator pos);
+
+  // Стирает элемент с ключом key, если он есть
+  bool erase(const key_type &key);
+
+  // Меняет местами содержимое
+  void swap(flat_map &other);
+
+  // Переносит элементы other с ключами, которых еще нет; остальные
+  // остаются в other
+  void merge(flat_map &other);
+
+  // Ищет элемент с ключом key
+  iterator find(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key);
+
+  // Проверяет, содержится ли элемент с заданным ключом
+  bool contains(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+
+  // Возвращает итератор на первый элемент с ключом не меньше key
+  iterator lower_bound(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+
+  // Возвращает итератор на первый элемент с ключом больше key
+  iterator upper_bound(const key_type &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key);
+
+  // Возвращает итератор на k-й по порядку элемент (с нуля) или end()
+  iterator nth(size_type k);
+
+  // Возвращает количество элементов с ключом строго меньше key
+  size_type rank(const key_type &key) const;
+
+  // Возвращает количество элементов с ключом из полуинтервала [lo, hi)
+  size_type count_range(const key_type &lo, const key_type &hi) const;
+
+  // Возвращает объект сравнения ключей
+  key_compare key_comp() const;
+
+  class Iterator {
+   private:
+    flat_map *iter_map;
+    size_type iter_index;
+
+   public:
+    friend class flat_map;
+
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() : iter_map(nullptr), iter_index(0) {}
+    Iterator(flat_map *map, size_type index)
+        : iter_map(map), iter_index(index) {}
+
+    iterator operator++(int);
+    iterator &operator++();
+    iterator operator--(int);
+    iterator &operator--();
+    bool operator==(const iterator &other) const;
+    bool operator!=(const iterator &other) const;
+    const mapped_type &operator*() const;
+    const key_type &first() const;
+    mapped_type &second() const;
+  };
+
+ private:
+  // Индекс первого ключа не меньше key
+  template <typename K>
+  size_type LowerIndex(const K &key) const;
+
+  // Создает ключ из key и значение из args в позиции i, сдвигая хвосты
+  // массивов. Если значение не создалось, ключ удаляется обратно
+  template <typename K, typename... Args>
+  iterator InsertAt(size_type i, K &&key, Args &&...args);
+
+  vector<Key> keys_;
+  vector<T> values_;
+  Compare comp_;
+};
+
+}  // namespace s21
+
+#include "../files/s21_flat_map.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_MAP_H
@@ -0,0 +1,52 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_SEARCH_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_SEARCH_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <type_traits>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace s21 {
+// Длина отрезка, на котором двоичный поиск сменяется подсчетом: 64 байта
+// ключей, одна строка кеша
+constexpr std::size_t kFlatScanBytes = 64;
+
+// Можно ли искать key среди Key сравнением чисел, а не вызовом Compare:
+// арифметический ключ того же типа и порядок по возрастанию
+template <typename Key, typename Compare, typename K>
+constexpr bool kFlatNumericSearch =
+    std::is_arithmetic<Key>::value && std::is_same<Key, K>::value &&
+    (std::is_same<Compare, std::less<Key>>::value ||
+     std::is_same<Compare, std::less<>>::value);
+
+// Возвращает количество элементов keys[0, n), меньших key. Для int32_t,
+// float и double используются инструкции SSE2
+template <typename Key>
+std::size_t CountLess(const Key *keys, std::size_t n, Key key);
+
+// Возвращает количество элементов keys[0, n), больших key
+template <typename Key>
+std::size_t CountGreater(const Key *keys, std::size_t n, Key key);
+
+// Возвращает индекс первого элемента отсортированного keys[0, n), не
+// меньшего key. Двоичный поиск без ветвлений: отрезок сужается на
+// одинаковую длину при любом исходе сравнения. Для чисел поиск
+// останавливается на отрезке в одну строку кеша, который досчитывается
+// векторными сравнениями
+template <typename Key, typename Compare, typename K>
+std::size_t FlatLowerBound(const Key *keys, std::size_t n, const K &key,
+                           const Compare &comp);
+
+// Возвращает индекс первого элемента keys[0, n), большего key
+template <typename Key, typename Compare, typename K>
+std::size_t FlatUpperBound(const Key *keys, std::size_t n, const K &key,
+                           const Compare &comp);
+}  // namespace s21
+
+#include "../files/s21_flat_search.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_SEARCH_H
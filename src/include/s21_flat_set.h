@@ -0,0 +1,141 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FLAT_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <limits>
+#include <utility>
+
+#include "s21_flat_search.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Множество в отсортированном s21::vector с интерфейсом s21::set. Поиск
+// идет по непрерывному массиву ключей без переходов по указателям;
+// одиночная вставка и удаление сдвигают хвост массива за O(n), поэтому
+// контейнер рассчитан на редкие изменения и частые чтения. Итераторы -
+// указатели на ключи, вставка и удаление делают их недействительными
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const Key &;
+  using iterator = const Key *;
+  using const_iterator = const Key *;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  flat_set() : keys_(), comp_(){};
+  explicit flat_set(const Compare &comp) : keys_(), comp_(comp){};
+  flat_set(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  flat_set(InputIt first, InputIt last);
+  flat_set(const flat_set &other) = default;
+  flat_set(flat_set &&other) = default;
+  flat_set &operator=(const flat_set &other) = default;
+  flat_set &operator=(flat_set &&other) = default;
+  ~flat_set() = default;
+
+  // Возвращает итератор к началу
+  iterator begin() const;
+
+  // Возвращает итератор к концу
+  iterator end() const;
+
+  // Проверяет контейнер на пустоту
+  bool empty() const;
+
+  // Возвращает кол-во элементов
+  size_type size() const;
+
+  // Возвращает максимально возможное количество элементов
+  size_type max_size() const;
+
+  // Резервирует место под count элементов
+  void reserve(size_type count);
+
+  // Очищает содержимое
+  void clear();
+
+  // Вставляет элемент, если его еще нет, сдвигая хвост массива
+  std::pair<iterator, bool> insert(const value_type &value);
+
+  // Вставляет элементы [first, last): сортирует их и сливает с уже
+  // имеющимися за один проход, без сдвига на каждый элемент. Из равных
+  // элементов остается уже имевшийся или первый из вставляемых
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last);
+
+  // Создает элемент из args и вставляет его
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // Вставляет новые элементы в контейнер. Возвращаемые итераторы
+  // действительны после всех вставок
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Стирает элемент в позиции
+  void erase(iterator pos);
+
+  // Стирает элемент с ключом key, если он есть
+  bool erase(const key_type &key);
+
+  // Меняет местами содержимое
+  void swap(flat_set &other);
+
+  // Переносит элементы other, которых еще нет; остальные остаются в other
+  void merge(flat_set &other);
+
+  // Ищет элемент с ключом key
+  iterator find(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const;
+
+  // Проверяет, содержится ли элемент с заданным ключом
+  bool contains(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+
+  // Возвращает 1, если элемент есть, иначе 0
+  size_type count(const key_type &key) const;
+
+  // Возвращает итератор на первый элемент не меньше key
+  iterator lower_bound(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const;
+
+  // Возвращает итератор на первый элемент больше key
+  iterator upper_bound(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const;
+
+  // Возвращает итератор на k-й по порядку элемент (с нуля) или end()
+  iterator nth(size_type k) const;
+
+  // Возвращает количество элементов строго меньше key
+  size_type rank(const key_type &key) const;
+
+  // Возвращает количество элементов из полуинтервала [lo, hi)
+  size_type count_range(const key_type &lo, const key_type &hi) const;
+
+  // Возвращает объект сравнения ключей
+  key_compare key_comp() const;
+
+ private:
+  vector<Key> keys_;
+  Compare comp_;
+};
+
+}  // namespace s21
+
+#include "../files/s21_flat_set.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FLAT_SET_H
@@ -0,0 +1,182 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_FROZEN_TREE_H
+#define CPP2_S21_CONTAINERS_1_S21_FROZEN_TREE_H
+
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_flat_search.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Неизменяемый снимок дерева для поиска без изменений. Ключи лежат в
+// s21::vector в порядке обхода в ширину (раскладка Эйтцингера): потомки
+// элемента k - элементы 2k и 2k + 1, элемент 0 не используется. Спуск
+// идет по одному массиву без ветвлений, а потомки на несколько уровней
+// вперед занимают одну строку кеша и подгружаются заранее. Значения
+// хранятся отдельно в том же порядке; при T = void снимок - множество.
+// Снимок строится из отсортированной последовательности за O(n) и после
+// этого не меняется, поэтому читать его можно из нескольких потоков
+template <typename Key, typename T, typename Compare = std::less<Key>>
+class FrozenTree {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using mapped_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using value_type =
+      std::conditional_t<std::is_void<T>::value, Key,
+                         std::pair<const Key, mapped_type>>;
+  using reference = const mapped_type &;
+  using const_reference = const mapped_type &;
+  using iterator = Iterator;
+  using const_iterator = Iterator;
+  using size_type = size_t;
+  using key_compare = Compare;
+
+  FrozenTree();
+  explicit FrozenTree(const Compare &comp);
+
+  // Строит снимок из n элементов, начиная с first, отсортированных по
+  // возрастанию ключей. Ключ берется из first.first(), значение - из
+  // *first, как у итераторов s21::map, s21::btree_map и s21::flat_map
+  template <typename SortedIt>
+  FrozenTree(SortedIt first, size_type n, const Compare &comp = Compare());
+
+  FrozenTree(const FrozenTree &other);
+  FrozenTree(FrozenTree &&other);
+  FrozenTree &operator=(const FrozenTree &other);
+  FrozenTree &operator=(FrozenTree &&other);
+  ~FrozenTree() = default;
+
+  // Дает доступ к значению с ключом key с проверкой границ
+  const mapped_type &at(const key_type &key) const;
+
+  // Возвращает итератор к началу
+  iterator begin() const;
+
+  // Возвращает итератор к концу
+  iterator end() const;
+
+  // Проверяет контейнер на пустоту
+  bool empty() const;
+
+  // Возвращает кол-во элементов
+  size_type size() const;
+
+  // Возвращает максимально возможное количество элементов
+  size_type max_size() const;
+
+  // Ищет элемент с ключом key
+  iterator find(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator find(const K &key) const;
+
+  // Проверяет, содержится ли элемент с заданным ключом
+  bool contains(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  bool contains(const K &key) const;
+
+  // Возвращает количество элементов с ключом key
+  size_type count(const key_type &key) const;
+
+  // Возвращает итератор на первый элемент с ключом не меньше key
+  iterator lower_bound(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key) const;
+
+  // Возвращает итератор на первый элемент с ключом больше key
+  iterator upper_bound(const key_type &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key) const;
+
+  // Возвращает объект сравнения ключей
+  key_compare key_comp() const;
+
+  // Итератор обходит элементы по возрастанию ключей, переходя по
+  // индексам неявного дерева
+  class Iterator {
+   private:
+    const FrozenTree *iter_tree;
+    size_type iter_index;
+
+   public:
+    friend class FrozenTree;
+
+    using iterator_category = std::bidirectional_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() : iter_tree(nullptr), iter_index(0) {}
+    Iterator(const FrozenTree *tree, size_type index)
+        : iter_tree(tree), iter_index(index) {}
+
+    iterator operator++(int);
+    iterator &operator++();
+    iterator operator--(int);
+    iterator &operator--();
+    bool operator==(const iterator &other) const;
+    bool operator!=(const iterator &other) const;
+    const mapped_type &operator*() const;
+    const key_type &first() const;
+    const mapped_type &second() const;
+  };
+
+ private:
+  // Снимок множества не хранит значений
+  static constexpr bool kKeyOnly = std::is_void<T>::value;
+
+  // Сколько ключей помещается в строку кеша: столько потомков лежит
+  // подряд на log2(kBlock) уровней ниже текущего элемента
+  static constexpr size_type kBlock =
+      kFlatScanBytes / sizeof(Key) < 1 ? 1 : kFlatScanBytes / sizeof(Key);
+
+  // Раскладывает элементы из first по индексам поддерева k в порядке
+  // обхода слева направо
+  template <typename SortedIt>
+  void Fill(SortedIt &first, size_type k);
+
+  // Сдвигает раскладку так, чтобы keys_[kBlock * k] начинал строку кеша
+  void Align();
+
+  // Индекс первого ключа не меньше key или 0
+  template <typename K>
+  size_type LowerIndex(const K &key) const;
+
+  // Индекс первого ключа больше key или 0
+  template <typename K>
+  size_type UpperIndex(const K &key) const;
+
+  // Индекс первого в порядке обхода элемента поддерева k
+  size_type First(size_type k) const;
+
+  // Индекс последнего в порядке обхода элемента поддерева k
+  size_type Last(size_type k) const;
+
+  vector<Key> storage_;
+  vector<mapped_type> values_;
+  // Начало раскладки внутри storage_; keys_[1] - корень
+  Key *keys_;
+  size_type size_;
+  Compare comp_;
+};
+
+// Снимок s21::set и s21::multiset
+template <typename Key, typename Compare = std::less<Key>>
+using frozen_set = FrozenTree<Key, void, Compare>;
+
+// Снимок s21::map
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using frozen_map = FrozenTree<Key, T, Compare>;
+
+}  // namespace s21
+
+#include "../files/s21_frozen_tree.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_FROZEN_TREE_H
@@ -3,9 +3,13 @@
 
 #include <iostream>
 #include <limits>
+#include <memory>
 
 namespace s21 {
-template <typename T>
+// Двусвязный список. Узлы выделяет Allocator, перепривязанный к типу
+// узла; элементы создаются через него же, поэтому распределители с
+// uses-allocator (std::pmr) передаются и вложенным контейнерам
+template <typename T, typename Allocator = std::allocator<T>>
 class list {
  public:
   /* ___Внутриклассовые переопределения типов___ */
@@ -13,17 +17,46 @@ class list {
   using reference = value_type &;
   using const_reference = const value_type &;
   using size_type = size_t;
+  using allocator_type = Allocator;
 
  private:
   struct Node {
-    value_type data;
+    // Элемент создается и разрушается распределителем отдельно от узла
+    union {
+      value_type data;
+    };
     Node *prev;
     Node *next;
-    Node() : data(value_type()), prev(nullptr), next(nullptr) {}
-    explicit Node(const_reference data)
-        : data(data), prev(nullptr), next(nullptr) {}
+    Node() : prev(nullptr), next(nullptr) {}
+    ~Node() {}
   };
 
+  using NodeAllocator =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<Node>;
+  using NodeTraits = std::allocator_traits<NodeAllocator>;
+
+  // Перемещающее присваивание не бросает исключений, если может забрать
+  // узлы без поэлементного переноса
+  static constexpr bool kNoexceptMoveAssign =
+      NodeTraits::propagate_on_container_move_assignment::value ||
+      NodeTraits::is_always_equal::value;
+
+  // Создает узел на месте из args и вставляет его перед pos (nullptr -
+  // конец списка)
+  template <typename... Args>
+  Node *LinkBefore(Node *pos, Args &&...args);
+
+  // Разрушает элемент узла и освобождает узел
+  void FreeNode(Node *node);
+
+  // Освобождает все узлы, оставляя список пустым
+  void Release();
+
+  // Забирает узлы other, оставляя other пустым
+  void Steal(list &other) noexcept;
+
+  // Пустой распределитель не занимает места в объекте
+  [[no_unique_address]] NodeAllocator alloc_;
   Node *head_;
   Node *tail_;
   size_type size_;
@@ -32,12 +65,19 @@ class list {
   /* ___Методы для взаимодействия с классом___ */
 
   list();
-  explicit list(size_type n);
-  explicit list(std::initializer_list<value_type> const &items);
+  explicit list(const Allocator &alloc);
+  explicit list(size_type n, const Allocator &alloc = Allocator());
+  explicit list(std::initializer_list<value_type> const &items,
+                const Allocator &alloc = Allocator());
   list(const list &l);
+  list(const list &l, const Allocator &alloc);
   list(list &&l) noexcept;
+  list(list &&l, const Allocator &alloc);
   ~list();
-  list &operator=(list &&l) noexcept;
+  list &operator=(list &&l) noexcept(kNoexceptMoveAssign);
+
+  // Возвращает копию распределителя
+  allocator_type get_allocator() const;
 
   template <typename value_type>
   class ListIterator {
@@ -80,7 +120,9 @@ class list {
       return cur == other.cur;
     }
 
-    bool operator!=(const ListIterator &other) const { return *this != other; }
+    bool operator!=(const ListIterator &other) const {
+      return !(*this == other);
+    }
 
     Node *get_cur() { return this->cur; }
   };
@@ -134,29 +176,47 @@ class list {
   // Вставляет элемент в конкретную позицию и возвращает итератор, указывающий
   // на новый элемент
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+
+  // Создает элемент на месте из args перед pos
+  template <typename... Args>
+  iterator emplace(iterator pos, Args &&...args);
 
   // Cтирает элемент в позиции
   void erase(iterator pos);
 
   // Добавляет элемент в конец
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+
+  // Создает элемент на месте из args в конце
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
 
   // Удаляет последний элемент
   void pop_back();
 
   // Добавляет элемент в начало
   void push_front(const_reference value);
+  void push_front(value_type &&value);
+
+  // Создает элемент на месте из args в начале
+  template <typename... Args>
+  reference emplace_front(Args &&...args);
 
   // Удаляет первый элемент
   void pop_front();
 
-  // Меняет местами содержимое
+  // Меняет местами содержимое; распределители меняются, только если
+  // propagate_on_container_swap
   void swap(list &other);
 
-  // Объединяет два отсортированных списка
+  // Объединяет два отсортированных списка. Узлы перевешиваются, поэтому
+  // распределители списков должны быть равны
   void merge(list &other);
 
-  // Переносит элементы из другого списка, начиная с pos
+  // Переносит элементы из другого списка, начиная с pos; распределители
+  // должны быть равны
   void splice(const_iterator pos, list &other);
 
   // Изменяет порядок элементов
@@ -173,7 +233,8 @@ class list {
 
   /* ___Дополнительно___ */
 
-  // Вставляет новые элементы в контейнер непосредственно перед pos
+  // Вставляет новые элементы в контейнер непосредственно перед pos. Каждый
+  // элемент создается в своем узле прямо из аргумента, без копий
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
 
@@ -181,7 +242,7 @@ class list {
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
-  // Добавляет новые элементы в начало контейнераы
+  // Добавляет новые элементы в начало контейнера в порядке аргументов
   template <typename... Args>
   void insert_many_front(Args &&...args);
 };
@@ -4,8 +4,9 @@
 #include "AVL_tree.h"
 
 namespace s21 {
-template <typename Key, typename T>
-class map : public BinaryTree<Key, T> {
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename NodeAllocator = NodePool<Node<Key, T>>>
+class map : public BinaryTree<Key, T, Compare, NodeAllocator> {
  public:
   /* ___Внутриклассовые переопределения типов___ */
 
@@ -14,18 +15,43 @@ class map : public BinaryTree<Key, T> {
   using value_type = std::pair<const key_type, mapped_type>;
   using reference = value_type &;
   using const_reference = const value_type &;
-  using iterator = typename BinaryTree<Key, T>::Iterator;
-  using const_iterator = typename BinaryTree<Key, T>::ConstIterator;
+  using iterator =
+      typename BinaryTree<Key, T, Compare, NodeAllocator>::Iterator;
+  using const_iterator =
+      typename BinaryTree<Key, T, Compare, NodeAllocator>::ConstIterator;
+  using reverse_iterator =
+      typename BinaryTree<Key, T, Compare, NodeAllocator>::ReverseIterator;
+  using node_type =
+      typename BinaryTree<Key, T, Compare, NodeAllocator>::node_type;
   using size_type = size_t;
 
   /* ___Методы для взаимодействия с классом___ */
 
-  map() : BinaryTree<key_type, mapped_type>(){};
+  map() : BinaryTree<key_type, mapped_type, Compare, NodeAllocator>(){};
   map(std::initializer_list<value_type> const &items);
-  map(const map &other) : BinaryTree<key_type, mapped_type>(other){};
-  map(map &&other) noexcept : BinaryTree<key_type, T>(std::move(other)){};
+
+  // Узлы выделяет копия alloc, например AllocatorNodeAdapter над
+  // std::pmr::polymorphic_allocator
+  explicit map(const NodeAllocator &alloc)
+      : BinaryTree<key_type, mapped_type, Compare, NodeAllocator>(alloc) {}
+  map(std::initializer_list<value_type> const &items,
+      const NodeAllocator &alloc);
+  template <typename InputIt>
+  map(InputIt first, InputIt last);
+  map(const map &other)
+      : BinaryTree<key_type, mapped_type, Compare, NodeAllocator>(other){};
+  map(map &&other) noexcept
+      : BinaryTree<key_type, T, Compare, NodeAllocator>(std::move(other)){};
   ~map() = default;
 
+  // Узлы other забираются, если их может освобождать свой распределитель,
+  // иначе элементы перемещаются по одному (см. BinaryTree::operator=)
+  map &operator=(map &&other) noexcept(NodeAllocator::kMoveAssignNodes) {
+    BinaryTree<key_type, T, Compare, NodeAllocator>::operator=(
+        std::move(other));
+    return *this;
+  }
+
   /* ___Методы для доступа к элементам класса___ */
 
   // Дает доступ к указанному элементу с проверкой границ
@@ -40,6 +66,45 @@ class map : public BinaryTree<Key, T> {
   // существует
   std::pair<iterator, bool> insert_or_assign(const key_type &key,
                                              const mapped_type &obj);
+
+  // Создает элемент в узле из args - аргументов конструктора
+  // std::pair<key_type, mapped_type> - и вставляет узел, если ключа еще
+  // нет, иначе разрушает его. Ключ и значение или пара из args
+  // передаются в узел без промежуточной пары; прочие args (например,
+  // std::piecewise_construct) сначала собирают пару, которая
+  // перемещается в узел
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // То же, что emplace, с подсказкой: элемент встает перед hint. Если
+  // hint указывает на равный элемент или новый ключ лежит между hint и
+  // его предшественником (например, возрастающие ключи перед end()),
+  // спуск от корня не выполняется
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+
+  // Если ключа нет, создает значение на месте из args за один спуск;
+  // иначе ничего не делает и не трогает args. Как в std::map, ключ
+  // приводится к key_type до поиска
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(const key_type &key, Args &&...args);
+  template <typename... Args>
+  std::pair<iterator, bool> try_emplace(key_type &&key, Args &&...args);
+
+  // Заменяет содержимое элементами [first, last). Отсортированный вход
+  // укладывается в сбалансированное дерево за O(n), иначе сначала
+  // сортируется. Из повторяющихся ключей остается первый
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
+
+ private:
+  // Общая часть try_emplace для ключа key_type
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> TryEmplace(K &&key, Args &&...args);
+
+  // Создает узел из аргументов конструктора пары (см. emplace)
+  template <typename... Args>
+  node_type *CreateItemNode(Args &&...args);
 };
 
 }  // namespace s21
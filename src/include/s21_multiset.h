@@ -3,45 +3,88 @@
 #include "../include/AVL_tree.h"
 
 namespace s21 {
-template <typename Key>
-class multiset : public BinaryTree<Key, Key> {
+template <typename Key, typename Compare = std::less<Key>,
+          typename NodeAllocator = NodePool<Node<Key, void>>>
+class multiset : public BinaryTree<Key, Key, Compare, NodeAllocator> {
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const Key &;
-  using iterator = typename BinaryTree<Key, Key>::Iterator;
-  using const_iterator = typename BinaryTree<Key, Key>::ConstIterator;
+  using iterator =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::Iterator;
+  using const_iterator =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::ConstIterator;
+  using reverse_iterator =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::ReverseIterator;
+  using node_type =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::node_type;
   using size_type = size_t;
 
-  multiset() : BinaryTree<key_type, key_type>(){};
+  multiset() : BinaryTree<key_type, key_type, Compare, NodeAllocator>(){};
   multiset(std::initializer_list<value_type> const &items);
-  multiset(const multiset &other) : BinaryTree<key_type, key_type>(other){};
+
+  // Узлы выделяет копия alloc, например AllocatorNodeAdapter над
+  // std::pmr::polymorphic_allocator
+  explicit multiset(const NodeAllocator &alloc)
+      : BinaryTree<key_type, key_type, Compare, NodeAllocator>(alloc) {}
+  multiset(std::initializer_list<value_type> const &items,
+           const NodeAllocator &alloc);
+  template <typename InputIt>
+  multiset(InputIt first, InputIt last);
+  multiset(const multiset &other)
+      : BinaryTree<key_type, key_type, Compare, NodeAllocator>(other){};
   multiset(multiset &&other) noexcept
-      : BinaryTree<key_type, key_type>(std::move(other)){};
+      : BinaryTree<key_type, key_type, Compare, NodeAllocator>(
+            std::move(other)){};
   ~multiset() = default;
 
+  // Узлы other забираются, если их может освобождать свой распределитель,
+  // иначе элементы перемещаются по одному (см. BinaryTree::operator=)
+  multiset &operator=(multiset &&other) noexcept(
+      NodeAllocator::kMoveAssignNodes) {
+    BinaryTree<key_type, key_type, Compare, NodeAllocator>::operator=(
+        std::move(other));
+    return *this;
+  }
+
   iterator insert(const value_type &value);
+
+  // Переносит все элементы other, перевешивая его узлы; равные элементы
+  // other встают после имеющихся. other становится пустым
   void merge(multiset &other);
   size_type count(const key_type &key) const;
   iterator lower_bound(const Key &key);
-  Node<key_type, value_type> *lower_bound_recursive(
-      Node<key_type, key_type> *node, const key_type &key);
+  node_type *lower_bound_recursive(node_type *node, const key_type &key);
   iterator upper_bound(const Key &key);
-  Node<key_type, value_type> *upper_bound_recursive(
-      Node<key_type, key_type> *node, const key_type &key);
+  node_type *upper_bound_recursive(node_type *node, const key_type &key);
   std::pair<iterator, iterator> equal_range(const Key &key);
 
+  // Варианты поиска по ключу, сравнимому с key_type, для прозрачного
+  // компаратора (например, std::less<>)
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &key) const;
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  std::pair<iterator, iterator> equal_range(const K &key);
+
   template <class... Args>
   vector<std::pair<iterator, bool>> insert_many(Args &&...args);
 
+  // Заменяет содержимое элементами [first, last) за O(n) для
+  // отсортированного входа, иначе сначала сортирует их
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
+
  private:
-  Node<key_type, key_type> *insert(Node<key_type, key_type> *node,
-                                   const key_type &key,
-                                   const value_type &value);
-  size_type countRecursive(Node<key_type, key_type> *node,
-                           const key_type &key) const;
-  void merge(Node<key_type, key_type> *&into, Node<key_type, key_type> *from);
+  node_type *insert(node_type *node, const key_type &key);
 };
 
 }  // namespace s21
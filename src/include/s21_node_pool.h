@@ -0,0 +1,193 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_NODE_POOL_H
+#define CPP2_S21_CONTAINERS_1_S21_NODE_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Пул узлов: выделяет узлы из непрерывных блоков (slab), переиспользует
+// освобожденные узлы и отдает память целыми блоками
+template <typename NodeType>
+class NodePool {
+ public:
+  using node_type = NodeType;
+  using size_type = std::size_t;
+
+  // Можно ли освободить все узлы разом, не обходя дерево
+  static constexpr bool kBulkRelease = true;
+
+  // Перемещающее присваивание дерева всегда забирает узлы other, не
+  // выделяя памяти
+  static constexpr bool kMoveAssignNodes = true;
+
+  NodePool();
+  NodePool(const NodePool &) = delete;
+  NodePool(NodePool &&other) noexcept;
+  ~NodePool();
+  NodePool &operator=(const NodePool &) = delete;
+  NodePool &operator=(NodePool &&other) noexcept;
+
+  // Создает узел на месте из args
+  template <typename... Args>
+  node_type *create(Args &&...args);
+
+  // Разрушает узел и возвращает его память в список свободных
+  void destroy(node_type *node);
+
+  // Освобождает все блоки за O(кол-ва блоков). Деструкторы живых узлов
+  // не вызываются
+  void release();
+
+  // Забирает блоки и свободные узлы другого пула
+  void adopt(NodePool &other);
+
+  // Меняет местами содержимое
+  void swap(NodePool &other) noexcept;
+
+  // Перемещающее присваивание дерева: пул забирает блоки other вместе с
+  // его узлами, отдавая свои. Всегда возвращает true
+  bool move_assign(NodePool &other) noexcept {
+    swap(other);
+    return true;
+  }
+
+  // Возвращает пул для копии дерева: копия получает свой пустой пул
+  NodePool select_on_copy() const { return NodePool(); }
+
+  // Возвращает количество выделенных блоков
+  size_type slab_count() const;
+
+ private:
+  union Slot {
+    Slot *next;
+    alignas(node_type) unsigned char storage[sizeof(node_type)];
+  };
+
+  static constexpr size_type kFirstSlabSize = 64;
+  static constexpr size_type kMaxSlabSize = 65536;
+
+  // Шаг sizeof(Slot) кратен alignof(Slot), а начало блока с выравниванием
+  // сверх того, что дает обычный operator new, выделяется с align_val_t
+  static constexpr bool kOverAligned =
+      alignof(Slot) > __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+  static_assert(sizeof(Slot) % alignof(Slot) == 0,
+                "slot stride breaks node alignment");
+
+  // Выделяет новый блок вдвое больше предыдущего
+  void grow();
+
+  static Slot *AllocateSlab(size_type count);
+  static void DeallocateSlab(Slot *slab);
+
+  vector<Slot *> slabs_;
+  Slot *free_list_;
+  Slot *cursor_;
+  Slot *slab_end_;
+  size_type next_slab_size_;
+};
+
+// Распределитель узлов через new/delete, без пула
+template <typename NodeType>
+class HeapNodeAllocator {
+ public:
+  using node_type = NodeType;
+
+  static constexpr bool kBulkRelease = false;
+  static constexpr bool kMoveAssignNodes = true;
+
+  template <typename... Args>
+  node_type *create(Args &&...args) {
+    return new node_type(std::forward<Args>(args)...);
+  }
+  void destroy(node_type *node) { delete node; }
+  void release() {}
+  void adopt(HeapNodeAllocator &) {}
+  void swap(HeapNodeAllocator &) noexcept {}
+  bool move_assign(HeapNodeAllocator &) noexcept { return true; }
+  HeapNodeAllocator select_on_copy() const { return HeapNodeAllocator(); }
+};
+
+// Распределитель узлов поверх стандартного Allocator (например,
+// std::pmr::polymorphic_allocator): узлы выделяются по одному
+// перепривязанным распределителем. Узлы переходят между деревьями
+// (merge, swap без propagate_on_container_swap) только при равных
+// распределителях
+template <typename NodeType, typename Allocator>
+class AllocatorNodeAdapter {
+ public:
+  using node_type = NodeType;
+  using allocator_type =
+      typename std::allocator_traits<Allocator>::template rebind_alloc<
+          NodeType>;
+
+  static constexpr bool kBulkRelease = false;
+  static constexpr bool kMoveAssignNodes =
+      std::allocator_traits<allocator_type>::
+          propagate_on_container_move_assignment::value ||
+      std::allocator_traits<allocator_type>::is_always_equal::value;
+
+  AllocatorNodeAdapter() = default;
+
+  // Принимает все, из чего создается распределитель, например указатель
+  // на std::pmr::memory_resource
+  template <typename A, typename = std::enable_if_t<std::is_constructible<
+                            allocator_type, const A &>::value>>
+  AllocatorNodeAdapter(const A &alloc) : alloc_(alloc) {}
+
+  template <typename... Args>
+  node_type *create(Args &&...args) {
+    node_type *node = Traits::allocate(alloc_, 1);
+    try {
+      Traits::construct(alloc_, node, std::forward<Args>(args)...);
+    } catch (...) {
+      Traits::deallocate(alloc_, node, 1);
+      throw;
+    }
+    return node;
+  }
+  void destroy(node_type *node) {
+    Traits::destroy(alloc_, node);
+    Traits::deallocate(alloc_, node, 1);
+  }
+  void release() {}
+  void adopt(AllocatorNodeAdapter &) {}
+  void swap(AllocatorNodeAdapter &other) noexcept {
+    if constexpr (Traits::propagate_on_container_swap::value) {
+      std::swap(alloc_, other.alloc_);
+    }
+  }
+
+  // Узлы other можно освобождать этим распределителем, если он
+  // распространяется при перемещении (тогда он заменяется копией
+  // распределителя other) или равен распределителю other
+  bool move_assign(AllocatorNodeAdapter &other) noexcept {
+    if constexpr (Traits::propagate_on_container_move_assignment::value) {
+      alloc_ = other.alloc_;
+      return true;
+    } else {
+      return alloc_ == other.alloc_;
+    }
+  }
+  AllocatorNodeAdapter select_on_copy() const {
+    return AllocatorNodeAdapter(
+        Traits::select_on_container_copy_construction(alloc_));
+  }
+
+  // Возвращает копию распределителя
+  allocator_type get_allocator() const { return alloc_; }
+
+ private:
+  using Traits = std::allocator_traits<allocator_type>;
+
+  [[no_unique_address]] allocator_type alloc_;
+};
+}  // namespace s21
+
+#include "../files/s21_node_pool.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_NODE_POOL_H
@@ -0,0 +1,54 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_PMR_H
+#define CPP2_S21_CONTAINERS_1_S21_PMR_H
+
+#include <functional>
+#include <memory_resource>
+
+#include "s21_list.h"
+#include "s21_map.h"
+#include "s21_multiset.h"
+#include "s21_queue.h"
+#include "s21_ring_buffer.h"
+#include "s21_set.h"
+#include "s21_stack.h"
+#include "s21_vector.h"
+
+namespace s21 {
+// Контейнеры, выделяющие память из std::pmr::memory_resource: ресурс
+// передается в конструктор, например s21::pmr::vector<int> v(&arena).
+// Как и у std::pmr, распределитель не распространяется при присваивании
+// и обмене, а копия, созданная без распределителя, получает ресурс по
+// умолчанию
+namespace pmr {
+template <typename T>
+using vector = s21::vector<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename T>
+using list = s21::list<T, std::pmr::polymorphic_allocator<T>>;
+
+template <typename T>
+using ring_buffer = s21::ring_buffer<T, std::pmr::polymorphic_allocator<T>>;
+
+// Узлы деревьев выделяются по одному из ресурса вместо пула NodePool
+template <typename NodeType>
+using NodeAllocator =
+    AllocatorNodeAdapter<NodeType, std::pmr::polymorphic_allocator<NodeType>>;
+
+template <typename Key, typename T, typename Compare = std::less<Key>>
+using map = s21::map<Key, T, Compare, NodeAllocator<Node<Key, T>>>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using set = s21::set<Key, Compare, NodeAllocator<Node<Key, void>>>;
+
+template <typename Key, typename Compare = std::less<Key>>
+using multiset = s21::multiset<Key, Compare, NodeAllocator<Node<Key, void>>>;
+
+template <typename T>
+using stack = s21::stack<T, pmr::vector<T>>;
+
+template <typename T>
+using queue = s21::queue<T, pmr::ring_buffer<T>>;
+}  // namespace pmr
+}  // namespace s21
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_PMR_H
@@ -2,11 +2,16 @@
 #define CPP2_S21_CONTAINERS_1_S21_QUEUE_H
 
 #include <iostream>
+#include <memory>
+#include <type_traits>
 
 #include "s21_list.h"
+#include "s21_ring_buffer.h"
 
 namespace s21 {
-template <typename T, typename Container = s21::list<T>>
+// По умолчанию элементы лежат в кольцевом буфере: push и pop не выделяют
+// память на каждый элемент. Подойдет и s21::list
+template <typename T, typename Container = s21::ring_buffer<T>>
 class queue {
  public:
   using value_type = T;
@@ -24,6 +29,22 @@ class queue {
   queue(std::initializer_list<value_type> const &items);
   queue(const queue &q);
   queue(queue &&q);
+
+  // Передают alloc хранилищу; доступны, если Container принимает Alloc
+  // (std::uses_allocator), например s21::pmr::queue и указатель на
+  // std::pmr::memory_resource
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  explicit queue(const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  queue(std::initializer_list<value_type> const &items, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  queue(const queue &other, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  queue(queue &&other, const Alloc &alloc);
   ~queue();
   queue &operator=(queue &&q);
 
@@ -47,6 +68,11 @@ class queue {
 
   // Добавляет элемент в конец
   void push(const_reference value);
+  void push(value_type &&value);
+
+  // Создает элемент в конце на месте из args
+  template <typename... Args>
+  void emplace(Args &&...args);
 
   // Возвращает последний элемент
   void pop();
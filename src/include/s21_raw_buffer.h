@@ -0,0 +1,44 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_RAW_BUFFER_H
+#define CPP2_S21_CONTAINERS_1_S21_RAW_BUFFER_H
+
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <type_traits>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace s21 {
+// Можно ли перенести объект копированием его байтов: копия становится
+// новым объектом, а старый больше не разрушается. Верно для тривиально
+// копируемых типов. Тип, который не хранит указателей на самого себя
+// (например, std::unique_ptr), можно отметить специализацией
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Сырые буферы для переносимых побайтово элементов. Небольшие буферы
+// берутся у malloc и растут через realloc, который может расширить блок
+// на месте. На Linux буферы от kRawMapBytes отображаются mmap и растут
+// через mremap: страницы переназначаются без копирования данных
+constexpr std::size_t kRawMapBytes = std::size_t(64) << 20;
+
+// Выделяет bytes байт; при нехватке памяти бросает std::bad_alloc
+inline void *RawAllocate(std::size_t bytes);
+
+// Переносит буфер в блок из new_bytes байт, сохраняя первые
+// min(old_bytes, new_bytes) байт. При ошибке бросает std::bad_alloc, и
+// старый буфер остается нетронутым
+inline void *RawReallocate(void *data, std::size_t old_bytes,
+                           std::size_t new_bytes);
+
+// Освобождает буфер, выделенный на bytes байт
+inline void RawDeallocate(void *data, std::size_t bytes);
+}  // namespace s21
+
+#include "../files/s21_raw_buffer.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_RAW_BUFFER_H
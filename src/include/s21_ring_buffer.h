@@ -0,0 +1,124 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_RING_BUFFER_H
+#define CPP2_S21_CONTAINERS_1_S21_RING_BUFFER_H
+
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace s21 {
+// Кольцевой буфер в одном непрерывном блоке памяти: элементы добавляются
+// в конец и забираются из начала без выделения памяти на каждый элемент.
+// Емкость - степень двойки, и позиция в кольце вычисляется маской. Когда
+// буфер заполнен, емкость удваивается, а элементы переносятся в новый
+// блок по порядку, начиная с нулевой ячейки. Память выделяет Allocator,
+// как у s21::vector
+template <typename T, typename Allocator = std::allocator<T>>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using reference = T &;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using allocator_type = Allocator;
+
+  // Емкость при первом выделении памяти
+  static constexpr size_type kMinCapacity = 8;
+
+  ring_buffer();
+  explicit ring_buffer(const Allocator &alloc);
+  ring_buffer(std::initializer_list<value_type> const &items,
+              const Allocator &alloc = Allocator());
+  ring_buffer(const ring_buffer &other);
+  ring_buffer(const ring_buffer &other, const Allocator &alloc);
+  ring_buffer(ring_buffer &&other) noexcept;
+  ring_buffer(ring_buffer &&other, const Allocator &alloc);
+  ~ring_buffer();
+  ring_buffer &operator=(const ring_buffer &other);
+  ring_buffer &operator=(ring_buffer &&other) noexcept(kNoexceptMoveAssign);
+
+  // Возвращает копию распределителя
+  allocator_type get_allocator() const;
+
+  // Доступ к первому и последнему элементам
+  reference front();
+  const_reference front() const;
+  reference back();
+  const_reference back() const;
+
+  // Доступ к элементу по номеру от начала
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  reference at(size_type pos);
+
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  size_type capacity() const;
+
+  // Готовит место хотя бы для size элементов
+  void reserve(size_type size);
+
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+
+  // Создает элемент в конце на месте из args
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+
+  // Удаляет первый элемент
+  void pop_front();
+
+  void clear();
+
+  // Распределители меняются местами, только если
+  // propagate_on_container_swap; иначе они должны быть равны
+  void swap(ring_buffer &other) noexcept;
+
+  // Добавляет новые элементы в конец контейнера; при росте все они
+  // создаются до переноса, поэтому args могут ссылаться на элементы буфера
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  // Перемещающее присваивание не бросает исключений, если может забрать
+  // блок без поэлементного переноса
+  static constexpr bool kNoexceptMoveAssign =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+  T *Slot(size_type pos) const;
+
+  // Переносит элементы в новый блок емкостью capacity (степень двойки).
+  // Сначала build создает gap новых элементов на местах после size_
+  // (или не создает ничего и бросает исключение): их аргументы могут
+  // ссылаться на элементы самого буфера
+  template <typename Build>
+  void Reallocate(size_type capacity, size_type gap, Build build);
+
+  // Емкость для хотя бы size элементов: степень двойки от текущей
+  size_type GrowCapacity(size_type size) const;
+
+  T *Allocate(size_type capacity);
+  void Deallocate(T *data, size_type capacity);
+
+  // Освобождает блок и забирает блок other, оставляя other пустым
+  void Steal(ring_buffer &other) noexcept;
+
+  // Пустой распределитель не занимает места в объекте
+  [[no_unique_address]] Allocator alloc_;
+  T *data_;
+  size_type capacity_;
+  size_type head_;
+  size_type size_;
+};
+}  // namespace s21
+
+#include "../files/s21_ring_buffer.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_RING_BUFFER_H
@@ -6,34 +6,82 @@
 
 namespace s21 {
 
-template <typename Key>
-class set : public BinaryTree<Key, Key> {
+template <typename Key, typename Compare = std::less<Key>,
+          typename NodeAllocator = NodePool<Node<Key, void>>>
+class set : public BinaryTree<Key, Key, Compare, NodeAllocator> {
  public:
   using key_type = Key;
   using value_type = Key;
   using reference = value_type &;
   using const_reference = const Key &;
-  using iterator = typename BinaryTree<Key, Key>::Iterator;
-  using const_iterator = typename BinaryTree<Key, Key>::ConstIterator;
+  using iterator =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::Iterator;
+  using const_iterator =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::ConstIterator;
+  using reverse_iterator =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::ReverseIterator;
+  using node_type =
+      typename BinaryTree<Key, Key, Compare, NodeAllocator>::node_type;
   using size_type = size_t;
 
-  set() : BinaryTree<key_type, key_type>(){};
+  set() : BinaryTree<key_type, key_type, Compare, NodeAllocator>(){};
   set(std::initializer_list<value_type> const &items);
-  set(const set &other) : BinaryTree<key_type, key_type>(other){};
+
+  // Узлы выделяет копия alloc, например AllocatorNodeAdapter над
+  // std::pmr::polymorphic_allocator
+  explicit set(const NodeAllocator &alloc)
+      : BinaryTree<key_type, key_type, Compare, NodeAllocator>(alloc) {}
+  set(std::initializer_list<value_type> const &items,
+      const NodeAllocator &alloc);
+  template <typename InputIt>
+  set(InputIt first, InputIt last);
+  set(const set &other)
+      : BinaryTree<key_type, key_type, Compare, NodeAllocator>(other){};
   set(set &&other) noexcept
-      : BinaryTree<key_type, key_type>(std::move(other)){};
+      : BinaryTree<key_type, key_type, Compare, NodeAllocator>(
+            std::move(other)){};
   set &operator=(const set &other);
-  set &operator=(set &&other) noexcept;
+  set &operator=(set &&other) noexcept(NodeAllocator::kMoveAssignNodes);
   ~set() = default;
 
   size_type count(const key_type &key);
   iterator lower_bound(const key_type &key);
   iterator upper_bound(const key_type &key);
+
+  // Варианты поиска по ключу, сравнимому с key_type, для прозрачного
+  // компаратора (например, std::less<>)
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  size_type count(const K &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator lower_bound(const K &key);
+  template <typename K, typename C = Compare,
+            typename = typename C::is_transparent>
+  iterator upper_bound(const K &key);
   value_type extract(const key_type &key);
 
   // Объявление метода insert_many
   template <typename... Args>
   vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Создает элемент из args прямо в узле и вставляет узел за один спуск;
+  // если такой элемент уже есть, узел разрушается
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // То же, что emplace, с подсказкой: элемент встает перед hint. Если
+  // hint указывает на равный элемент или новый ключ лежит между hint и
+  // его предшественником (например, возрастающие ключи перед end()),
+  // спуск от корня не выполняется
+  template <typename... Args>
+  iterator emplace_hint(iterator hint, Args &&...args);
+
+  // Заменяет содержимое элементами [first, last). Отсортированный вход
+  // укладывается в сбалансированное дерево за O(n), иначе сначала
+  // сортируется. Повторы отбрасываются
+  template <typename InputIt>
+  void assign_sorted(InputIt first, InputIt last);
 };
 
 }  // namespace s21
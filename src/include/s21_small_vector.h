@@ -0,0 +1,143 @@
+#ifndef CPP2_S21_CONTAINERS_1_SMALL_VECTOR_H
+#define CPP2_S21_CONTAINERS_1_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+// Динамический массив с буфером на N элементов внутри объекта. Пока
+// элементов не больше N, память не выделяется; при переполнении
+// элементы переезжают в кучу, и дальше массив растет как s21::vector.
+// shrink_to_fit возвращает короткий массив во встроенный буфер.
+// Перемещение массива из кучи забирает буфер, а из встроенного буфера
+// переносит не больше N элементов
+template <typename T, std::size_t N>
+class small_vector {
+  static_assert(N > 0, "small_vector needs room for at least one element");
+
+ public:
+  // типы
+  using value_type = T;
+  using size_type = std::size_t;
+  using reference = T &;
+  using const_reference = const T &;
+  using iterator = T *;
+  using const_iterator = const T *;
+
+  // Количество элементов во встроенном буфере
+  static constexpr size_type kInlineCapacity = N;
+
+  // Перемещение из встроенного буфера переносит элементы по одному
+  static constexpr bool kNoexceptMove =
+      std::is_nothrow_move_constructible<T>::value;
+
+  // конструкторы
+  small_vector() noexcept;
+  small_vector(size_type n);
+  small_vector(std::initializer_list<value_type> const &items);
+  small_vector(const small_vector &other);
+  small_vector(small_vector &&other) noexcept(kNoexceptMove);
+  ~small_vector();
+  small_vector &operator=(const small_vector &other);
+  small_vector &operator=(small_vector &&other) noexcept(kNoexceptMove);
+
+  // доступ
+  reference at(size_type pos);
+  reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
+  const_reference front();
+  const_reference back();
+  iterator data();
+  const_iterator data() const;
+
+  // итератор
+  iterator begin();
+  iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
+
+  // Вместимость
+  bool empty() const;
+  size_type size() const;
+  size_type max_size() const;
+  void reserve(size_type size);
+  size_type capacity() const;
+
+  // Освобождает лишнюю память; если элементы помещаются во встроенный
+  // буфер, они возвращаются в него
+  void shrink_to_fit();
+
+  // Лежат ли элементы во встроенном буфере
+  bool is_inline() const;
+
+  // модификаторы
+
+  // Разрушает элементы, сохраняя емкость
+  void clear();
+  iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
+  void erase(iterator pos);
+  void push_back(const_reference value);
+  void push_back(value_type &&value);
+
+  // Создают элемент на месте из args; args могут ссылаться на элементы
+  // самого массива
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
+  void pop_back();
+  void resize(size_type new_size);
+  void swap(small_vector &other) noexcept(kNoexceptMove);
+
+  // Вставляют элементы, созданные на месте из args, с одним сдвигом
+  // хвоста. insert_many возвращает итератор за последним вставленным
+  template <typename... Args>
+  iterator insert_many(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  void insert_many_back(Args &&...args);
+
+ private:
+  // Переносит элементы в буфер емкостью capacity (встроенный, если
+  // capacity <= N), оставляя перед index место под gap элементов,
+  // которые сначала создает build. Так же устроен s21::vector
+  template <typename Build>
+  void Reallocate(size_type capacity, size_type index, size_type gap,
+                  Build build);
+
+  // Емкость для хотя бы size элементов: не меньше удвоенной текущей
+  size_type GrowCapacity(size_type size) const;
+
+  // Создает по элементу из каждого args в data[0, sizeof...(args))
+  template <typename... Args>
+  static void ConstructEach(value_type *data, Args &&...args);
+
+  // Забирает элементы other: буфер из кучи - целиком, элементы из
+  // встроенного буфера - перемещением. Массив должен быть пуст и без
+  // памяти в куче; other остается пустым
+  void TakeFrom(small_vector &other) noexcept(kNoexceptMove);
+
+  // Разрушает элементы и освобождает память в куче
+  void Release();
+
+  value_type *InlineData() const;
+  static value_type *Allocate(size_type capacity);
+  static void Deallocate(value_type *data, size_type capacity);
+
+  value_type *elems;
+  size_type a_size;
+  size_type c_size;
+  alignas(T) unsigned char buffer[N * sizeof(T)];
+};
+}  // namespace s21
+
+#include "../files/s21_small_vector.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_SMALL_VECTOR_H
@@ -1,6 +1,9 @@
 #ifndef CPP2_S21_CONTAINERS_1_STACK_H
 #define CPP2_S21_CONTAINERS_1_STACK_H
 
+#include <memory>
+#include <type_traits>
+
 #include "s21_vector.h"
 
 namespace s21 {
@@ -17,6 +20,22 @@ class stack {
   stack(std::initializer_list<value_type> const &items);
   stack(const stack &stc);
   stack(stack &&stc);
+
+  // Передают alloc хранилищу; доступны, если Container принимает Alloc
+  // (std::uses_allocator), например s21::pmr::stack и указатель на
+  // std::pmr::memory_resource
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  explicit stack(const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  stack(std::initializer_list<value_type> const &items, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  stack(const stack &other, const Alloc &alloc);
+  template <typename Alloc, typename = std::enable_if_t<
+                                std::uses_allocator<Container, Alloc>::value>>
+  stack(stack &&other, const Alloc &alloc);
   ~stack();
   stack &operator=(stack &&stc);
 
@@ -29,6 +48,11 @@ class stack {
 
   // модификаторы
   void push(const_reference value);
+  void push(value_type &&value);
+
+  // Создает элемент на вершине на месте из args
+  template <typename... Args>
+  void emplace(Args &&...args);
   void pop();
   void swap(stack &other);
 
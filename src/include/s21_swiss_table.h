@@ -0,0 +1,236 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_SWISS_TABLE_H
+#define CPP2_S21_CONTAINERS_1_S21_SWISS_TABLE_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <limits>
+#include <new>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+#include "s21_vector.h"
+
+namespace s21 {
+// Байты управления ячейками. Занятая ячейка хранит младшие 7 бит хеша
+// (H2) и неотрицательна; свободная и удаленная отрицательны
+constexpr int8_t kSwissEmpty = -128;
+constexpr int8_t kSwissDeleted = -2;
+
+// Число ячеек в группе: байты управления группы читаются одной
+// инструкцией SSE2
+constexpr std::size_t kSwissGroupWidth = 16;
+
+// Группа из kSwissGroupWidth байтов управления. Методы возвращают маску,
+// в которой бит i установлен для подходящей ячейки i группы
+class SwissGroup {
+ public:
+  explicit SwissGroup(const int8_t *ctrl);
+
+  // Занятые ячейки с данным H2
+  uint32_t Match(int8_t h2) const;
+
+  // Свободные ячейки
+  uint32_t MatchEmpty() const;
+
+  // Свободные и удаленные ячейки
+  uint32_t MatchEmptyOrDeleted() const;
+
+ private:
+#if defined(__SSE2__)
+  __m128i ctrl_;
+#else
+  const int8_t *ctrl_;
+#endif
+};
+
+// Хеш-таблица с открытой адресацией в духе Swiss table. Ячейки разбиты на
+// группы по 16; рядом с массивом ячеек лежит массив байтов управления,
+// по которому проба проверяет целую группу за несколько инструкций и
+// сравнивает ключи только у ячеек с совпавшими 7 битами хеша. Группы
+// перебираются квадратичной пробой. T = void задает таблицу одних ключей
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class SwissTable {
+ public:
+  class Iterator;
+
+  using key_type = Key;
+  using value_type = std::conditional_t<std::is_void<T>::value, Key, T>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using size_type = size_t;
+  using iterator = Iterator;
+  using hasher = Hash;
+  using key_equal = KeyEqual;
+
+  SwissTable();
+  SwissTable(const SwissTable &other);
+  SwissTable(SwissTable &&other) noexcept;
+  ~SwissTable();
+  SwissTable &operator=(const SwissTable &other);
+  SwissTable &operator=(SwissTable &&other) noexcept;
+
+  // Ищет элемент с ключом key
+  iterator find(const key_type &key) const;
+
+  // Проверяет, содержится ли элемент с заданным ключом
+  bool contains(const key_type &key) const;
+
+  // Возвращает 1, если элемент есть, иначе 0
+  size_type count(const key_type &key) const;
+
+  // Проверяет контейнер на пустоту
+  bool empty() const;
+
+  // Возвращает кол-во элементов
+  size_type size() const;
+
+  // Возвращает максимально возможное количество элементов
+  size_type max_size() const;
+
+  // Стирает элемент в позиции. Остальные элементы не перемещаются, и
+  // итераторы на них остаются действительными
+  void erase(iterator pos);
+
+  // Стирает элемент с ключом key, если он есть
+  bool erase(const key_type &key);
+
+  // Меняет местами содержимое
+  void swap(SwissTable &other);
+
+  // Очищает содержимое, оставляя выделенные ячейки
+  void clear();
+
+  // Возвращает итератор к началу
+  iterator begin() const;
+
+  // Возвращает итератор к концу
+  iterator end() const;
+
+  // Возвращает число ячеек
+  size_type bucket_count() const;
+
+  // Возвращает отношение числа элементов к числу ячеек
+  float load_factor() const;
+
+  // Возвращает и задает долю ячеек, после заполнения которой таблица
+  // растет. Доля ограничивается сверху так, чтобы одна ячейка всегда
+  // оставалась свободной
+  float max_load_factor() const;
+  void max_load_factor(float ml);
+
+  // Перестраивает таблицу не менее чем на count ячеек и на все
+  // элементы; удаленные ячейки при этом освобождаются
+  void rehash(size_type count);
+
+  // Готовит место под count элементов без роста таблицы
+  void reserve(size_type count);
+
+  // Возвращает хеш-функцию и предикат равенства ключей
+  hasher hash_function() const;
+  key_equal key_eq() const;
+
+  class Iterator {
+   private:
+    const SwissTable *iter_table;
+    size_type iter_index;
+
+   public:
+    friend class SwissTable;
+
+    using iterator_category = std::forward_iterator_tag;
+    using difference_type = std::ptrdiff_t;
+
+    Iterator() : iter_table(nullptr), iter_index(0) {}
+    Iterator(const SwissTable *table, size_type index)
+        : iter_table(table), iter_index(index) {}
+
+    iterator operator++(int);
+    iterator &operator++();
+    bool operator==(const iterator &other) const;
+    bool operator!=(const iterator &other) const;
+    const_reference operator*() const;
+    const key_type &first() const;
+    reference second() const;
+  };
+
+ protected:
+  static constexpr bool kKeyOnly = std::is_void<T>::value;
+
+  // Элемент ячейки: у множества - ключ, у словаря - пара ключ-значение
+  using slot_value_type =
+      std::conditional_t<kKeyOnly, Key, std::pair<Key, value_type>>;
+
+  // Ячейка - сырая память под элемент; сконструирована, только если ее
+  // байт управления неотрицателен
+  union Slot {
+    Slot() {}
+    ~Slot() {}
+    slot_value_type value;
+  };
+
+  // Ищет key и, если его нет, создает элемент на месте из args
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> EmplaceUnique(K &&key, Args &&...args);
+
+  // Переносит элементы other с ключами, которых еще нет; остальные
+  // остаются в other
+  void Merge(SwissTable &other);
+
+  // Возвращает значение элемента; у множества значением служит ключ
+  reference Value(size_type i) const;
+
+  Hash hash_;
+  KeyEqual eq_;
+
+ private:
+  // Перемешивает биты хеша: std::hash для целых - тождественная функция
+  static size_t Mix(size_t hash);
+
+  // Индекс ячейки с ключом key или capacity_
+  size_type FindIndex(const key_type &key, size_t hash) const;
+
+  // Первая свободная или удаленная ячейка на пути пробы hash
+  size_type FindInsertIndex(size_t hash) const;
+
+  // Сколько элементов помещается в cap ячеек при текущей max_load_
+  size_type GrowthLimit(size_type cap) const;
+
+  // Перестраивает таблицу на cap ячеек (степень двойки или 0)
+  void Resize(size_type cap);
+
+  // Освобождает место под еще один элемент: вдвое увеличивает таблицу
+  // или, если в ней много удаленных ячеек, перестраивает ее того же
+  // размера
+  void Grow();
+
+  const key_type &SlotKey(size_type i) const;
+
+  static void DestroySlot(Slot &slot);
+
+  // Уничтожает элементы и освобождает массивы
+  void Release();
+
+  int8_t *ctrl_;
+  Slot *slots_;
+  size_type capacity_;
+  size_type size_;
+  // Сколько свободных ячеек еще можно занять до роста таблицы
+  size_type growth_left_;
+  float max_load_;
+};
+}  // namespace s21
+
+#include "../files/s21_swiss_table.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_SWISS_TABLE_H
@@ -0,0 +1,72 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
+#define CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
+
+#include "s21_swiss_table.h"
+
+namespace s21 {
+// Неупорядоченный ассоциативный массив на хеш-таблице с открытой
+// адресацией. Поиск стоит O(1) в среднем вместо O(log n) сравнений в
+// s21::map. Вставка может перестроить таблицу и сделать итераторы
+// недействительными; удаление других элементов их не трогает
+template <typename Key, typename T, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_map : public SwissTable<Key, T, Hash, KeyEqual> {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<const key_type, mapped_type>;
+  using reference = value_type &;
+  using const_reference = const value_type &;
+  using iterator = typename SwissTable<Key, T, Hash, KeyEqual>::Iterator;
+  using size_type = size_t;
+
+  unordered_map() : SwissTable<Key, T, Hash, KeyEqual>(){};
+  unordered_map(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  unordered_map(InputIt first, InputIt last);
+  unordered_map(const unordered_map &other)
+      : SwissTable<Key, T, Hash, KeyEqual>(other){};
+  unordered_map(unordered_map &&other) noexcept
+      : SwissTable<Key, T, Hash, KeyEqual>(std::move(other)){};
+  unordered_map &operator=(const unordered_map &other) = default;
+  unordered_map &operator=(unordered_map &&other) noexcept = default;
+  ~unordered_map() = default;
+
+  // Дает доступ к указанному элементу с проверкой границ
+  mapped_type &at(const key_type &key);
+
+  // Дает доступ или вставляет указанный элемент
+  mapped_type &operator[](const key_type &key);
+
+  // Вставляет элемент, если ключа еще нет
+  std::pair<iterator, bool> insert(const value_type &value);
+
+  // Вставляет элемент или присваивает текущему элементу, если ключ уже
+  // существует
+  std::pair<iterator, bool> insert_or_assign(const key_type &key,
+                                             const mapped_type &obj);
+
+  // Создает элемент на месте из args, если ключа еще нет
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // Если ключа нет, создает значение на месте из args; иначе ничего не
+  // делает и не трогает args
+  template <typename K, typename... Args>
+  std::pair<iterator, bool> try_emplace(K &&key, Args &&...args);
+
+  // Вставляет новые элементы в контейнер. Возвращаемые итераторы
+  // действительны после всех вставок
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Переносит элементы other с ключами, которых еще нет; остальные
+  // остаются в other
+  void merge(unordered_map &other);
+};
+
+}  // namespace s21
+
+#include "../files/s21_unordered_map.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_UNORDERED_MAP_H
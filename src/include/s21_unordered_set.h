@@ -0,0 +1,53 @@
+#ifndef CPP2_S21_CONTAINERS_1_S21_UNORDERED_SET_H
+#define CPP2_S21_CONTAINERS_1_S21_UNORDERED_SET_H
+
+#include "s21_swiss_table.h"
+
+namespace s21 {
+// Неупорядоченное множество на хеш-таблице с открытой адресацией.
+// Вставка может перестроить таблицу и сделать итераторы
+// недействительными; удаление других элементов их не трогает
+template <typename Key, typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class unordered_set : public SwissTable<Key, void, Hash, KeyEqual> {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type &;
+  using const_reference = const Key &;
+  using iterator = typename SwissTable<Key, void, Hash, KeyEqual>::Iterator;
+  using size_type = size_t;
+
+  unordered_set() : SwissTable<Key, void, Hash, KeyEqual>(){};
+  unordered_set(std::initializer_list<value_type> const &items);
+  template <typename InputIt>
+  unordered_set(InputIt first, InputIt last);
+  unordered_set(const unordered_set &other)
+      : SwissTable<Key, void, Hash, KeyEqual>(other){};
+  unordered_set(unordered_set &&other) noexcept
+      : SwissTable<Key, void, Hash, KeyEqual>(std::move(other)){};
+  unordered_set &operator=(const unordered_set &other) = default;
+  unordered_set &operator=(unordered_set &&other) noexcept = default;
+  ~unordered_set() = default;
+
+  // Вставляет элемент, если его еще нет
+  std::pair<iterator, bool> insert(const value_type &value);
+
+  // Создает элемент на месте из args и вставляет его
+  template <typename... Args>
+  std::pair<iterator, bool> emplace(Args &&...args);
+
+  // Вставляет новые элементы в контейнер. Возвращаемые итераторы
+  // действительны после всех вставок
+  template <typename... Args>
+  vector<std::pair<iterator, bool>> insert_many(Args &&...args);
+
+  // Переносит элементы other, которых еще нет; остальные остаются в other
+  void merge(unordered_set &other);
+};
+
+}  // namespace s21
+
+#include "../files/s21_unordered_set.cpp"
+
+#endif  // CPP2_S21_CONTAINERS_1_S21_UNORDERED_SET_H
@@ -1,16 +1,36 @@
 #ifndef CPP2_S21_CONTAINERS_1_VECTOR_H
 #define CPP2_S21_CONTAINERS_1_VECTOR_H
 
+#include <algorithm>
 #include <exception>
+#include <functional>
+#include <initializer_list>
 #include <iostream>
+#include <iterator>
 #include <limits>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_raw_buffer.h"
 
 namespace s21 {
-template <typename T>
+// Динамический массив. Память выделяется без создания элементов: в
+// буфере емкостью c_size живут только первые a_size элементов, остальное
+// место сырое. При росте элементы переносятся перемещением, если оно не
+// бросает исключений, иначе копируются. Память выделяет Allocator через
+// std::allocator_traits; при копировании, перемещении и обмене он
+// распространяется по правилам propagate_on_container_*. Элементы,
+// переносимые побайтово (is_trivially_relocatable), сдвигаются memmove,
+// а их буфер при std::allocator растет через realloc и mremap
+template <typename T, typename Allocator = std::allocator<T>>
 class vector {
  public:
   // типы
   using value_type = T;
+  using allocator_type = Allocator;
   using size_type = std::size_t;
   using reference = T &;
   using const_reference = const T &;
@@ -18,25 +38,36 @@ class vector {
   using const_iterator = const T *;
 
   // конструкторы
-  vector();
-  vector(size_type n);
-  vector(std::initializer_list<value_type> const &items);
+  vector() noexcept(noexcept(Allocator()));
+  explicit vector(const Allocator &alloc) noexcept;
+  vector(size_type n, const Allocator &alloc = Allocator());
+  vector(std::initializer_list<value_type> const &items,
+         const Allocator &alloc = Allocator());
   vector(const vector &val);
-  vector(vector &&val);
+  vector(const vector &val, const Allocator &alloc);
+  vector(vector &&val) noexcept;
+  vector(vector &&val, const Allocator &alloc);
   ~vector();
   vector &operator=(const vector &other);
-  vector &operator=(vector &&other) noexcept;
+  vector &operator=(vector &&other) noexcept(kNoexceptMoveAssign);
+
+  // Возвращает копию распределителя
+  allocator_type get_allocator() const;
 
   // доступ
   reference at(size_type pos);
   reference operator[](size_type pos);
+  const_reference operator[](size_type pos) const;
   const_reference front();
   const_reference back();
   iterator data();
+  const_iterator data() const;
 
   // итератор
   iterator begin();
   iterator end();
+  const_iterator begin() const;
+  const_iterator end() const;
 
   // Вместимость
   bool empty() const;
@@ -48,24 +79,166 @@ class vector {
 
   // модификаторы
 
+  // Разрушает элементы, сохраняя емкость
   void clear();
   iterator insert(iterator pos, const_reference value);
+  iterator insert(iterator pos, value_type &&value);
   void erase(iterator pos);
+
+  // Удаляет [first, last), сдвигая хвост один раз, и возвращает итератор
+  // на элемент, следовавший за удаленными
+  iterator erase(iterator first, iterator last);
+
+  // Вставляет копии [first, last) перед pos и возвращает итератор на
+  // первый вставленный. Для прямых итераторов место выделяется и хвост
+  // сдвигается один раз; однопроходный диапазон дописывается в конец и
+  // встает на место одним поворотом. [first, last) не указывает в вектор
+  template <typename InputIt,
+            typename = std::enable_if_t<std::is_base_of_v<
+                std::input_iterator_tag,
+                typename std::iterator_traits<InputIt>::iterator_category>>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last);
+
+  // Заменяют содержимое копиями [first, last) или items. Существующие
+  // элементы переприсваиваются; для прямых итераторов буфер выделяется,
+  // только если не хватает емкости, и сразу точного размера
+  template <typename InputIt,
+            typename = std::enable_if_t<std::is_base_of_v<
+                std::input_iterator_tag,
+                typename std::iterator_traits<InputIt>::iterator_category>>>
+  void assign(InputIt first, InputIt last);
+  void assign(std::initializer_list<value_type> items);
+
+  // Дописывает в конец элементы range - любого контейнера с begin и end
+  template <typename Range>
+  void append_range(const Range &range);
+
+  // Удаляет элементы, для которых pred истинен, одним проходом
+  // (оставшиеся сдвигаются не больше одного раза) и возвращает их число
+  template <typename Pred>
+  size_type remove_if(Pred pred);
+
   void push_back(const_reference value);
+  void push_back(value_type &&value);
+
+  // Создают элемент на месте из args; args могут ссылаться на элементы
+  // самого вектора
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args);
+  template <typename... Args>
+  reference emplace_back(Args &&...args);
   void pop_back();
   void resize(size_type new_size);
-  void swap(vector &other);
 
+  // Распределители меняются местами, только если
+  // propagate_on_container_swap; иначе они должны быть равны
+  void swap(vector &other) noexcept;
+
+  // Вставляют элементы, созданные на месте из args: место выделяется и
+  // хвост сдвигается один раз на все элементы. insert_many возвращает
+  // итератор за последним вставленным элементом
   template <typename... Args>
   iterator insert_many(const_iterator pos, Args &&...args);
   template <typename... Args>
   void insert_many_back(Args &&...args);
 
  private:
+  using AllocTraits = std::allocator_traits<Allocator>;
+
+  // Перемещающее присваивание не бросает исключений, если может забрать
+  // буфер без поэлементного переноса
+  static constexpr bool kNoexceptMoveAssign =
+      AllocTraits::propagate_on_container_move_assignment::value ||
+      AllocTraits::is_always_equal::value;
+
+  // Элементы переносятся копированием байтов: хвост сдвигается memmove,
+  // а при росте буфера элементы не перемещаются по одному
+  static constexpr bool kRelocatable = is_trivially_relocatable<T>::value;
+
+  // Буфер выделяет RawAllocate, и он растет через RawReallocate. Только
+  // для std::allocator: память других распределителей так не растет
+  static constexpr bool kRawStorage =
+      kRelocatable && std::is_same<Allocator, std::allocator<T>>::value &&
+      alignof(T) <= alignof(std::max_align_t);
+
+  // Диапазон можно пройти дважды: его длина известна до вставки
+  template <typename It>
+  static constexpr bool kForward = std::is_base_of_v<
+      std::forward_iterator_tag,
+      typename std::iterator_traits<It>::iterator_category>;
+
+  // Сколько байт новых элементов Relocate создает на стеке, а не в куче
+  static constexpr size_type kScratchBytes = 256;
+
+  // Переносит элементы в новый буфер емкостью capacity, оставляя перед
+  // позицией index место под gap элементов. Сначала build создает эти
+  // элементы в новом буфере (или не создает ничего и бросает
+  // исключение), поэтому они могут ссылаться на элементы самого вектора
+  template <typename Build>
+  void Reallocate(size_type capacity, size_type index, size_type gap,
+                  Build build);
+
+  // Reallocate для kRelocatable: build создает элементы во временном
+  // буфере, старые элементы переезжают копированием байтов (при
+  // kRawStorage - вместе с буфером через RawReallocate), и новые
+  // элементы копируются в промежуток
+  template <typename Build>
+  void Relocate(size_type capacity, size_type index, size_type gap,
+                Build build);
+
+  // Вставка диапазона с ростом для kRelocatable: элементы создаются
+  // прямо в промежутке нового буфера, без временного буфера Relocate.
+  // Буфер растет через RawReallocate, только если диапазон не ссылается
+  // на элементы вектора
+  template <typename ForwardIt>
+  void RelocateRange(size_type capacity, size_type index, ForwardIt first,
+                     ForwardIt last, size_type count);
+
+  // Элемент *first лежит в буфере вектора
+  template <typename ForwardIt>
+  bool Aliases(ForwardIt first) const;
+
+  // Переносит n элементов копированием байтов; области могут
+  // перекрываться
+  static void MoveBytes(value_type *to, const value_type *from, size_type n);
+
+  // Емкость для хотя бы size элементов: не меньше удвоенной текущей
+  size_type GrowCapacity(size_type size) const;
+
+  // Создает по элементу из каждого args в data[0, sizeof...(args)); если
+  // конструктор бросает исключение, созданные элементы разрушаются
+  template <typename... Args>
+  void ConstructEach(value_type *data, Args &&...args);
+
+  // Создает в data копии [first, last) или n элементов по умолчанию; при
+  // исключении созданные элементы разрушаются
+  template <typename InputIt>
+  void ConstructRange(value_type *data, InputIt first, InputIt last);
+  void ConstructDefault(value_type *data, size_type n);
+
+  // Создает и разрушает элементы через распределитель
+  template <typename... Args>
+  void Construct(value_type *data, Args &&...args);
+  void Destroy(value_type *first, value_type *last);
+
+  value_type *Allocate(size_type capacity);
+  void Deallocate(value_type *data, size_type capacity);
+
+  // Освобождает буфер и забирает буфер other, оставляя other пустым
+  void Steal(vector &other) noexcept;
+
+  // Объявлен первым: конструкторы выделяют им буфер в списке
+  // инициализации. Пустой распределитель не занимает места в объекте
+  [[no_unique_address]] allocator_type alloc;
   value_type *elems;
   size_type a_size;
   size_type c_size;
 };
+
+// Удаляет из vec элементы, для которых pred истинен, как std::erase_if
+template <typename T, typename Allocator, typename Pred>
+typename vector<T, Allocator>::size_type erase_if(vector<T, Allocator> &vec,
+                                                  Pred pred);
 }  // namespace s21
 
 #include "../files/s21_vector.cpp"
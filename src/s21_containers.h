@@ -6,6 +6,8 @@
 #include "include/s21_queue.h"
 #include "include/s21_set.h"
 #include "include/s21_stack.h"
+#include "include/s21_unordered_map.h"
+#include "include/s21_unordered_set.h"
 #include "include/s21_vector.h"
 
 #endif  // S21_CONTAINERS_H_
\ No newline at end of file
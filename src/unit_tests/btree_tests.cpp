@@ -0,0 +1,160 @@
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+
+#include "../include/s21_btree_map.h"
+#include "../include/s21_btree_multiset.h"
+#include "../include/s21_btree_set.h"
+#include "gtest/gtest.h"
+
+TEST(BTreeTest, NodeFitsTargetSize) {
+  using Node = s21::BTreeNode<long long, void>;
+  EXPECT_LE(sizeof(Node), s21::kBTreeNodeBytes);
+  EXPECT_GE(Node::kSlots, 16UL);
+}
+
+TEST(BTreeTest, MapBasicOperations) {
+  s21::btree_map<int, std::string> map = {{2, "two"}, {1, "one"}};
+  EXPECT_EQ(map.size(), 2UL);
+  EXPECT_EQ(map.at(1), "one");
+  EXPECT_THROW(map.at(3), std::out_of_range);
+
+  map[3] = "three";
+  EXPECT_FALSE(map.insert({3, "other"}).second);
+  EXPECT_EQ(map.insert_or_assign(3, "drei").first.second(), "drei");
+  EXPECT_TRUE(map.emplace(4, "four").second);
+  EXPECT_EQ(*map.lower_bound(0), "one");
+  EXPECT_EQ(map.upper_bound(4), map.end());
+  EXPECT_TRUE(map.erase(2));
+  EXPECT_FALSE(map.contains(2));
+
+  auto results = map.insert_many(std::make_pair(5, std::string("five")),
+                                 std::make_pair(1, std::string("uno")));
+  EXPECT_TRUE(results[0].second);
+  EXPECT_EQ(results[0].first.first(), 5);
+  EXPECT_FALSE(results[1].second);
+  EXPECT_EQ(*results[1].first, "one");
+  EXPECT_TRUE(map.IsValid());
+}
+
+TEST(BTreeTest, MapMatchesStdMap) {
+  std::mt19937 rng(7);
+  s21::btree_map<int, int> map;
+  std::map<int, int> map_std;
+  for (int step = 0; step < 20000; ++step) {
+    int key = static_cast<int>(rng() % 3000);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(map.erase(key), map_std.erase(key) == 1);
+    } else {
+      ASSERT_EQ(map.insert({key, step}).second,
+                map_std.insert({key, step}).second);
+    }
+  }
+  ASSERT_TRUE(map.IsValid());
+  ASSERT_EQ(map.size(), map_std.size());
+
+  auto it = map.begin();
+  for (const auto &item : map_std) {
+    ASSERT_EQ(it.first(), item.first);
+    ASSERT_EQ(*it, item.second);
+    ++it;
+  }
+  ASSERT_EQ(it, map.end());
+  for (auto rit = map_std.rbegin(); rit != map_std.rend(); ++rit) {
+    --it;
+    ASSERT_EQ(it.first(), rit->first);
+  }
+  ASSERT_EQ(it, map.begin());
+}
+
+TEST(BTreeTest, EraseDrainsTree) {
+  s21::btree_set<int> set;
+  for (int i = 0; i < 5000; ++i) set.insert(i * 7 % 5000);
+  while (!set.empty()) {
+    set.erase(set.begin());
+    ASSERT_TRUE(set.IsValid());
+  }
+  EXPECT_EQ(set.begin(), set.end());
+}
+
+namespace {
+// Крупный ключ: в узел помещается всего три элемента, и даже небольшое
+// дерево получается глубоким
+struct WideKey {
+  int value;
+  char padding[124];
+  WideKey(int v = 0) : value(v), padding() {}
+  bool operator<(const WideKey &other) const { return value < other.value; }
+};
+}  // namespace
+
+TEST(BTreeTest, SmallNodesMatchStdSet) {
+  ASSERT_EQ(s21::btree_set<WideKey>::kNodeSlots, 3UL);
+  std::mt19937 rng(3);
+  s21::btree_set<WideKey> set;
+  std::set<int> set_std;
+  for (int step = 0; step < 5000; ++step) {
+    int key = static_cast<int>(rng() % 400);
+    if (rng() % 2 == 0) {
+      ASSERT_EQ(set.erase(key), set_std.erase(key) == 1);
+    } else {
+      ASSERT_EQ(set.insert(key).second, set_std.insert(key).second);
+    }
+    ASSERT_TRUE(set.IsValid());
+  }
+  auto it = set.begin();
+  for (int key : set_std) ASSERT_EQ((*it++).value, key);
+  ASSERT_EQ(it, set.end());
+}
+
+TEST(BTreeTest, SetCopyMoveAndMerge) {
+  s21::btree_set<std::string> set;
+  for (int i = 0; i < 500; ++i) set.insert(std::to_string(i));
+  s21::btree_set<std::string> copy(set);
+  copy.erase("42");
+  EXPECT_TRUE(set.contains("42"));
+  EXPECT_EQ(copy.count("42"), 0UL);
+
+  s21::btree_set<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 499UL);
+
+  s21::btree_set<std::string> other = {"42", "43", "1000"};
+  moved.merge(other);
+  EXPECT_EQ(moved.size(), 501UL);
+  EXPECT_EQ(other.size(), 1UL);
+  EXPECT_TRUE(other.contains("43"));
+  EXPECT_TRUE(moved.IsValid());
+  EXPECT_TRUE(other.IsValid());
+}
+
+TEST(BTreeTest, MultisetMatchesStdMultiset) {
+  std::mt19937 rng(11);
+  s21::btree_multiset<int> multiset;
+  std::multiset<int> multiset_std;
+  for (int step = 0; step < 10000; ++step) {
+    int key = static_cast<int>(rng() % 200);
+    if (rng() % 4 == 0) {
+      auto it = multiset_std.find(key);
+      ASSERT_EQ(multiset.erase(key), it != multiset_std.end());
+      if (it != multiset_std.end()) multiset_std.erase(it);
+    } else {
+      multiset.insert(key);
+      multiset_std.insert(key);
+    }
+  }
+  ASSERT_TRUE(multiset.IsValid());
+  ASSERT_EQ(multiset.size(), multiset_std.size());
+  for (int key = 0; key < 200; ++key) {
+    ASSERT_EQ(multiset.count(key), multiset_std.count(key));
+  }
+
+  s21::btree_multiset<int> other = {5, 5, 500};
+  multiset.merge(other);
+  EXPECT_TRUE(other.empty());
+  EXPECT_EQ(multiset.count(5), multiset_std.count(5) + 2);
+  auto range = multiset.equal_range(500);
+  EXPECT_EQ(*range.first, 500);
+  EXPECT_EQ(++range.first, range.second);
+}
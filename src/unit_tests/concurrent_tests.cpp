@@ -0,0 +1,244 @@
+#include <atomic>
+#include <map>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../include/s21_concurrent_map.h"
+#include "../include/s21_concurrent_queue.h"
+#include "gtest/gtest.h"
+
+TEST(ConcurrentMapTest, BasicOperations) {
+  s21::concurrent_map<std::string, int> map = {{"one", 1}, {"two", 2}};
+  EXPECT_EQ(map.size(), 2UL);
+  EXPECT_TRUE(map.contains("one"));
+  EXPECT_FALSE(map.contains("three"));
+
+  int value = 0;
+  EXPECT_TRUE(map.find("two", value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(map.insert("two", 20));
+  EXPECT_TRUE(map.find("two", value));
+  EXPECT_EQ(value, 2);
+  EXPECT_FALSE(map.insert_or_assign("two", 22));
+  EXPECT_TRUE(map.find("two", value));
+  EXPECT_EQ(value, 22);
+  EXPECT_TRUE(map.insert_or_assign("three", 3));
+
+  EXPECT_TRUE(map.erase("one"));
+  EXPECT_FALSE(map.erase("one"));
+  EXPECT_FALSE(map.find("one", value));
+  EXPECT_EQ(map.size(), 2UL);
+  EXPECT_TRUE(map.IsValid());
+}
+
+TEST(ConcurrentMapTest, MatchesStdMap) {
+  std::mt19937 rng(14);
+  s21::concurrent_map<int, int> map;
+  std::map<int, int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(rng() % 2000);
+    switch (rng() % 3) {
+      case 0:
+        EXPECT_EQ(map.insert(key, i), expected.insert({key, i}).second);
+        break;
+      case 1:
+        EXPECT_EQ(map.insert_or_assign(key, i),
+                  expected.insert_or_assign(key, i).second);
+        break;
+      default:
+        EXPECT_EQ(map.erase(key), expected.erase(key) == 1);
+    }
+  }
+  EXPECT_EQ(map.size(), expected.size());
+  EXPECT_TRUE(map.IsValid());
+
+  auto it = expected.begin();
+  map.for_each([&](int key, int value) {
+    ASSERT_NE(it, expected.end());
+    EXPECT_EQ(key, it->first);
+    EXPECT_EQ(value, it->second);
+    ++it;
+  });
+  EXPECT_EQ(it, expected.end());
+}
+
+TEST(ConcurrentMapTest, ConcurrentWritersOnOverlappingKeys) {
+  const int kThreads = 4;
+  const int kKeys = 4000;
+  s21::concurrent_map<int, int> map;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, t] {
+      std::mt19937 rng(t);
+      for (int i = 0; i < 50000; ++i) {
+        int key = static_cast<int>(rng() % kKeys);
+        if (rng() % 2) {
+          map.insert_or_assign(key, key);
+        } else {
+          map.erase(key);
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+  EXPECT_TRUE(map.IsValid());
+
+  // Затем каждый поток дописывает свою четверть ключей
+  threads.clear();
+  for (int t = 0; t < kThreads; ++t) {
+    threads.emplace_back([&map, t] {
+      for (int key = t; key < kKeys; key += kThreads) map.insert(key, key);
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  EXPECT_EQ(map.size(), static_cast<size_t>(kKeys));
+  EXPECT_TRUE(map.IsValid());
+  for (int key = 0; key < kKeys; ++key) {
+    int value = -1;
+    EXPECT_TRUE(map.find(key, value));
+    EXPECT_EQ(value, key);
+  }
+}
+
+TEST(ConcurrentMapTest, ReadersSeeStableKeysDuringWrites) {
+  const int kStable = 1000;
+  s21::concurrent_map<int, int> map;
+  // Четные ключи не меняются, нечетные вставляются и стираются писателями
+  for (int key = 0; key < 2 * kStable; key += 2) map.insert(key, key);
+
+  std::atomic<bool> stop(false);
+  std::atomic<int> misses(0);
+  std::vector<std::thread> readers;
+  for (int t = 0; t < 2; ++t) {
+    readers.emplace_back([&] {
+      while (!stop.load()) {
+        for (int key = 0; key < 2 * kStable; key += 2) {
+          int value = -1;
+          if (!map.find(key, value) || value != key) ++misses;
+        }
+      }
+    });
+  }
+  std::vector<std::thread> writers;
+  for (int t = 0; t < 2; ++t) {
+    writers.emplace_back([&map, t] {
+      std::mt19937 rng(100 + t);
+      for (int i = 0; i < 50000; ++i) {
+        int key = 2 * static_cast<int>(rng() % kStable) + 1;
+        if (rng() % 2) {
+          map.insert(key, key);
+        } else {
+          map.erase(key);
+        }
+      }
+    });
+  }
+  for (std::thread &writer : writers) writer.join();
+  stop.store(true);
+  for (std::thread &reader : readers) reader.join();
+
+  EXPECT_EQ(misses.load(), 0);
+  EXPECT_TRUE(map.IsValid());
+}
+
+TEST(ConcurrentQueueTest, BasicOperations) {
+  s21::concurrent_queue<std::string> queue(3);
+  EXPECT_EQ(queue.capacity(), 4UL);
+  EXPECT_TRUE(queue.empty());
+
+  std::string value;
+  EXPECT_FALSE(queue.try_pop(value));
+  queue.insert_many_back("a", "b");
+  queue.push("c");
+  EXPECT_TRUE(queue.try_push(std::string("d")));
+  EXPECT_FALSE(queue.try_push("e"));
+  EXPECT_EQ(queue.size(), 4UL);
+
+  queue.pop(value);
+  EXPECT_EQ(value, "a");
+  EXPECT_TRUE(queue.try_push("e"));
+  for (const char *expected : {"b", "c", "d", "e"}) {
+    EXPECT_TRUE(queue.try_pop(value));
+    EXPECT_EQ(value, expected);
+  }
+  EXPECT_TRUE(queue.empty());
+
+  // Оставшиеся элементы разрушает деструктор
+  s21::concurrent_queue<std::string> filled = {"x", "y", "z"};
+  EXPECT_EQ(filled.size(), 3UL);
+}
+
+TEST(ConcurrentQueueTest, BatchOperationsWrapAround) {
+  s21::concurrent_queue<int> queue(8);
+  int items[10] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  int out[10] = {};
+  EXPECT_EQ(queue.try_push_many(items, 5), 5UL);
+  EXPECT_EQ(queue.try_pop_many(out, 3), 3UL);
+  EXPECT_EQ(out[2], 2);
+  // Запись переходит через конец кольца и упирается в емкость
+  EXPECT_EQ(queue.try_push_many(items + 5, 10 - 5), 5UL);
+  EXPECT_EQ(queue.try_push_many(items, 10), 1UL);
+  EXPECT_EQ(queue.try_push_many(items, 10), 0UL);
+  EXPECT_EQ(queue.try_pop_many(out, 10), 8UL);
+  for (int i = 0; i < 7; ++i) EXPECT_EQ(out[i], i + 3);
+  EXPECT_EQ(out[7], 0);
+  EXPECT_EQ(queue.try_pop_many(out, 10), 0UL);
+}
+
+TEST(ConcurrentQueueTest, ProducersAndConsumers) {
+  const int kProducers = 3;
+  const int kConsumers = 3;
+  const int kItems = 30000;
+  s21::concurrent_queue<int> queue(64);
+  std::vector<std::vector<int>> received(kConsumers);
+  std::atomic<int> remaining(kProducers * kItems);
+
+  std::vector<std::thread> threads;
+  for (int p = 0; p < kProducers; ++p) {
+    threads.emplace_back([&queue, p] {
+      for (int i = 0; i < kItems; i += 2) {
+        int pair[2] = {p * kItems + i, p * kItems + i + 1};
+        if (i % 4 == 0) {
+          queue.insert_many_back(pair[0], pair[1]);
+          continue;
+        }
+        // Другая половина элементов добавляется пакетами
+        size_t pushed = 0;
+        while (pushed < 2) {
+          size_t added = queue.try_push_many(pair + pushed, 2 - pushed);
+          if (added == 0) std::this_thread::yield();
+          pushed += added;
+        }
+      }
+    });
+  }
+  for (int c = 0; c < kConsumers; ++c) {
+    threads.emplace_back([&, c] {
+      int batch[4];
+      while (remaining.load() > 0) {
+        size_t popped = queue.try_pop_many(batch, 1 + c);
+        for (size_t i = 0; i < popped; ++i) received[c].push_back(batch[i]);
+        remaining -= static_cast<int>(popped);
+        if (popped == 0) std::this_thread::yield();
+      }
+    });
+  }
+  for (std::thread &thread : threads) thread.join();
+
+  // Каждый элемент получен ровно один раз, и каждый потребитель видит
+  // элементы одного производителя в порядке добавления
+  std::vector<int> count(kProducers * kItems, 0);
+  for (const std::vector<int> &items : received) {
+    std::vector<int> last(kProducers, -1);
+    for (int item : items) {
+      ++count[item];
+      EXPECT_LT(last[item / kItems], item);
+      last[item / kItems] = item;
+    }
+  }
+  for (int c : count) EXPECT_EQ(c, 1);
+  EXPECT_TRUE(queue.empty());
+}
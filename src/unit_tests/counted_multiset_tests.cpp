@@ -0,0 +1,86 @@
+#include <iterator>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../include/s21_counted_multiset.h"
+#include "gtest/gtest.h"
+
+TEST(CountedMultisetTest, MatchesStdMultiset) {
+  std::mt19937 rng(18);
+  s21::counted_multiset<int> counted;
+  std::multiset<int> expected;
+  for (int i = 0; i < 20000; ++i) {
+    int key = static_cast<int>(rng() % 50);
+    if (rng() % 4 != 0) {
+      counted.insert(key);
+      expected.insert(key);
+    } else {
+      auto it = expected.find(key);
+      EXPECT_EQ(counted.erase(key), it != expected.end());
+      if (it != expected.end()) expected.erase(it);
+    }
+  }
+  ASSERT_EQ(counted.size(), expected.size());
+  EXPECT_LE(counted.distinct_size(), 50UL);
+  EXPECT_TRUE(std::equal(counted.begin(), counted.end(), expected.begin(),
+                         expected.end()));
+  for (int key = -1; key <= 50; ++key) {
+    EXPECT_EQ(counted.count(key), expected.count(key));
+    auto range = counted.equal_range(key);
+    EXPECT_EQ(static_cast<size_t>(std::distance(range.first, range.second)),
+              expected.count(key));
+    EXPECT_EQ(std::distance(counted.begin(), counted.lower_bound(key)),
+              std::distance(expected.begin(), expected.lower_bound(key)));
+  }
+}
+
+TEST(CountedMultisetTest, OneNodePerDistinctKey) {
+  s21::counted_multiset<std::string> counted = {"b", "a", "b", "c", "b"};
+  EXPECT_EQ(counted.size(), 5UL);
+  EXPECT_EQ(counted.distinct_size(), 3UL);
+  EXPECT_EQ(counted.count("b"), 3UL);
+
+  auto it = counted.insert("a", 1000000);
+  EXPECT_EQ(*it, "a");
+  EXPECT_EQ(counted.count("a"), 1000001UL);
+  EXPECT_EQ(counted.distinct_size(), 3UL);
+  EXPECT_EQ(counted.erase_all("a"), 1000001UL);
+  EXPECT_FALSE(counted.contains("a"));
+  EXPECT_EQ(counted.size(), 4UL);
+
+  // Итератор проходит каждую копию в обе стороны
+  std::vector<std::string> forward(counted.begin(), counted.end());
+  EXPECT_EQ(forward, (std::vector<std::string>{"b", "b", "b", "c"}));
+  auto back = counted.end();
+  --back;
+  EXPECT_EQ(*back, "c");
+  --back;
+  EXPECT_EQ(*back, "b");
+  counted.erase(back);
+  EXPECT_EQ(counted.count("b"), 2UL);
+  EXPECT_EQ(counted.find("z"), counted.end());
+}
+
+TEST(CountedMultisetTest, MergeCopyAndMove) {
+  s21::counted_multiset<int> first = {1, 1, 2};
+  s21::counted_multiset<int> second = {2, 3, 3, 3};
+  first.merge(second);
+  EXPECT_TRUE(second.empty());
+  EXPECT_EQ(first.size(), 7UL);
+  EXPECT_EQ(first.count(2), 2UL);
+  EXPECT_EQ(first.count(3), 3UL);
+
+  s21::counted_multiset<int> copy(first);
+  copy.erase(copy.begin());
+  EXPECT_EQ(copy.count(1), 1UL);
+  EXPECT_EQ(first.count(1), 2UL);
+
+  s21::counted_multiset<int> moved(std::move(copy));
+  EXPECT_EQ(moved.size(), 6UL);
+  EXPECT_TRUE(copy.empty());
+  moved.swap(copy);
+  EXPECT_EQ(copy.size(), 6UL);
+  EXPECT_TRUE(moved.empty());
+}
@@ -0,0 +1,113 @@
+#include <algorithm>
+#include <deque>
+#include <random>
+#include <string>
+
+#include "../include/s21_deque.h"
+#include "../include/s21_queue.h"
+#include "../include/s21_stack.h"
+#include "gtest/gtest.h"
+
+TEST(DequeTest, MatchesStdDeque) {
+  std::mt19937 rng(17);
+  s21::deque<std::string> deque;
+  std::deque<std::string> expected;
+  for (int i = 0; i < 20000; ++i) {
+    std::string value = std::to_string(i);
+    switch (rng() % 5) {
+      case 0:
+        deque.push_front(value);
+        expected.push_front(value);
+        break;
+      case 1:
+        deque.push_back(value);
+        expected.push_back(value);
+        break;
+      case 2:
+        deque.pop_front();
+        if (!expected.empty()) expected.pop_front();
+        break;
+      case 3:
+        deque.pop_back();
+        if (!expected.empty()) expected.pop_back();
+        break;
+      default:
+        if (!expected.empty()) {
+          size_t pos = rng() % expected.size();
+          EXPECT_EQ(deque[pos], expected[pos]);
+          EXPECT_EQ(deque.front(), expected.front());
+          EXPECT_EQ(deque.back(), expected.back());
+        }
+    }
+    ASSERT_EQ(deque.size(), expected.size());
+  }
+  EXPECT_TRUE(std::equal(deque.begin(), deque.end(), expected.begin(),
+                         expected.end()));
+}
+
+TEST(DequeTest, ReferencesSurviveEndInsertions) {
+  s21::deque<int> deque = {1, 2, 3};
+  int *middle = &deque[1];
+  int *first = &deque.front();
+  // Карта блоков перевыделяется много раз с обеих сторон
+  for (int i = 0; i < 10000; ++i) {
+    deque.push_back(i);
+    deque.push_front(-i);
+  }
+  EXPECT_EQ(middle, &deque[10001]);
+  EXPECT_EQ(*middle, 2);
+  EXPECT_EQ(first, &deque[10000]);
+  for (int i = 0; i < 9000; ++i) {
+    deque.pop_back();
+    deque.pop_front();
+  }
+  EXPECT_EQ(*middle, 2);
+  EXPECT_EQ(deque.at(1001), 2);
+  EXPECT_THROW(deque.at(2003), std::out_of_range);
+}
+
+TEST(DequeTest, IteratorsAndManyInsertions) {
+  s21::deque<int> deque;
+  EXPECT_THROW(deque.back(), std::out_of_range);
+  deque.insert_many_back(5, 6, 7);
+  deque.insert_many_front(1, 2, 3);
+  const int expected[] = {1, 2, 3, 5, 6, 7};
+  EXPECT_TRUE(std::equal(deque.begin(), deque.end(), std::begin(expected),
+                         std::end(expected)));
+
+  std::reverse(deque.begin(), deque.end());
+  std::sort(deque.begin(), deque.end());
+  EXPECT_EQ(deque.end() - deque.begin(), 6);
+  s21::deque<int>::const_iterator it = deque.begin() + 3;
+  EXPECT_EQ(*it, 5);
+  EXPECT_EQ(it[-1], 3);
+  EXPECT_TRUE(deque.begin() < it);
+
+  s21::deque<int> copy(deque);
+  s21::deque<int> moved(std::move(deque));
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(moved.size(), 6UL);
+  copy.clear();
+  copy = moved;
+  EXPECT_EQ(copy.back(), 7);
+  copy.swap(deque);
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(deque.front(), 1);
+}
+
+TEST(DequeTest, BacksStackAndQueue) {
+  s21::stack<int, s21::deque<int>> stack = {1, 2};
+  s21::queue<int, s21::deque<int>> queue = {1, 2};
+  stack.insert_many_back(3, 4);
+  queue.insert_many_back(3, 4);
+  for (int i = 4; i >= 1; --i) {
+    EXPECT_EQ(stack.top(), i);
+    stack.pop();
+  }
+  for (int i = 1; i <= 4; ++i) {
+    EXPECT_EQ(queue.front(), i);
+    queue.pop();
+  }
+  EXPECT_TRUE(stack.empty());
+  EXPECT_TRUE(queue.empty());
+}
@@ -0,0 +1,183 @@
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <string>
+
+#include "../include/s21_flat_map.h"
+#include "../include/s21_flat_set.h"
+#include "gtest/gtest.h"
+
+TEST(FlatSearchTest, MatchesStdBounds) {
+  std::mt19937 rng(5);
+  for (size_t n : {0UL, 1UL, 7UL, 16UL, 17UL, 100UL, 1000UL}) {
+    s21::vector<int> ints;
+    s21::vector<double> doubles;
+    s21::vector<std::string> strings;
+    for (size_t i = 0; i < n; ++i) {
+      ints.push_back(static_cast<int>(rng() % 200) - 100);
+      doubles.push_back(static_cast<double>(rng() % 200) / 4);
+      strings.push_back(std::to_string(rng() % 200));
+    }
+    std::sort(ints.begin(), ints.end());
+    std::sort(doubles.begin(), doubles.end());
+    std::sort(strings.begin(), strings.end());
+    std::less<int> less_int;
+    std::less<double> less_double;
+    std::less<std::string> less_string;
+    for (int probe = -110; probe <= 110; ++probe) {
+      ASSERT_EQ(s21::FlatLowerBound(ints.data(), n, probe, less_int),
+                static_cast<size_t>(
+                    std::lower_bound(ints.begin(), ints.end(), probe) -
+                    ints.begin()));
+      ASSERT_EQ(s21::FlatUpperBound(ints.data(), n, probe, less_int),
+                static_cast<size_t>(
+                    std::upper_bound(ints.begin(), ints.end(), probe) -
+                    ints.begin()));
+      double real = probe / 4.0;
+      ASSERT_EQ(s21::FlatLowerBound(doubles.data(), n, real, less_double),
+                static_cast<size_t>(
+                    std::lower_bound(doubles.begin(), doubles.end(), real) -
+                    doubles.begin()));
+      ASSERT_EQ(s21::FlatUpperBound(doubles.data(), n, real, less_double),
+                static_cast<size_t>(
+                    std::upper_bound(doubles.begin(), doubles.end(), real) -
+                    doubles.begin()));
+      std::string text = std::to_string(probe);
+      ASSERT_EQ(s21::FlatLowerBound(strings.data(), n, text, less_string),
+                static_cast<size_t>(
+                    std::lower_bound(strings.begin(), strings.end(), text) -
+                    strings.begin()));
+    }
+  }
+}
+
+TEST(FlatSetTest, BulkInsertSortsAndDeduplicates) {
+  s21::flat_set<int> set = {5, 1, 3};
+  int more[] = {4, 3, 9, 4, 0};
+  set.insert(std::begin(more), std::end(more));
+
+  int expected[] = {0, 1, 3, 4, 5, 9};
+  ASSERT_EQ(set.size(), 6UL);
+  size_t k = 0;
+  for (int value : set) EXPECT_EQ(value, expected[k++]);
+  EXPECT_EQ(*set.lower_bound(2), 3);
+  EXPECT_EQ(*set.upper_bound(5), 9);
+  EXPECT_EQ(set.upper_bound(9), set.end());
+  EXPECT_EQ(set.rank(4), 3UL);
+  EXPECT_EQ(set.count_range(1, 5), 3UL);
+}
+
+TEST(FlatSetTest, MatchesStdSet) {
+  std::mt19937 rng(9);
+  s21::flat_set<std::string> set;
+  std::set<std::string> set_std;
+  for (int step = 0; step < 3000; ++step) {
+    std::string key = std::to_string(rng() % 500);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(set.erase(key), set_std.erase(key) == 1);
+    } else {
+      ASSERT_EQ(set.insert(key).second, set_std.insert(key).second);
+    }
+  }
+  ASSERT_EQ(set.size(), set_std.size());
+  ASSERT_TRUE(std::equal(set.begin(), set.end(), set_std.begin()));
+
+  s21::flat_set<std::string> other = {"1", "new", "zzz"};
+  set.merge(other);
+  EXPECT_TRUE(set.contains("new"));
+  EXPECT_EQ(other.size(), set_std.count("1") + set_std.count("zzz"));
+}
+
+TEST(FlatMapTest, BasicOperations) {
+  s21::flat_map<std::string, int, std::less<>> map = {
+      {"b", 2}, {"a", 1}, {"b", 20}};
+  EXPECT_EQ(map.size(), 2UL);
+  EXPECT_EQ(map.at("b"), 2);
+  EXPECT_THROW(map.at("z"), std::out_of_range);
+  EXPECT_TRUE(map.contains("a"));
+
+  map["c"] = 3;
+  EXPECT_FALSE(map.insert({"c", 30}).second);
+  EXPECT_EQ(map.insert_or_assign("c", 33).first.second(), 33);
+  EXPECT_TRUE(map.emplace("d", 4).second);
+  EXPECT_EQ(map.lower_bound("bb").first(), "c");
+  EXPECT_TRUE(map.erase("a"));
+  EXPECT_EQ(map.begin().first(), "b");
+
+  std::pair<std::string, int> items[] = {{"e", 5}, {"b", 0}, {"f", 6}};
+  map.insert(std::begin(items), std::end(items));
+  const char *keys[] = {"b", "c", "d", "e", "f"};
+  int values[] = {2, 33, 4, 5, 6};
+  size_t k = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++k) {
+    EXPECT_EQ(it.first(), keys[k]);
+    EXPECT_EQ(*it, values[k]);
+  }
+  EXPECT_EQ(k, 5UL);
+}
+
+TEST(FlatMapTest, MatchesStdMap) {
+  std::mt19937 rng(13);
+  s21::flat_map<int, int> map;
+  std::map<int, int> map_std;
+  for (int step = 0; step < 3000; ++step) {
+    int key = static_cast<int>(rng() % 700);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(map.erase(key), map_std.erase(key) == 1);
+    } else {
+      ASSERT_EQ(map.try_emplace(key, step).second,
+                map_std.emplace(key, step).second);
+    }
+  }
+  ASSERT_EQ(map.size(), map_std.size());
+  auto it = map.begin();
+  for (const auto &item : map_std) {
+    ASSERT_EQ(it.first(), item.first);
+    ASSERT_EQ(*it++, item.second);
+  }
+
+  s21::flat_map<int, int> other = {{1, -1}, {1000, -2}};
+  map.merge(other);
+  EXPECT_EQ(map.at(1000), -2);
+  EXPECT_EQ(other.size(), map_std.count(1));
+}
+
+namespace {
+// Значение, конструктор которого бросает исключение на отрицательном
+// аргументе
+struct Checked {
+  int value;
+  explicit Checked(int v = 0) : value(v) {
+    if (v < 0) throw std::invalid_argument("negative");
+  }
+};
+}  // namespace
+
+TEST(FlatMapTest, MoveOnlyValuesAndFailedInsert) {
+  s21::flat_map<int, std::unique_ptr<int>> map;
+  EXPECT_TRUE(map.try_emplace(2, std::make_unique<int>(20)).second);
+  EXPECT_TRUE(map.emplace(1, std::make_unique<int>(10)).second);
+  map[3] = std::make_unique<int>(30);
+  EXPECT_FALSE(map.try_emplace(2, std::make_unique<int>(-1)).second);
+  ASSERT_EQ(map.size(), 3UL);
+  EXPECT_EQ(*map.at(1), 10);
+  EXPECT_EQ(*map.at(2), 20);
+  EXPECT_EQ(*map.at(3), 30);
+
+  // Значение не создалось: ключ не остается в массиве ключей
+  s21::flat_map<int, Checked> checked;
+  checked.try_emplace(1, 1);
+  checked.try_emplace(3, 3);
+  EXPECT_THROW(checked.try_emplace(2, -2), std::invalid_argument);
+  ASSERT_EQ(checked.size(), 2UL);
+  EXPECT_FALSE(checked.contains(2));
+  EXPECT_EQ(checked.at(3).value, 3);
+  checked.try_emplace(2, 2);
+  int expected = 1;
+  for (auto it = checked.begin(); it != checked.end(); ++it, ++expected) {
+    EXPECT_EQ(it.first(), expected);
+    EXPECT_EQ((*it).value, expected);
+  }
+}
@@ -0,0 +1,95 @@
+#include <map>
+#include <random>
+#include <set>
+#include <string>
+
+#include "../include/s21_map.h"
+#include "../include/s21_multiset.h"
+#include "../include/s21_set.h"
+#include "gtest/gtest.h"
+
+TEST(FrozenTest, SetMatchesStdSet) {
+  std::mt19937 rng(5);
+  // Размеры вокруг степеней двойки дают и полные, и неполные уровни
+  for (int n : {0, 1, 2, 3, 7, 8, 9, 100, 1023, 1024, 3000}) {
+    s21::set<int> set;
+    std::set<int> set_std;
+    for (int i = 0; i < n; ++i) {
+      int key = static_cast<int>(rng() % 10000);
+      set.insert(key);
+      set_std.insert(key);
+    }
+    s21::frozen_set<int> frozen = set.freeze();
+    ASSERT_EQ(frozen.size(), set_std.size());
+
+    auto it = frozen.begin();
+    for (int key : set_std) ASSERT_EQ(*it++, key);
+    ASSERT_EQ(it, frozen.end());
+    for (auto rit = set_std.rbegin(); rit != set_std.rend(); ++rit) {
+      ASSERT_EQ(*--it, *rit);
+    }
+    ASSERT_EQ(it, frozen.begin());
+
+    for (int key = -1; key <= 10001; key += 7) {
+      ASSERT_EQ(frozen.contains(key), set_std.count(key) == 1);
+      auto lower = set_std.lower_bound(key);
+      auto upper = set_std.upper_bound(key);
+      if (lower == set_std.end()) {
+        ASSERT_EQ(frozen.lower_bound(key), frozen.end());
+      } else {
+        ASSERT_EQ(*frozen.lower_bound(key), *lower);
+      }
+      if (upper == set_std.end()) {
+        ASSERT_EQ(frozen.upper_bound(key), frozen.end());
+      } else {
+        ASSERT_EQ(*frozen.upper_bound(key), *upper);
+      }
+    }
+  }
+}
+
+TEST(FrozenTest, MapLookupAndIndependence) {
+  s21::map<std::string, int> map = {{"b", 2}, {"a", 1}, {"c", 3}};
+  s21::frozen_map<std::string, int> frozen = map.freeze();
+  map.erase("a");
+  map["d"] = 4;
+
+  EXPECT_EQ(frozen.size(), 3UL);
+  EXPECT_EQ(frozen.at("a"), 1);
+  EXPECT_THROW(frozen.at("d"), std::out_of_range);
+  auto it = frozen.find("b");
+  EXPECT_EQ(it.first(), "b");
+  EXPECT_EQ(*it, 2);
+  EXPECT_EQ(frozen.find("z"), frozen.end());
+  EXPECT_THROW(*frozen.end(), std::out_of_range);
+
+  // Копия живет в своем буфере и ищет так же, как оригинал
+  s21::frozen_map<std::string, int> copy(frozen);
+  s21::frozen_map<std::string, int> moved(std::move(frozen));
+  EXPECT_TRUE(frozen.empty());
+  EXPECT_EQ(copy.at("c"), 3);
+  EXPECT_EQ(moved.at("c"), 3);
+}
+
+TEST(FrozenTest, MultisetKeepsDuplicates) {
+  s21::multiset<int> multiset = {5, 1, 5, 3, 5, 1};
+  s21::frozen_set<int> frozen = multiset.freeze();
+  EXPECT_EQ(frozen.size(), 6UL);
+  EXPECT_EQ(frozen.count(5), 3UL);
+  EXPECT_EQ(frozen.count(1), 2UL);
+  EXPECT_EQ(frozen.count(4), 0UL);
+  EXPECT_EQ(*frozen.upper_bound(1), 3);
+}
+
+TEST(FrozenTest, CopiesOfSmallKeysStayAligned) {
+  s21::set<char> set;
+  for (char c = 'a'; c <= 'z'; ++c) set.insert(c);
+  s21::frozen_set<char> frozen = set.freeze();
+  for (int round = 0; round < 8; ++round) {
+    s21::frozen_set<char> copy(frozen);
+    frozen = copy;
+    ASSERT_TRUE(frozen.contains('q'));
+    ASSERT_EQ(*frozen.begin(), 'a');
+    ASSERT_EQ(*--frozen.end(), 'z');
+  }
+}
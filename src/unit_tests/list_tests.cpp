@@ -1,3 +1,6 @@
+#include <memory>
+#include <string>
+
 #include "../include/s21_list.h"
 #include "gtest/gtest.h"
 
@@ -330,3 +333,26 @@ TEST(ListTest, InsertManyFront) {
     my_list.pop_back();
   }
 }
+
+TEST(ListTest, MoveOnlyAndEmplace) {
+  s21::list<std::unique_ptr<std::string>> my_list;
+  my_list.push_back(std::make_unique<std::string>("b"));
+  my_list.emplace_front(new std::string("a"));
+  *my_list.emplace_back(new std::string("d")) += "!";
+  // Вставка перед end() добавляет в конец
+  my_list.emplace(my_list.end(), new std::string("e"));
+  auto it = my_list.begin();
+  ++it;
+  ++it;
+  my_list.insert(it, std::make_unique<std::string>("c"));
+  my_list.insert_many_back(std::make_unique<std::string>("f"));
+  my_list.insert_many_front(std::make_unique<std::string>("0"),
+                            std::make_unique<std::string>("1"));
+
+  std::string joined;
+  for (auto cur = my_list.begin(); cur != my_list.end(); ++cur) {
+    joined += **cur;
+  }
+  EXPECT_EQ(joined, "01abcd!ef");
+  EXPECT_EQ(my_list.size(), 8UL);
+}
@@ -1,4 +1,8 @@
 #include <map>
+#include <random>
+#include <string>
+#include <string_view>
+#include <tuple>
 
 #include "../include/s21_map.h"
 #include "gtest/gtest.h"
@@ -575,3 +579,284 @@ TEST(MapTest, InsertManyEmpty) {
   ASSERT_TRUE(result.empty());
   ASSERT_TRUE(customMap.empty());
 }
+
+TEST(MapTest, OrderStatistics) {
+  s21::map<int, int> map;
+  for (int i = 10; i >= 1; --i) map.insert(std::make_pair(i * 10, i));
+
+  EXPECT_EQ(map.size(), 10UL);
+  EXPECT_EQ(*map.nth(0), 1);
+  EXPECT_EQ(*map.nth(4), 5);
+  EXPECT_EQ(*map.nth(9), 10);
+  EXPECT_EQ(map.nth(10), map.end());
+
+  EXPECT_EQ(map.rank(10), 0UL);
+  EXPECT_EQ(map.rank(55), 5UL);
+  EXPECT_EQ(map.rank(1000), 10UL);
+
+  EXPECT_EQ(map.count_range(20, 60), 4UL);
+  EXPECT_EQ(map.count_range(60, 20), 0UL);
+
+  map.erase(50);
+  EXPECT_EQ(map.size(), 9UL);
+  EXPECT_EQ(*map.nth(4), 6);
+  EXPECT_EQ(map.count_range(20, 60), 3UL);
+}
+
+TEST(MapTest, TryEmplace) {
+  s21::map<int, std::string> map;
+  auto first = map.try_emplace(1, 3, 'a');
+  EXPECT_TRUE(first.second);
+  EXPECT_EQ(first.first.second(), "aaa");
+
+  auto second = map.try_emplace(1, "bbb");
+  EXPECT_FALSE(second.second);
+  EXPECT_EQ(second.first, first.first);
+  EXPECT_EQ(map[1], "aaa");
+  EXPECT_EQ(map.size(), 1UL);
+}
+
+TEST(MapTest, EmplaceAndHint) {
+  s21::map<int, std::string> map;
+  auto result = map.emplace(2, "two");
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, "two");
+  EXPECT_FALSE(map.emplace(std::make_pair(2, "other")).second);
+
+  auto it = map.emplace_hint(result.first, 2, "ignored");
+  EXPECT_EQ(it, result.first);
+  it = map.emplace_hint(result.first, 1, "one");
+  EXPECT_EQ(*it, "one");
+  it = map.emplace_hint(map.end(), 3, "three");
+  EXPECT_EQ(*it, "three");
+  EXPECT_EQ(map.size(), 3UL);
+  EXPECT_EQ(map.at(2), "two");
+}
+
+TEST(MapTest, EmplaceBuildsInNode) {
+  struct Probe {
+    int value;
+    explicit Probe(int v = 0) : value(v) {}
+    Probe(const Probe &) { ADD_FAILURE() << "copied"; }
+    Probe(Probe &&) { ADD_FAILURE() << "moved"; }
+  };
+  s21::map<int, Probe> map;
+  EXPECT_TRUE(map.emplace(1, 10).second);
+  EXPECT_FALSE(map.emplace(1, 20).second);
+  auto it = map.emplace_hint(map.end(), 2, 30);
+  EXPECT_EQ(it.second().value, 30);
+  EXPECT_EQ(map.at(1).value, 10);
+
+  // Прочие аргументы пары собирают ее отдельно
+  s21::map<int, std::string> strings;
+  strings.emplace(std::piecewise_construct, std::forward_as_tuple(4),
+                  std::forward_as_tuple(3, 'z'));
+  EXPECT_EQ(strings.at(4), "zzz");
+}
+
+namespace {
+struct CountingKey {
+  static size_t comparisons;
+  int key;
+  CountingKey(int k = 0) : key(k) {}
+  bool operator<(const CountingKey &other) const {
+    ++comparisons;
+    return key < other.key;
+  }
+};
+size_t CountingKey::comparisons = 0;
+}  // namespace
+
+TEST(MapTest, WritesUseSingleDescent) {
+  s21::map<CountingKey, int> map;
+  for (int i = 0; i < 1000; ++i) map[i] = i;
+  size_t max_per_write = 2 * static_cast<size_t>(map.Height());
+
+  CountingKey::comparisons = 0;
+  map[500] += 1;
+  EXPECT_LE(CountingKey::comparisons, max_per_write);
+
+  CountingKey::comparisons = 0;
+  map.insert_or_assign(1000, 7);
+  EXPECT_LE(CountingKey::comparisons, max_per_write + 2);
+  EXPECT_EQ(map.at(1000), 7);
+}
+
+TEST(MapTest, HintedAppendSkipsDescent) {
+  s21::map<CountingKey, int> map;
+  CountingKey::comparisons = 0;
+  for (int i = 0; i < 1000; ++i) map.emplace_hint(map.end(), i, i);
+  // Одно сравнение с последним ключом на вставку
+  EXPECT_LE(CountingKey::comparisons, 1000UL);
+  EXPECT_TRUE(map.IsBalanced());
+  EXPECT_EQ(map.size(), 1000UL);
+
+  // Подсказка перед следующим ключом; неверная подсказка - обычный спуск
+  map.erase(map.find(500));
+  auto hint = map.find(501);
+  CountingKey::comparisons = 0;
+  auto it = map.emplace_hint(hint, 500, -1);
+  EXPECT_LE(CountingKey::comparisons, 3UL);
+  EXPECT_EQ(it.second(), -1);
+  it = map.emplace_hint(map.begin(), 2000, 5);
+  EXPECT_EQ(it.second(), 5);
+  EXPECT_EQ(map.emplace_hint(map.end(), 7, 0).second(), 7);
+  EXPECT_TRUE(map.IsBalanced());
+  EXPECT_EQ(map.size(), 1001UL);
+  int expected = 0;
+  for (auto i = map.begin(); i != map.end(); ++i, ++expected) {
+    ASSERT_EQ(i.first().key, expected == 1000 ? 2000 : expected);
+  }
+}
+
+TEST(MapTest, ReverseRangeScan) {
+  s21::map<int, std::string> map = {{1, "a"}, {5, "e"}, {3, "c"}, {4, "d"}};
+  std::string collected;
+  for (auto rit = map.rbegin(); rit != map.rend(); ++rit) collected += *rit;
+  EXPECT_EQ(collected, "edca");
+
+  auto it = map.end();
+  --it;
+  EXPECT_EQ(it.first(), 5);
+  EXPECT_EQ(it.second(), "e");
+}
+
+TEST(MapTest, RangeConstructorFromSorted) {
+  s21::vector<std::pair<int, int>> items;
+  for (int i = 0; i < 1023; ++i) items.push_back(std::make_pair(i, i * 2));
+  s21::map<int, int> map(items.begin(), items.end());
+
+  EXPECT_EQ(map.size(), 1023UL);
+  EXPECT_EQ(map.Height(), 10);
+  EXPECT_TRUE(map.IsBalanced());
+  int expected = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++expected) {
+    EXPECT_EQ(it.first(), expected);
+    EXPECT_EQ(it.second(), expected * 2);
+  }
+  EXPECT_EQ(expected, 1023);
+  EXPECT_EQ((--map.end()).first(), 1022);
+}
+
+TEST(MapTest, AssignSortedUnsortedWithDuplicates) {
+  s21::map<int, char> map = {{5, 'x'}, {1, 'y'}};
+  std::pair<int, char> items[] = {{3, 'a'}, {1, 'b'}, {3, 'c'},
+                                  {2, 'd'}, {1, 'e'}, {4, 'f'}};
+  map.assign_sorted(std::begin(items), std::end(items));
+
+  std::map<int, char> mapStd(std::begin(items), std::end(items));
+  EXPECT_EQ(map.size(), mapStd.size());
+  EXPECT_TRUE(map.IsBalanced());
+  for (const auto &item : mapStd) EXPECT_EQ(map.at(item.first), item.second);
+  EXPECT_FALSE(map.contains(5));
+
+  map.assign_sorted(std::begin(items), std::begin(items));
+  EXPECT_TRUE(map.empty());
+}
+
+TEST(MapTest, MergeRelinksAndKeepsDuplicatesInSource) {
+  std::mt19937 rng(7);
+  s21::map<int, int> map1, map2;
+  std::map<int, int> stdMap1, stdMap2;
+  for (int i = 0; i < 2000; ++i) {
+    int key = static_cast<int>(rng() % 3000);
+    map1.insert(std::make_pair(key, 1));
+    stdMap1.insert(std::make_pair(key, 1));
+    key = static_cast<int>(rng() % 3000);
+    map2.insert(std::make_pair(key, 2));
+    stdMap2.insert(std::make_pair(key, 2));
+  }
+
+  map1.merge(map2);
+  stdMap1.merge(stdMap2);
+
+  ASSERT_TRUE(map1.IsBalanced());
+  ASSERT_TRUE(map2.IsBalanced());
+  ASSERT_EQ(map1.size(), stdMap1.size());
+  ASSERT_EQ(map2.size(), stdMap2.size());
+  auto it = map1.begin();
+  for (const auto &item : stdMap1) {
+    ASSERT_EQ(it.first(), item.first);
+    ASSERT_EQ(it.second(), item.second);
+    ++it;
+  }
+  for (const auto &item : stdMap2) ASSERT_EQ(map2.at(item.first), 2);
+}
+
+TEST(MapTest, SetAlgebra) {
+  std::mt19937 rng(11);
+  for (int sizes : {0, 1, 10, 500}) {
+    s21::map<int, int> a, b;
+    std::map<int, int> stdA, stdB;
+    for (int i = 0; i < sizes * 4; ++i) {
+      int key = static_cast<int>(rng() % (sizes * 3 + 1));
+      a.insert(std::make_pair(key, 1));
+      stdA.insert(std::make_pair(key, 1));
+    }
+    for (int i = 0; i < sizes; ++i) {
+      int key = static_cast<int>(rng() % (sizes * 3 + 1));
+      b.insert(std::make_pair(key, 2));
+      stdB.insert(std::make_pair(key, 2));
+    }
+
+    s21::map<int, int> intersection(a), difference(a), other(b);
+    intersection.set_intersection(b);
+    difference.set_difference(b);
+    a.set_union(other);
+
+    ASSERT_TRUE(other.empty());
+    ASSERT_EQ(b.size(), stdB.size());
+    for (auto *result : {&a, &intersection, &difference}) {
+      ASSERT_TRUE(result->IsBalanced());
+    }
+    size_t common = 0;
+    for (const auto &item : stdB) common += stdA.count(item.first);
+    ASSERT_EQ(intersection.size(), common);
+    ASSERT_EQ(difference.size(), stdA.size() - common);
+    ASSERT_EQ(a.size(), stdA.size() + stdB.size() - common);
+    for (const auto &item : stdA) {
+      ASSERT_EQ(a.at(item.first), 1);
+      ASSERT_EQ(intersection.contains(item.first), stdB.count(item.first) > 0);
+      ASSERT_EQ(difference.contains(item.first), stdB.count(item.first) == 0);
+    }
+    for (const auto &item : stdB) ASSERT_TRUE(a.contains(item.first));
+  }
+}
+
+TEST(MapTest, TransparentLookup) {
+  s21::map<std::string, int, std::less<>> map = {
+      {"apple", 1}, {"banana", 2}, {"cherry", 3}};
+
+  EXPECT_EQ(*map.find("banana"), 2);
+  EXPECT_TRUE(map.contains(std::string_view("cherry")));
+  EXPECT_FALSE(map.contains("durian"));
+  EXPECT_EQ(map.find("durian"), map.end());
+  EXPECT_EQ(map.rank("b"), 1UL);
+}
+
+TEST(MapTest, CustomCompareOrdersDescending) {
+  s21::map<int, char, std::greater<int>> map = {
+      {1, 'a'}, {3, 'c'}, {2, 'b'}, {5, 'e'}};
+  map.erase(map.find(3));
+
+  int expected[] = {5, 2, 1};
+  size_t k = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) {
+    EXPECT_EQ(it.first(), expected[k++]);
+  }
+  EXPECT_EQ(map.rank(2), 1UL);
+  EXPECT_TRUE(map.IsBalanced());
+}
+
+TEST(MapTest, EraseKeepsOtherIterators) {
+  s21::map<int, int> map;
+  for (int i = 0; i < 64; ++i) map.try_emplace(i, i * 10);
+  auto kept = map.find(40);
+
+  for (int i = 0; i < 64; i += 3) map.erase(map.find(i));
+
+  EXPECT_EQ(*kept, 400);
+  EXPECT_EQ((++kept).first(), 41);
+  EXPECT_TRUE(map.IsBalanced());
+  EXPECT_EQ(map.size(), 42UL);
+}
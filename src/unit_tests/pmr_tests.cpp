@@ -0,0 +1,181 @@
+#include <memory_resource>
+#include <string>
+
+#include "../include/s21_pmr.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+// Ресурс, считающий выделенные и освобожденные байты
+class CountingResource : public std::pmr::memory_resource {
+ public:
+  size_t allocated = 0;
+  size_t deallocated = 0;
+
+ private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    allocated += bytes;
+    return std::pmr::new_delete_resource()->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+    deallocated += bytes;
+    std::pmr::new_delete_resource()->deallocate(ptr, bytes, alignment);
+  }
+  bool do_is_equal(const memory_resource &other) const noexcept override {
+    return this == &other;
+  }
+};
+
+// Распределитель с номером, который распространяется при копировании,
+// перемещении и обмене
+template <typename T>
+struct TaggedAllocator {
+  using value_type = T;
+  using propagate_on_container_copy_assignment = std::true_type;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  int tag;
+  explicit TaggedAllocator(int tag) : tag(tag) {}
+  template <typename U>
+  TaggedAllocator(const TaggedAllocator<U> &other) : tag(other.tag) {}
+
+  T *allocate(size_t n) { return std::allocator<T>().allocate(n); }
+  void deallocate(T *ptr, size_t n) { std::allocator<T>().deallocate(ptr, n); }
+  bool operator==(const TaggedAllocator &other) const {
+    return tag == other.tag;
+  }
+  bool operator!=(const TaggedAllocator &other) const {
+    return tag != other.tag;
+  }
+};
+
+}  // namespace
+
+TEST(PmrTest, ContainersAllocateFromResource) {
+  CountingResource counting;
+  // Ресурс по умолчанию не выдает память: все выделения идут из counting
+  std::pmr::memory_resource *previous =
+      std::pmr::set_default_resource(std::pmr::null_memory_resource());
+  {
+    s21::pmr::vector<int> vector(&counting);
+    s21::pmr::list<int> list(&counting);
+    s21::pmr::map<int, std::string> map(&counting);
+    s21::pmr::set<int> set(&counting);
+    s21::pmr::multiset<int> multiset({3, 1, 3}, &counting);
+    s21::pmr::stack<int> stack(&counting);
+    s21::pmr::queue<int> queue(&counting);
+    for (int i = 0; i < 100; ++i) {
+      vector.push_back(i);
+      list.push_back(i);
+      map.insert_or_assign(i, std::to_string(i));
+      set.insert(i % 10);
+      multiset.insert(i % 10);
+      stack.push(i);
+      queue.push(i);
+    }
+    EXPECT_EQ(vector.get_allocator().resource(), &counting);
+    EXPECT_EQ(list.get_allocator().resource(), &counting);
+    EXPECT_EQ(list.back(), 99);
+    EXPECT_EQ(map.at(42), "42");
+    EXPECT_EQ(set.size(), 10UL);
+    EXPECT_EQ(multiset.count(3), 12UL);
+    EXPECT_EQ(stack.top(), 99);
+    EXPECT_EQ(queue.front(), 0);
+    EXPECT_GT(counting.allocated, 0UL);
+  }
+  std::pmr::set_default_resource(previous);
+  EXPECT_EQ(counting.allocated, counting.deallocated);
+}
+
+TEST(PmrTest, ElementsReceiveResource) {
+  std::pmr::monotonic_buffer_resource arena;
+  s21::pmr::vector<std::pmr::string> vector(&arena);
+  vector.emplace_back("a string too long for the small buffer");
+  vector.push_back(std::pmr::string("another long string in the arena"));
+  EXPECT_EQ(vector[0].get_allocator().resource(), &arena);
+  EXPECT_EQ(vector[1].get_allocator().resource(), &arena);
+
+  s21::pmr::list<std::pmr::string> list(&arena);
+  list.emplace_back("a string too long for the small buffer");
+  EXPECT_EQ(list.front().get_allocator().resource(), &arena);
+}
+
+TEST(PmrTest, AllocatorPropagation) {
+  CountingResource first, second;
+  s21::pmr::vector<int> source({1, 2, 3}, &first);
+
+  // Копия без распределителя получает ресурс по умолчанию
+  s21::pmr::vector<int> copy(source);
+  EXPECT_EQ(copy.get_allocator().resource(),
+            std::pmr::get_default_resource());
+  s21::pmr::vector<int> same(source, &first);
+  EXPECT_EQ(same.get_allocator().resource(), &first);
+
+  // Перемещение в контейнер с другим ресурсом переносит элементы по одному
+  s21::pmr::vector<int> target(&second);
+  target = std::move(source);
+  EXPECT_EQ(target.get_allocator().resource(), &second);
+  EXPECT_EQ(target.size(), 3UL);
+  EXPECT_EQ(target[2], 3);
+  EXPECT_GT(second.allocated, 0UL);
+
+  // При равных ресурсах буфер забирается целиком
+  s21::pmr::list<int> list({1, 2, 3}, &first);
+  size_t before = first.allocated;
+  s21::pmr::list<int> moved(std::move(list), &first);
+  EXPECT_EQ(first.allocated, before);
+  EXPECT_EQ(moved.size(), 3UL);
+  EXPECT_TRUE(list.empty());
+
+  // Распространяемый распределитель переходит вместе с содержимым
+  using Tagged = s21::vector<int, TaggedAllocator<int>>;
+  Tagged left({1, 2}, TaggedAllocator<int>(1));
+  Tagged right({3}, TaggedAllocator<int>(2));
+  left.swap(right);
+  EXPECT_EQ(left.get_allocator().tag, 2);
+  EXPECT_EQ(left[0], 3);
+  left = right;
+  EXPECT_EQ(left.get_allocator().tag, 1);
+  EXPECT_EQ(left.size(), 2UL);
+  Tagged other({5}, TaggedAllocator<int>(3));
+  left = std::move(other);
+  EXPECT_EQ(left.get_allocator().tag, 3);
+  EXPECT_EQ(left[0], 5);
+}
+
+TEST(PmrTest, TreeMoveAssignmentKeepsResources) {
+  CountingResource first, second;
+  {
+    // Разные ресурсы: элементы переезжают в узлы своего ресурса
+    s21::pmr::set<int> source({1, 2, 3}, &first);
+    s21::pmr::set<int> target({9}, &second);
+    target = std::move(source);
+    EXPECT_TRUE(source.empty());
+    EXPECT_EQ(target.size(), 3UL);
+    EXPECT_TRUE(target.contains(2));
+    EXPECT_EQ(first.allocated, first.deallocated);
+
+    s21::pmr::map<int, std::string> map_source(&first);
+    map_source.insert_or_assign(1, "a string too long for the small buffer");
+    s21::pmr::map<int, std::string> map_target(&second);
+    map_target = std::move(map_source);
+    EXPECT_EQ(map_target.at(1), "a string too long for the small buffer");
+    EXPECT_TRUE(map_source.empty());
+
+    s21::pmr::multiset<int> multi_source({4, 4, 5}, &first);
+    s21::pmr::multiset<int> multi_target(&second);
+    multi_target = std::move(multi_source);
+    EXPECT_EQ(multi_target.count(4), 2UL);
+    EXPECT_EQ(first.allocated, first.deallocated);
+
+    // Равные ресурсы: узлы забираются без выделений
+    s21::pmr::set<int> same({7, 8}, &second);
+    size_t before = second.allocated;
+    target = std::move(same);
+    EXPECT_EQ(second.allocated, before);
+    EXPECT_TRUE(target.contains(8));
+  }
+  EXPECT_EQ(first.allocated, first.deallocated);
+  EXPECT_EQ(second.allocated, second.deallocated);
+}
@@ -1,3 +1,5 @@
+#include <memory>
+
 #include "../include/s21_queue.h"
 #include "gtest/gtest.h"
 
@@ -125,3 +127,20 @@ TEST(QueueTest, InsertManyBack) {
     my_queue.pop();
   }
 }
+
+TEST(QueueTest, MoveOnlyElements) {
+  s21::queue<std::unique_ptr<int>> ring;
+  s21::queue<std::unique_ptr<int>, s21::list<std::unique_ptr<int>>> linked;
+  for (int i = 0; i < 20; ++i) {
+    ring.push(std::make_unique<int>(i));
+    linked.emplace(new int(i));
+  }
+  ring.emplace(new int(20));
+  linked.insert_many_back(std::make_unique<int>(20));
+  EXPECT_EQ(*ring.back(), 20);
+  EXPECT_EQ(*linked.back(), 20);
+  ring.pop();
+  linked.pop();
+  EXPECT_EQ(*ring.front(), 1);
+  EXPECT_EQ(*linked.front(), 1);
+}
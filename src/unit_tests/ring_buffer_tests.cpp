@@ -0,0 +1,103 @@
+#include <deque>
+#include <random>
+#include <string>
+
+#include "../include/s21_queue.h"
+#include "../include/s21_ring_buffer.h"
+#include "gtest/gtest.h"
+
+TEST(RingBufferTest, GrowsWhileWrappedAround) {
+  s21::ring_buffer<std::string> buffer;
+  EXPECT_THROW(buffer.front(), std::out_of_range);
+  for (int i = 0; i < 6; ++i) buffer.push_back(std::to_string(i));
+  for (int i = 0; i < 4; ++i) buffer.pop_front();
+  // Голова сдвинута, и запись переходит через конец блока
+  for (int i = 6; i < 20; ++i) buffer.push_back(std::to_string(i));
+  EXPECT_EQ(buffer.size(), 16UL);
+  EXPECT_EQ(buffer.capacity(), 16UL);
+  for (size_t i = 0; i < buffer.size(); ++i) {
+    EXPECT_EQ(buffer[i], std::to_string(i + 4));
+  }
+  // Элемент самого буфера добавляется при заполненной емкости
+  buffer.push_back(buffer.front());
+  EXPECT_EQ(buffer.capacity(), 32UL);
+  EXPECT_EQ(buffer.back(), "4");
+  EXPECT_EQ(buffer.front(), "4");
+  EXPECT_THROW(buffer.at(17), std::out_of_range);
+}
+
+TEST(RingBufferTest, MatchesStdDeque) {
+  std::mt19937 rng(16);
+  s21::ring_buffer<int> buffer;
+  std::deque<int> expected;
+  for (int i = 0; i < 10000; ++i) {
+    if (rng() % 3 != 0) {
+      buffer.push_back(i);
+      expected.push_back(i);
+    } else if (!expected.empty()) {
+      EXPECT_EQ(buffer.front(), expected.front());
+      buffer.pop_front();
+      expected.pop_front();
+    }
+  }
+  ASSERT_EQ(buffer.size(), expected.size());
+  for (size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_EQ(buffer[i], expected[i]);
+  }
+}
+
+TEST(RingBufferTest, CopyMoveAndSwap) {
+  s21::ring_buffer<std::string> buffer = {"a", "b", "c"};
+  buffer.pop_front();
+  buffer.insert_many_back("d", "e");
+  s21::ring_buffer<std::string> copy(buffer);
+  EXPECT_EQ(copy.size(), 4UL);
+  EXPECT_EQ(copy.front(), "b");
+  EXPECT_EQ(copy.back(), "e");
+
+  s21::ring_buffer<std::string> moved(std::move(buffer));
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(moved[2], "d");
+
+  s21::ring_buffer<std::string> other = {"x"};
+  other.swap(moved);
+  EXPECT_EQ(other.size(), 4UL);
+  EXPECT_EQ(moved.front(), "x");
+  moved = copy;
+  EXPECT_EQ(moved.size(), 4UL);
+  moved.clear();
+  EXPECT_TRUE(moved.empty());
+  moved.push_back("y");
+  EXPECT_EQ(moved.front(), "y");
+}
+
+TEST(RingBufferTest, InsertsOwnElementsWhileGrowing) {
+  s21::ring_buffer<std::string> buffer;
+  buffer.push_back("first");
+  buffer.push_back("second");
+  while (buffer.size() < buffer.capacity()) buffer.push_back("filler");
+  size_t size = buffer.size();
+  // Оба аргумента ссылаются на старый блок, который освобождается при росте
+  buffer.insert_many_back(buffer[0], buffer[1]);
+  ASSERT_EQ(buffer.size(), size + 2);
+  EXPECT_GT(buffer.capacity(), size);
+  EXPECT_EQ(buffer[size], "first");
+  EXPECT_EQ(buffer[size + 1], "second");
+  // Без роста элементы не переезжают
+  buffer.insert_many_back(buffer[1], buffer.back());
+  EXPECT_EQ(buffer[size + 2], "second");
+  EXPECT_EQ(buffer.back(), "second");
+}
+
+TEST(RingBufferTest, QueueKeepsListBacking) {
+  s21::queue<int> ring = {1, 2, 3};
+  s21::queue<int, s21::list<int>> list = {1, 2, 3};
+  ring.push(4);
+  list.push(4);
+  while (!ring.empty()) {
+    EXPECT_EQ(ring.front(), list.front());
+    ring.pop();
+    list.pop();
+  }
+  EXPECT_TRUE(list.empty());
+}
@@ -599,3 +599,87 @@ TEST(MultiSetTest, InsertManyDuplicates) {
     ASSERT_TRUE(res.second);
   }
 }
+
+TEST(MultiSetTest, OrderStatistics) {
+  s21::multiset<int> multiset = {4, 1, 4, 2, 4, 7, 1};
+  std::multiset<int> multisetStd = {4, 1, 4, 2, 4, 7, 1};
+
+  ASSERT_EQ(multiset.size(), multisetStd.size());
+  size_t k = 0;
+  for (int elem : multisetStd) {
+    ASSERT_EQ(*multiset.nth(k), elem);
+    ++k;
+  }
+  ASSERT_EQ(multiset.rank(4), 3UL);
+  ASSERT_EQ(multiset.rank(5), 6UL);
+  ASSERT_EQ(multiset.count_range(4, 5), 3UL);
+  ASSERT_EQ(multiset.count_range(1, 4), 3UL);
+}
+
+TEST(MultiSetTest, RangeConstructorKeepsDuplicates) {
+  int items[] = {4, 1, 4, 2, 4, 1};
+  s21::multiset<int> multiset(std::begin(items), std::end(items));
+
+  EXPECT_EQ(multiset.size(), 6UL);
+  EXPECT_TRUE(multiset.IsBalanced());
+  EXPECT_EQ(multiset.count(4), 3UL);
+  EXPECT_EQ(multiset.count(1), 2UL);
+  EXPECT_EQ(multiset.rank(4), 3UL);
+}
+
+TEST(MultiSetTest, BoundsOnDuplicates) {
+  s21::multiset<int, std::greater<int>> multiset;
+  for (int value : {2, 7, 7, 5, 7, 1, 5}) multiset.insert(value);
+
+  auto range = multiset.equal_range(7);
+  EXPECT_EQ(range.first, multiset.begin());
+  size_t k = 0;
+  for (auto it = range.first; it != range.second; ++it, ++k) {
+    EXPECT_EQ(*it, 7);
+  }
+  EXPECT_EQ(k, 3UL);
+  EXPECT_EQ(*range.second, 5);
+  EXPECT_EQ(multiset.count(5), 2UL);
+  EXPECT_EQ(multiset.upper_bound(1), multiset.end());
+}
+
+TEST(MultiSetTest, MergeRelinksNodes) {
+  // Сравнение только по первому полю: видно, чьи равные элементы первые
+  struct ByFirst {
+    bool operator()(const std::pair<int, int> &a,
+                    const std::pair<int, int> &b) const {
+      return a.first < b.first;
+    }
+  };
+  using Multiset = s21::multiset<std::pair<int, int>, ByFirst>;
+  // Маленькое other вставляется по узлу, большое сливается списками
+  for (int other_size : {3, 3000}) {
+    Multiset multiset, other;
+    std::multiset<std::pair<int, int>, ByFirst> expected;
+    for (int i = 0; i < 2000; ++i) {
+      multiset.insert({i % 100, 0});
+      expected.insert({i % 100, 0});
+    }
+    for (int i = 0; i < other_size; ++i) {
+      other.insert({i % 150, 1});
+      expected.insert({i % 150, 1});
+    }
+    auto last = other.end();
+    --last;
+    const std::pair<int, int> *address = &*last;
+    int last_key = (*last).first;
+    multiset.merge(other);
+
+    EXPECT_TRUE(other.empty());
+    EXPECT_TRUE(multiset.IsBalanced());
+    ASSERT_EQ(multiset.size(), expected.size());
+    auto want = expected.begin();
+    for (auto it = multiset.begin(); it != multiset.end(); ++it, ++want) {
+      EXPECT_EQ(*it, *want);
+    }
+    // Последний элемент other остался тем же узлом и встал после равных
+    auto moved = multiset.upper_bound({last_key, 0});
+    --moved;
+    EXPECT_EQ(&*moved, address);
+  }
+}
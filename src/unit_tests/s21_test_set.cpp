@@ -568,3 +568,155 @@ TEST(SetTest, InsertManyTest1) {
   EXPECT_TRUE(my_set.count(4));
   EXPECT_TRUE(my_set.count(5));
 }
+
+TEST(SetTest, OrderStatistics) {
+  s21::set<int> set = {7, 3, 9, 1, 5};
+  std::set<int> std_set = {7, 3, 9, 1, 5};
+
+  size_t k = 0;
+  for (int elem : std_set) {
+    EXPECT_EQ(*set.nth(k), elem);
+    EXPECT_EQ(set.rank(elem), k);
+    ++k;
+  }
+  EXPECT_EQ(set.nth(5), set.end());
+  EXPECT_EQ(set.count_range(2, 8), 3UL);
+  EXPECT_EQ(set.count_range(0, 100), set.size());
+
+  set.extract(5);
+  EXPECT_EQ(set.count_range(2, 8), 2UL);
+  EXPECT_EQ(*set.nth(2), 7);
+}
+
+TEST(SetTest, EmplaceAndHint) {
+  s21::set<std::string> set;
+  auto result = set.emplace(3, 'x');
+  EXPECT_TRUE(result.second);
+  EXPECT_EQ(*result.first, "xxx");
+  EXPECT_FALSE(set.emplace("xxx").second);
+
+  auto it = set.emplace_hint(result.first, "xxx");
+  EXPECT_EQ(it, result.first);
+  it = set.emplace_hint(set.end(), "a");
+  EXPECT_EQ(*it, "a");
+  EXPECT_EQ(set.size(), 2UL);
+}
+
+namespace {
+// Считает копирования и перемещения
+struct Probe {
+  static int copies;
+  static int moves;
+  int value;
+  explicit Probe(int v = 0) : value(v) {}
+  Probe(const Probe &other) : value(other.value) { ++copies; }
+  Probe(Probe &&other) noexcept : value(other.value) { ++moves; }
+  Probe &operator=(const Probe &) = default;
+  Probe &operator=(Probe &&) = default;
+  bool operator<(const Probe &other) const { return value < other.value; }
+};
+int Probe::copies = 0;
+int Probe::moves = 0;
+}  // namespace
+
+TEST(SetTest, EmplaceBuildsInNode) {
+  s21::set<Probe> set;
+  set.emplace(2);
+  set.emplace(1);
+  EXPECT_FALSE(set.emplace(2).second);
+  auto it = set.emplace_hint(set.begin(), 0);
+  EXPECT_EQ((*it).value, 0);
+  EXPECT_EQ(set.size(), 3UL);
+  EXPECT_EQ(Probe::copies, 0);
+  EXPECT_EQ(Probe::moves, 0);
+}
+
+TEST(SetTest, BulkBuildCopiesEachKeyOnce) {
+  Probe::copies = 0;
+  s21::set<Probe> set = {Probe(3), Probe(1), Probe(2), Probe(1)};
+  // Ключи копируются из списка один раз, дальше только перемещаются
+  EXPECT_EQ(Probe::copies, 4);
+  EXPECT_EQ(set.size(), 3UL);
+  EXPECT_EQ((*set.begin()).value, 1);
+}
+
+TEST(SetTest, HintedAppend) {
+  s21::set<int> set;
+  for (int i = 0; i < 100; i += 2) set.emplace_hint(set.end(), i);
+  for (int i = 1; i < 100; i += 2) set.emplace_hint(set.find(i + 1), i);
+  set.emplace_hint(set.begin(), 50);
+  EXPECT_EQ(set.size(), 100UL);
+  EXPECT_TRUE(set.IsBalanced());
+  int expected = 0;
+  for (int value : set) EXPECT_EQ(value, expected++);
+}
+
+TEST(SetTest, AssignSorted) {
+  s21::set<int> set = {9, 8, 7};
+  int sorted[] = {1, 2, 2, 3, 5, 8, 8, 8, 13};
+  set.assign_sorted(std::begin(sorted), std::end(sorted));
+
+  EXPECT_EQ(set.size(), 6UL);
+  EXPECT_TRUE(set.IsBalanced());
+  EXPECT_FALSE(set.contains(9));
+  EXPECT_EQ(*set.nth(5), 13);
+
+  std::set<int> setStd = {4, 1, 3};
+  s21::set<int> from_range(setStd.begin(), setStd.end());
+  EXPECT_EQ(from_range.size(), 3UL);
+  EXPECT_EQ(*from_range.begin(), 1);
+}
+
+TEST(SetTest, SetAlgebra) {
+  s21::set<std::string> a = {"a", "b", "c", "d"};
+  s21::set<std::string> b = {"c", "d", "e"};
+
+  s21::set<std::string> intersection(a);
+  intersection.set_intersection(b);
+  ASSERT_EQ(intersection.size(), 2UL);
+  ASSERT_TRUE(intersection.contains("c"));
+
+  s21::set<std::string> difference(a);
+  difference.set_difference(b);
+  ASSERT_EQ(difference.size(), 2UL);
+  ASSERT_FALSE(difference.contains("d"));
+  difference.set_difference(difference);
+  ASSERT_TRUE(difference.empty());
+
+  a.set_union(b);
+  ASSERT_EQ(a.size(), 5UL);
+  ASSERT_TRUE(b.empty());
+  ASSERT_TRUE(a.IsBalanced());
+}
+
+namespace {
+struct CopyCounted {
+  static int copies;
+  int id;
+  explicit CopyCounted(int id = 0) : id(id) {}
+  CopyCounted(const CopyCounted &other) : id(other.id) { ++copies; }
+  CopyCounted &operator=(const CopyCounted &other) = default;
+  bool operator<(const CopyCounted &other) const { return id < other.id; }
+};
+int CopyCounted::copies = 0;
+}  // namespace
+
+TEST(SetTest, KeyOnlyNodes) {
+  ASSERT_TRUE((std::is_same<s21::set<int>::node_type,
+                            s21::Node<int, void>>::value));
+  ASSERT_LT(sizeof(s21::Node<std::string, void>),
+            sizeof(s21::Node<std::string, std::string>));
+
+  s21::set<CopyCounted> set;
+  CopyCounted key(5);
+  CopyCounted::copies = 0;
+  set.insert(key);
+  ASSERT_EQ(CopyCounted::copies, 1);
+  ASSERT_EQ((*set.begin()).id, 5);
+
+  s21::set<int, std::less<int>, s21::NodePool<s21::Node<int, int>>>
+      key_value = {3, 1, 2};
+  key_value.insert(0);
+  ASSERT_EQ(*key_value.begin(), 0);
+  ASSERT_EQ(*key_value.nth(3), 3);
+}
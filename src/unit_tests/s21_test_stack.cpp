@@ -1,5 +1,7 @@
 #include <gtest/gtest.h>
 
+#include <memory>
+
 #include "../include/s21_stack.h"
 
 TEST(StackTest, DefaultConstructor) {
@@ -229,3 +231,14 @@ TEST(StackOperations, PopAfterInsertManyBackOperation) {
   EXPECT_EQ(stack.size(), 4);
   EXPECT_EQ(stack.top(), 4);
 }
+
+TEST(StackTest, MoveOnlyElements) {
+  s21::stack<std::unique_ptr<int>> stack;
+  stack.push(std::make_unique<int>(1));
+  stack.emplace(new int(2));
+  stack.insert_many_back(std::make_unique<int>(3));
+  EXPECT_EQ(*stack.top(), 3);
+  stack.pop();
+  EXPECT_EQ(*stack.top(), 2);
+  EXPECT_EQ(stack.size(), 2UL);
+}
@@ -1,5 +1,11 @@
 #include <gtest/gtest.h>
 
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
 #include "../include/s21_vector.h"
 
 TEST(constructor_test, test1) {
@@ -380,3 +386,314 @@ TEST(VectorBonusFunctionsTest, InsertManyEmptyVector) {
     EXPECT_EQ(s21_vec[i], std_vec[i]);
   }
 }
+
+// Считает живые объекты, копирования и перемещения. Перемещение не
+// бросает исключений, только если kNoexceptMove
+template <bool kNoexceptMove>
+struct Tracked {
+  static int alive, copies, moves, copies_left;
+  int value;
+  Tracked(int v = 0) : value(v) { ++alive; }
+  Tracked(const Tracked &other) : value(other.value) {
+    if (copies_left-- == 0) throw std::runtime_error("copy failed");
+    ++copies;
+    ++alive;
+  }
+  Tracked(Tracked &&other) noexcept(kNoexceptMove) : value(other.value) {
+    ++moves;
+    ++alive;
+  }
+  Tracked &operator=(const Tracked &) = default;
+  Tracked &operator=(Tracked &&) = default;
+  ~Tracked() { --alive; }
+  static void Reset() {
+    alive = copies = moves = 0;
+    copies_left = -1;
+  }
+};
+template <bool kNoexceptMove>
+int Tracked<kNoexceptMove>::alive = 0;
+template <bool kNoexceptMove>
+int Tracked<kNoexceptMove>::copies = 0;
+template <bool kNoexceptMove>
+int Tracked<kNoexceptMove>::moves = 0;
+template <bool kNoexceptMove>
+int Tracked<kNoexceptMove>::copies_left = -1;
+
+TEST(VectorStorageTest, ConstructsOnlyLiveElements) {
+  using Item = Tracked<true>;
+  Item::Reset();
+  {
+    s21::vector<Item> a(3);
+    a.reserve(1000);
+    EXPECT_EQ(Item::alive, 3);
+    a.pop_back();
+    EXPECT_EQ(Item::alive, 2);
+    a.resize(5);
+    EXPECT_EQ(Item::alive, 5);
+    a.clear();
+    EXPECT_EQ(Item::alive, 0);
+    EXPECT_EQ(a.capacity(), 1000UL);
+    for (int i = 0; i < 10; ++i) a.push_back(Item(i));
+    a.erase(a.begin());
+    EXPECT_EQ(Item::alive, 9);
+    EXPECT_EQ(a[0].value, 1);
+  }
+  EXPECT_EQ(Item::alive, 0);
+}
+
+TEST(VectorStorageTest, MovesOnGrowOnlyWhenNoexcept) {
+  Tracked<true>::Reset();
+  s21::vector<Tracked<true>> moved;
+  for (int i = 0; i < 100; ++i) {
+    Tracked<true> item(i);
+    moved.push_back(item);
+  }
+  // Копируется только каждый добавляемый элемент, рост их перемещает
+  EXPECT_EQ(Tracked<true>::copies, 100);
+  EXPECT_GT(Tracked<true>::moves, 0);
+
+  Tracked<false>::Reset();
+  s21::vector<Tracked<false>> copied;
+  for (int i = 0; i < 100; ++i) {
+    Tracked<false> item(i);
+    copied.push_back(item);
+  }
+  EXPECT_EQ(Tracked<false>::moves, 0);
+  EXPECT_GT(Tracked<false>::copies, 100);
+}
+
+TEST(VectorStorageTest, FailedGrowthKeepsContents) {
+  using Item = Tracked<false>;
+  Item::Reset();
+  {
+    s21::vector<Item> a = {1, 2, 3, 4};
+    Item::copies_left = 2;
+    EXPECT_THROW(a.reserve(16), std::runtime_error);
+    EXPECT_EQ(a.capacity(), 4UL);
+    ASSERT_EQ(a.size(), 4UL);
+    EXPECT_EQ(a[3].value, 4);
+    EXPECT_EQ(Item::alive, 4);
+  }
+  EXPECT_EQ(Item::alive, 0);
+}
+
+TEST(VectorStorageTest, InsertsOwnElement) {
+  s21::vector<std::string> a = {"first", "second"};
+  // Рост буфера: новый элемент копируется до переноса старых
+  a.push_back(a[0]);
+  a.insert(a.begin(), a[2]);
+  // Сдвиг без роста: вставляемый элемент сдвигается сам
+  a.reserve(10);
+  a.insert(a.begin() + 1, a[1]);
+  ASSERT_EQ(a.size(), 5UL);
+  EXPECT_EQ(a[0], "first");
+  EXPECT_EQ(a[1], "first");
+  EXPECT_EQ(a[2], "first");
+  EXPECT_EQ(a[3], "second");
+  EXPECT_EQ(a[4], "first");
+}
+
+TEST(VectorStorageTest, MoveOnlyElements) {
+  s21::vector<std::unique_ptr<int>> a;
+  for (int i = 0; i < 10; ++i) a.push_back(std::make_unique<int>(i));
+  a.emplace_back(new int(10));
+  a.emplace(a.begin(), std::make_unique<int>(-1));
+  a.insert(a.begin() + 1, std::make_unique<int>(-2));
+  a.insert_many(a.begin() + 2, std::make_unique<int>(-3),
+                std::make_unique<int>(-4));
+  a.erase(a.begin());
+  ASSERT_EQ(a.size(), 14UL);
+  EXPECT_EQ(*a[0], -2);
+  EXPECT_EQ(*a[1], -3);
+  EXPECT_EQ(*a[2], -4);
+  EXPECT_EQ(*a[3], 0);
+  EXPECT_EQ(*a[13], 10);
+}
+
+TEST(VectorStorageTest, InsertManyWithoutCopies) {
+  using Item = Tracked<true>;
+  Item::Reset();
+  s21::vector<Item> a;
+  a.reserve(8);
+  for (int i = 0; i < 4; ++i) a.emplace_back(i);
+  // Без роста: элементы создаются из аргументов прямо в буфере
+  a.insert_many(a.begin() + 1, 10, 11);
+  // С ростом: новые элементы создаются в новом буфере, старые переносятся
+  a.insert_many(a.begin(), 20, 21, 22, Item(23));
+  a.insert_many_back(30);
+  EXPECT_EQ(Item::copies, 0);
+  int expected[] = {20, 21, 22, 23, 0, 10, 11, 1, 2, 3, 30};
+  ASSERT_EQ(a.size(), 11UL);
+  for (size_t i = 0; i < a.size(); ++i) EXPECT_EQ(a[i].value, expected[i]);
+}
+
+// Владеет ресурсом, но не хранит указателей на себя: переносится побайтово
+struct Relocatable {
+  static int moves;
+  std::unique_ptr<int> value;
+  explicit Relocatable(int v) : value(std::make_unique<int>(v)) {}
+  Relocatable(Relocatable &&other) noexcept : value(std::move(other.value)) {
+    ++moves;
+  }
+};
+int Relocatable::moves = 0;
+
+template <>
+struct s21::is_trivially_relocatable<Relocatable> : std::true_type {};
+
+TEST(VectorStorageTest, RelocatesWithoutMoves) {
+  Relocatable::moves = 0;
+  s21::vector<Relocatable> a;
+  for (int i = 0; i < 100; ++i) a.emplace_back(i);
+  a.emplace(a.begin() + 50, -1);
+  a.insert_many(a.begin(), -2, -3);
+  a.erase(a.begin() + 2);
+  a.shrink_to_fit();
+  EXPECT_EQ(Relocatable::moves, 0);
+  ASSERT_EQ(a.size(), 102UL);
+  EXPECT_EQ(*a[0].value, -2);
+  EXPECT_EQ(*a[1].value, -3);
+  EXPECT_EQ(*a[2].value, 1);
+  EXPECT_EQ(*a[51].value, -1);
+  EXPECT_EQ(*a[101].value, 99);
+}
+
+TEST(VectorStorageTest, GrowsPastMappedThreshold) {
+  // Рост проходит через realloc, переход к mmap и mremap
+  const size_t count = s21::kRawMapBytes / sizeof(uint64_t) * 2 + 3;
+  s21::vector<uint64_t> a;
+  for (size_t i = 0; i < count; ++i) a.push_back(i);
+  a.insert(a.begin() + 1, a[count - 1]);
+  a.erase(a.begin());
+  ASSERT_EQ(a.size(), count);
+  EXPECT_EQ(a[0], count - 1);
+  EXPECT_EQ(a[1], 1UL);
+  EXPECT_EQ(a[count - 1], count - 1);
+  a.resize(10);
+  a.shrink_to_fit();
+  EXPECT_EQ(a.capacity(), 10UL);
+  EXPECT_EQ(a[9], 9UL);
+}
+
+TEST(VectorRangeTest, EraseAndInsertRanges) {
+  s21::vector<std::string> a = {"0", "1", "2", "3", "4", "5"};
+  auto it = a.erase(a.begin() + 1, a.begin() + 4);
+  EXPECT_EQ(*it, "4");
+  EXPECT_EQ(a.erase(a.end(), a.end()), a.end());
+  std::vector<std::string> batch = {"a", "b", "c"};
+  // Без роста и с ростом буфера
+  a.reserve(10);
+  it = a.insert(a.begin() + 1, batch.begin(), batch.end());
+  EXPECT_EQ(*it, "a");
+  it = a.insert(a.end(), batch.begin(), batch.end());
+  EXPECT_EQ(it, a.begin() + 6);
+  a.insert(a.begin(), batch.begin(), batch.end());
+  std::vector<std::string> expected = {"a", "b", "c", "0", "a", "b",
+                                       "c", "4", "5", "a", "b", "c"};
+  ASSERT_EQ(a.size(), expected.size());
+  for (size_t i = 0; i < a.size(); ++i) EXPECT_EQ(a[i], expected[i]);
+
+  // Однопроходный диапазон
+  s21::vector<int> b = {1, 5};
+  std::istringstream input("2 3 4");
+  b.insert(b.begin() + 1, std::istream_iterator<int>(input),
+           std::istream_iterator<int>());
+  b.append_range(std::vector<int>{6, 7});
+  b.append_range(b);
+  int values[] = {1, 2, 3, 4, 5, 6, 7, 1, 2, 3, 4, 5, 6, 7};
+  ASSERT_EQ(b.size(), 14UL);
+  for (size_t i = 0; i < b.size(); ++i) EXPECT_EQ(b[i], values[i]);
+}
+
+// Распределитель, считающий выделения буферов
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+  static int allocations;
+  CountingAllocator() = default;
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U> &) {}
+  T *allocate(size_t n) {
+    ++allocations;
+    return std::allocator<T>().allocate(n);
+  }
+  void deallocate(T *ptr, size_t n) { std::allocator<T>().deallocate(ptr, n); }
+  bool operator==(const CountingAllocator &) const { return true; }
+  bool operator!=(const CountingAllocator &) const { return false; }
+};
+template <typename T>
+int CountingAllocator<T>::allocations = 0;
+
+TEST(VectorRangeTest, GrowingInsertBuildsInPlace) {
+  // Диапазон больше временного буфера на стеке: выделяется только новый
+  // буфер вектора
+  std::vector<int> batch(200);
+  for (int i = 0; i < 200; ++i) batch[i] = i;
+  s21::vector<int, CountingAllocator<int>> a = {-1, -2};
+  CountingAllocator<int>::allocations = 0;
+  a.insert(a.begin() + 1, batch.begin(), batch.end());
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  ASSERT_EQ(a.size(), 202UL);
+  EXPECT_EQ(a[0], -1);
+  EXPECT_EQ(a[1], 0);
+  EXPECT_EQ(a[200], 199);
+  EXPECT_EQ(a[201], -2);
+
+  // Диапазон из самого вектора при росте через realloc
+  s21::vector<int> b;
+  b.assign(batch.begin(), batch.end());
+  b.insert(b.begin() + 100, b.begin(), b.end());
+  ASSERT_EQ(b.size(), 400UL);
+  EXPECT_EQ(b[99], 99);
+  EXPECT_EQ(b[100], 0);
+  EXPECT_EQ(b[299], 199);
+  EXPECT_EQ(b[300], 100);
+  b.insert(b.begin(), batch.begin(), batch.end());
+  EXPECT_EQ(b[0], 0);
+  EXPECT_EQ(b[200], 0);
+  EXPECT_EQ(b[599], 199);
+}
+
+TEST(VectorRangeTest, AssignReusesBuffer) {
+  s21::vector<std::string> a = {"a", "b", "c", "d"};
+  const std::string *buffer = a.data();
+  a.assign({"x", "y"});
+  EXPECT_EQ(a.data(), buffer);
+  ASSERT_EQ(a.size(), 2UL);
+  EXPECT_EQ(a[1], "y");
+  std::vector<std::string> more = {"1", "2", "3"};
+  a.assign(more.begin(), more.end());
+  EXPECT_EQ(a.data(), buffer);
+  EXPECT_EQ(a[2], "3");
+  // Нехватка емкости: буфер выделяется один раз точного размера
+  std::vector<std::string> many(9, "m");
+  a.assign(many.begin(), many.end());
+  EXPECT_EQ(a.capacity(), 9UL);
+  EXPECT_EQ(a[8], "m");
+  std::istringstream input("7 8");
+  s21::vector<int> b = {1, 2, 3};
+  b.assign(std::istream_iterator<int>(input), std::istream_iterator<int>());
+  ASSERT_EQ(b.size(), 2UL);
+  EXPECT_EQ(b[1], 8);
+}
+
+TEST(VectorRangeTest, EraseIfCompacts) {
+  using Item = Tracked<true>;
+  Item::Reset();
+  s21::vector<Item> a;
+  for (int i = 0; i < 10; ++i) a.emplace_back(i);
+  size_t removed = s21::erase_if(a, [](const Item &item) {
+    return item.value % 3 == 0;
+  });
+  EXPECT_EQ(removed, 4UL);
+  EXPECT_EQ(Item::alive, 6);
+  int expected[] = {1, 2, 4, 5, 7, 8};
+  ASSERT_EQ(a.size(), 6UL);
+  for (size_t i = 0; i < a.size(); ++i) EXPECT_EQ(a[i].value, expected[i]);
+
+  s21::vector<int> b = {1, 2, 3, 4};
+  EXPECT_EQ(b.remove_if([](int x) { return x > 10; }), 0UL);
+  EXPECT_EQ(b.remove_if([](int x) { return x % 2 == 0; }), 2UL);
+  EXPECT_EQ(b[1], 3);
+}
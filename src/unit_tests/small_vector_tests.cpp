@@ -0,0 +1,102 @@
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "../include/s21_small_vector.h"
+#include "gtest/gtest.h"
+
+namespace {
+
+template <typename Vector>
+std::vector<std::string> Items(const Vector &vector) {
+  return std::vector<std::string>(vector.begin(), vector.end());
+}
+
+std::string Long(int i) {
+  return "string-with-heap-buffer-" + std::to_string(i);
+}
+
+}  // namespace
+
+TEST(SmallVectorTest, SpillsToHeapAndShrinksBack) {
+  s21::small_vector<std::string, 4> vector;
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 4UL);
+  for (int i = 0; i < 4; ++i) vector.push_back(Long(i));
+  EXPECT_TRUE(vector.is_inline());
+
+  vector.emplace_back(Long(4));
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 8UL);
+  EXPECT_EQ(vector.size(), 5UL);
+  EXPECT_EQ(vector[4], Long(4));
+
+  vector.pop_back();
+  vector.pop_back();
+  vector.shrink_to_fit();
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 4UL);
+  EXPECT_EQ(Items(vector),
+            (std::vector<std::string>{Long(0), Long(1), Long(2)}));
+
+  vector.reserve(100);
+  EXPECT_FALSE(vector.is_inline());
+  EXPECT_EQ(vector.capacity(), 100UL);
+  vector.shrink_to_fit();
+  EXPECT_TRUE(vector.is_inline());
+  EXPECT_EQ(vector.back(), Long(2));
+}
+
+TEST(SmallVectorTest, MovesBetweenModes) {
+  using Vector = s21::small_vector<std::string, 2>;
+  Vector small = {Long(0)};
+  Vector large = {Long(1), Long(2), Long(3)};
+  EXPECT_TRUE(small.is_inline());
+  EXPECT_FALSE(large.is_inline());
+
+  // Буфер из кучи забирается целиком
+  const std::string *heap = large.data();
+  Vector moved(std::move(large));
+  EXPECT_EQ(moved.data(), heap);
+  EXPECT_TRUE(large.empty());
+  EXPECT_TRUE(large.is_inline());
+
+  // Элементы встроенного буфера переносятся по одному
+  Vector moved_small(std::move(small));
+  EXPECT_TRUE(moved_small.is_inline());
+  EXPECT_EQ(moved_small[0], Long(0));
+  EXPECT_TRUE(small.empty());
+
+  moved.swap(moved_small);
+  EXPECT_EQ(Items(moved), (std::vector<std::string>{Long(0)}));
+  EXPECT_EQ(Items(moved_small),
+            (std::vector<std::string>{Long(1), Long(2), Long(3)}));
+  EXPECT_EQ(moved_small.data(), heap);
+
+  Vector copy(moved_small);
+  EXPECT_NE(copy.data(), heap);
+  copy = moved;
+  EXPECT_EQ(Items(copy), Items(moved));
+  copy = std::move(moved_small);
+  EXPECT_EQ(copy.data(), heap);
+}
+
+TEST(SmallVectorTest, VectorInterface) {
+  s21::small_vector<int, 3> vector(2);
+  EXPECT_EQ(vector[0], 0);
+  vector.insert_many_back(3, 4);
+  EXPECT_FALSE(vector.is_inline());
+  auto it = vector.insert_many(vector.begin() + 1, 1, 2);
+  EXPECT_EQ(*it, 0);
+  vector.erase(vector.begin());
+  vector.insert(vector.begin(), 7);
+  vector.emplace(vector.end(), 5);
+  EXPECT_EQ(std::vector<int>(vector.begin(), vector.end()),
+            (std::vector<int>{7, 1, 2, 0, 3, 4, 5}));
+  EXPECT_THROW(vector.at(7), std::out_of_range);
+  vector.resize(2);
+  EXPECT_EQ(vector.size(), 2UL);
+  vector.clear();
+  EXPECT_TRUE(vector.empty());
+  EXPECT_FALSE(vector.is_inline());
+}
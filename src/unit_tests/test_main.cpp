@@ -1,12 +1,22 @@
+#include "btree_tests.cpp"
+#include "concurrent_tests.cpp"
+#include "counted_multiset_tests.cpp"
+#include "deque_tests.cpp"
+#include "flat_tests.cpp"
+#include "frozen_tests.cpp"
 #include "list_tests.cpp"
 #include "map_tests.cpp"
+#include "pmr_tests.cpp"
 #include "queue_tests.cpp"
+#include "ring_buffer_tests.cpp"
 #include "s21_test_array.cpp"
 #include "s21_test_multiset.cpp"
 #include "s21_test_set.cpp"
 #include "s21_test_stack.cpp"
 #include "s21_test_vector.cpp"
+#include "small_vector_tests.cpp"
 #include "tree_tests.cpp"
+#include "unordered_tests.cpp"
 
 int main(int argc, char* argv[]) {
   testing::InitGoogleTest(&argc, argv);
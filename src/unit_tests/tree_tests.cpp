@@ -1,3 +1,10 @@
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "../include/AVL_tree.h"
 #include "gtest/gtest.h"
 
@@ -591,6 +598,141 @@ TEST_F(IntTree, BalanceTest_DeletetRandom) {
   ASSERT_TRUE(tree->IsBalanced());
 }
 
+TEST_F(IntTree, BalanceTest_CachedHeightsAfterMixedOps) {
+  std::mt19937 rng(7);
+  for (int i = 0; i < 2000; ++i) {
+    int key = static_cast<int>(rng() % 1000);
+    if (rng() % 3 == 0) {
+      tree->erase(key);
+    } else {
+      tree->insert(std::make_pair(key, key));
+    }
+    ASSERT_TRUE(tree->IsBalanced());
+  }
+  int n = static_cast<int>(tree->size());
+  ASSERT_LE(tree->Height(), 1.45 * std::log2(n + 2));
+}
+
+TEST_F(IntTree, CopyKeepsHeights) {
+  for (int i = 1; i <= 100; ++i) tree->insert(std::make_pair(i, i));
+  BinaryTree<int, int> copy(*tree);
+  ASSERT_EQ(copy.Height(), tree->Height());
+  ASSERT_TRUE(copy.IsBalanced());
+}
+
+TEST_F(IntTree, IterateBothDirectionsAfterRebalancing) {
+  std::mt19937 rng(11);
+  std::set<int> expected;
+  for (int i = 0; i < 3000; ++i) {
+    int key = static_cast<int>(rng() % 1500);
+    if (rng() % 4 == 0) {
+      tree->erase(key);
+      expected.erase(key);
+    } else {
+      tree->insert(std::make_pair(key, -key));
+      expected.insert(key);
+    }
+  }
+  ASSERT_TRUE(tree->IsBalanced());
+
+  auto expected_it = expected.begin();
+  for (auto it = tree->begin(); it != tree->end(); ++it, ++expected_it) {
+    ASSERT_EQ(it.first(), *expected_it);
+    ASSERT_EQ(*it, -*expected_it);
+  }
+  ASSERT_EQ(expected_it, expected.end());
+
+  auto expected_rit = expected.rbegin();
+  for (auto rit = tree->rbegin(); rit != tree->rend(); ++rit, ++expected_rit) {
+    ASSERT_EQ(rit.first(), *expected_rit);
+  }
+  ASSERT_EQ(expected_rit, expected.rend());
+}
+
+TEST_F(IntTree, DecrementEnd) {
+  for (int i = 1; i <= 10; ++i) tree->insert(std::make_pair(i, i * 10));
+
+  auto it = tree->end();
+  --it;
+  ASSERT_EQ(it.first(), 10);
+  it--;
+  ASSERT_EQ(*it, 90);
+
+  auto rit = tree->rend();
+  --rit;
+  ASSERT_EQ(rit.first(), 1);
+  ASSERT_EQ(rit.base(), tree->begin());
+}
+
+TEST_F(IntTree, ReverseOnEmpty) { ASSERT_EQ(tree->rbegin(), tree->rend()); }
+
+TEST_F(IntTree, CopyKeepsParents) {
+  for (int i = 1; i <= 50; ++i) tree->insert(std::make_pair(i, i));
+  BinaryTree<int, int> copy(*tree);
+  ASSERT_TRUE(copy.IsBalanced());
+  int expected = 50;
+  for (auto rit = copy.rbegin(); rit != copy.rend(); ++rit) {
+    ASSERT_EQ(rit.first(), expected--);
+  }
+  ASSERT_EQ(expected, 0);
+}
+
+TEST(NodePoolTest, ReusesFreedSlots) {
+  NodePool<Node<int, int>> pool;
+  Node<int, int>* first = pool.create(1, 1);
+  pool.destroy(first);
+  Node<int, int>* second = pool.create(2, 2);
+  ASSERT_EQ(first, second);
+  ASSERT_EQ(pool.slab_count(), 1UL);
+  pool.release();
+  ASSERT_EQ(pool.slab_count(), 0UL);
+}
+
+TEST(NodePoolTest, AlignsOverAlignedNodes) {
+  struct alignas(64) Wide {
+    int value;
+    Wide(int v = 0) : value(v) {}
+    bool operator<(const Wide& other) const { return value < other.value; }
+  };
+  using WideNode = Node<Wide, int>;
+  NodePool<WideNode> pool;
+  std::vector<WideNode*> nodes;
+  for (int i = 0; i < 150; ++i) nodes.push_back(pool.create(Wide(i), i));
+  for (WideNode* node : nodes) {
+    ASSERT_EQ(reinterpret_cast<std::uintptr_t>(node) % alignof(WideNode),
+              0UL);
+  }
+  ASSERT_EQ(pool.slab_count(), 2UL);
+  for (WideNode* node : nodes) pool.destroy(node);
+}
+
+TEST(NodePoolTest, ClearAndRefill) {
+  BinaryTree<int, std::string> tree;
+  for (int i = 0; i < 1000; ++i) tree.insert(std::make_pair(i, "value"));
+  tree.clear();
+  ASSERT_TRUE(tree.empty());
+  for (int i = 0; i < 1000; ++i) tree.insert(std::make_pair(i, "value"));
+  ASSERT_EQ(tree.size(), 1000UL);
+  ASSERT_TRUE(tree.IsBalanced());
+}
+
+TEST(NodePoolTest, HeapAllocator) {
+  using HeapTree =
+      BinaryTree<int, int, std::less<int>, HeapNodeAllocator<Node<int, int>>>;
+  HeapTree tree;
+  for (int i = 0; i < 100; ++i) tree.insert(std::make_pair(i, i));
+  HeapTree copy(tree);
+  tree.erase(50);
+  ASSERT_EQ(tree.size(), 99UL);
+  ASSERT_EQ(copy.size(), 100UL);
+  ASSERT_TRUE(copy.IsBalanced());
+
+  tree.merge(copy);
+  ASSERT_EQ(tree.size(), 100UL);
+  ASSERT_EQ(copy.size(), 99UL);
+  ASSERT_TRUE(copy.IsBalanced());
+}
+
 TEST_F(IntTree, InsertMany) {
   std::pair<int, int> data1 = std::make_pair(1, 100);
   std::pair<int, int> data2 = std::make_pair(2, 200);
@@ -613,4 +755,28 @@ TEST_F(IntTree, InsertMany) {
   ASSERT_EQ(tree->find(3).second(), 300);
 }
 
+struct CountingLess {
+  size_t* calls;
+  bool operator()(int a, int b) const {
+    ++*calls;
+    return a < b;
+  }
+};
+
+TEST(CompareTest, FindComparesOncePerLevel) {
+  size_t calls = 0;
+  BinaryTree<int, int, CountingLess> tree(CountingLess{&calls});
+  // 1023 последовательных ключа дают идеальное дерево из 10 уровней
+  for (int i = 0; i < 1023; ++i) tree.insert(std::make_pair(i, i));
+
+  for (int i = -1; i <= 1023; ++i) {
+    calls = 0;
+    tree.contains(i);
+    ASSERT_LE(calls, 11UL) << i;
+  }
+  calls = 0;
+  tree.insert(std::make_pair(512, 0));
+  ASSERT_LE(calls, 11UL);
+}
+
 }  // namespace s21
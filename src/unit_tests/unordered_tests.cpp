@@ -0,0 +1,154 @@
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "../s21_containers.h"
+#include "gtest/gtest.h"
+
+TEST(UnorderedMapTest, BasicOperations) {
+  s21::unordered_map<std::string, int> map = {{"one", 1}, {"two", 2}};
+  EXPECT_EQ(map.size(), 2UL);
+  EXPECT_EQ(map.at("one"), 1);
+  EXPECT_THROW(map.at("three"), std::out_of_range);
+
+  map["three"] = 3;
+  EXPECT_FALSE(map.insert({"three", 30}).second);
+  EXPECT_EQ(map.insert_or_assign("three", 33).first.second(), 33);
+  EXPECT_TRUE(map.emplace("four", 4).second);
+  EXPECT_FALSE(map.try_emplace("four", 40).second);
+  EXPECT_EQ(*map.find("four"), 4);
+  EXPECT_EQ(map.find("five"), map.end());
+  EXPECT_TRUE(map.erase("two"));
+  EXPECT_FALSE(map.erase("two"));
+  EXPECT_EQ(map.count("two"), 0UL);
+
+  auto results = map.insert_many(std::make_pair(std::string("five"), 5),
+                                 std::make_pair(std::string("one"), 10));
+  EXPECT_TRUE(results[0].second);
+  EXPECT_EQ(results[0].first.first(), "five");
+  EXPECT_FALSE(results[1].second);
+  EXPECT_EQ(*results[1].first, 1);
+
+  int sum = 0;
+  for (auto it = map.begin(); it != map.end(); ++it) sum += *it;
+  EXPECT_EQ(sum, 1 + 33 + 4 + 5);
+  EXPECT_THROW(*map.end(), std::out_of_range);
+}
+
+TEST(UnorderedMapTest, MatchesStdUnorderedMap) {
+  std::mt19937 rng(13);
+  s21::unordered_map<int, int> map;
+  std::unordered_map<int, int> map_std;
+  for (int step = 0; step < 50000; ++step) {
+    int key = static_cast<int>(rng() % 5000);
+    if (rng() % 3 == 0) {
+      ASSERT_EQ(map.erase(key), map_std.erase(key) == 1);
+    } else {
+      ASSERT_EQ(map.insert({key, step}).second,
+                map_std.insert({key, step}).second);
+    }
+    ASSERT_EQ(map.size(), map_std.size());
+  }
+  ASSERT_LE(map.load_factor(), map.max_load_factor());
+  size_t visited = 0;
+  for (auto it = map.begin(); it != map.end(); ++it, ++visited) {
+    ASSERT_EQ(*it, map_std.at(it.first()));
+  }
+  EXPECT_EQ(visited, map_std.size());
+  for (int key = 0; key < 5000; ++key) {
+    ASSERT_EQ(map.contains(key), map_std.count(key) == 1);
+  }
+}
+
+namespace {
+// Хеш, у которого все ключи попадают в одну группу с одинаковым H2:
+// проба идет через все группы и удаленные ячейки
+struct ConstantHash {
+  size_t operator()(int) const { return 0; }
+};
+}  // namespace
+
+TEST(UnorderedSetTest, CollidingKeysAndTombstones) {
+  s21::unordered_set<int, ConstantHash> set;
+  for (int i = 0; i < 200; ++i) ASSERT_TRUE(set.insert(i).second);
+  for (int i = 0; i < 200; i += 2) ASSERT_TRUE(set.erase(i));
+  for (int i = 0; i < 200; ++i) ASSERT_EQ(set.contains(i), i % 2 == 1);
+  // Повторные вставки занимают удаленные ячейки
+  size_t buckets = set.bucket_count();
+  for (int i = 0; i < 200; i += 2) ASSERT_TRUE(set.insert(i).second);
+  EXPECT_EQ(set.bucket_count(), buckets);
+  EXPECT_EQ(set.size(), 200UL);
+}
+
+TEST(UnorderedSetTest, EraseKeepsOtherIterators) {
+  s21::unordered_set<int> set;
+  for (int i = 0; i < 1000; ++i) set.insert(i);
+  auto kept = set.find(500);
+  for (int i = 0; i < 1000; ++i) {
+    if (i != 500) set.erase(i);
+  }
+  EXPECT_EQ(*kept, 500);
+  EXPECT_EQ(set.begin(), kept);
+  EXPECT_EQ(++kept, set.end());
+}
+
+TEST(UnorderedSetTest, ReserveRehashAndLoadFactor) {
+  s21::unordered_set<int> set;
+  set.reserve(1000);
+  size_t buckets = set.bucket_count();
+  EXPECT_GE(buckets * set.max_load_factor(), 1000.0f);
+  for (int i = 0; i < 1000; ++i) set.insert(i);
+  EXPECT_EQ(set.bucket_count(), buckets);
+
+  set.max_load_factor(0.25f);
+  EXPECT_LE(set.load_factor(), 0.25f);
+  EXPECT_THROW(set.max_load_factor(0.0f), std::invalid_argument);
+  set.rehash(1 << 14);
+  EXPECT_GE(set.bucket_count(), 1UL << 14);
+  for (int i = 0; i < 1000; ++i) ASSERT_TRUE(set.contains(i));
+
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.begin(), set.end());
+  set.rehash(0);
+  EXPECT_EQ(set.bucket_count(), 0UL);
+  EXPECT_FALSE(set.contains(1));
+}
+
+TEST(UnorderedSetTest, TinyLoadFactorStillGrows) {
+  // Запас 16 * 0.05 округляется до нуля
+  s21::unordered_set<int> set;
+  set.max_load_factor(0.05f);
+  for (int i = 0; i < 40; ++i) set.insert(i);
+  EXPECT_EQ(set.size(), 40UL);
+  EXPECT_LE(set.load_factor(), 0.05f);
+  for (int i = 0; i < 40; ++i) ASSERT_TRUE(set.contains(i));
+  EXPECT_FALSE(set.contains(40));
+  for (int i = 0; i < 40; i += 2) set.erase(i);
+  for (int i = 40; i < 60; ++i) set.insert(i);
+  EXPECT_EQ(set.size(), 40UL);
+}
+
+TEST(UnorderedSetTest, CopyMoveAndMerge) {
+  s21::unordered_set<std::string> set;
+  for (int i = 0; i < 300; ++i) set.insert(std::to_string(i));
+  s21::unordered_set<std::string> copy(set);
+  copy.erase("7");
+  EXPECT_TRUE(set.contains("7"));
+  EXPECT_FALSE(copy.contains("7"));
+
+  s21::unordered_set<std::string> moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 299UL);
+
+  s21::unordered_set<std::string> other = {"7", "8", "1000"};
+  moved.merge(other);
+  EXPECT_EQ(moved.size(), 301UL);
+  EXPECT_EQ(other.size(), 1UL);
+  EXPECT_TRUE(other.contains("8"));
+
+  std::unordered_set<std::string> items;
+  for (auto it = moved.begin(); it != moved.end(); ++it) items.insert(*it);
+  EXPECT_EQ(items.size(), moved.size());
+}